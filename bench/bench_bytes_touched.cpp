@@ -0,0 +1,228 @@
+#define CMS_BENCH_BYTES_TOUCHED     1
+
+#ifdef CMS_BENCH_BYTES_TOUCHED
+
+/// @author comser.dev
+///
+/// NUL 종료 커널과 길이 기반 커널이 연산 하나에 접근하는 바이트 범위와 시간을 비교하는 호스트 벤치마크입니다.
+///
+/// 빌드: g++ -std=gnu++17 -O2 -Isrc bench/bench_bytes_touched.cpp src/*.cpp -o bench_bytes_touched -lpthread
+///
+/// How: - touched: 본문 시작부터 커널이 읽거나 쓴 가장 먼 바이트까지의 길이(최고 오프셋 + 1)입니다. 시간 환산이 아닌 실측값입니다.
+///        본문을 보호 페이지(PROT_NONE) 바로 앞에 놓되 앞쪽 g바이트만 접근 가능하게 배치하고, 커널이 보호 페이지를
+///        건드리면 SIGSEGV를 잡아 되돌아옵니다. 폴트 없이 끝나는 가장 작은 g를 이진 탐색하면 그 값이 touched입니다.
+///        (strlen 경로는 NUL까지 len + 1, 길이 경로는 필요한 구간만큼. 벡터화된 커널은 정렬된 블록 단위로 읽은 만큼 보고됩니다.)
+///      - ns/op: 같은 연산의 평균 시간이며, 같은 길이의 strlen 한 번을 기준선 행으로 함께 출력합니다.
+///      원본 길이(64 → 1024 → 4096)를 늘렸을 때 touched가 함께 늘어나면 원본 전체를 훑는 경로입니다.
+///      측정 대상 연산은 모두 멱등(idempotent)이라 시간 측정 반복 사이에 입력을 복원하지 않습니다.
+///      (보호 페이지를 쓸 수 없는 플랫폼에서는 touched 열을 '-'로 출력합니다.)
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include "../src/cmsString.h"
+#if defined(__unix__) || defined(__APPLE__)
+#include <csetjmp>
+#include <csignal>
+#include <sys/mman.h>
+#include <unistd.h>
+#define CMS_BENCH_GUARD_PAGES 1
+#endif
+
+namespace {
+    volatile size_t g_sink = 0; ///< 최적화로 연산이 제거되지 않도록 결과를 흘려보내는 곳
+
+    constexpr size_t MAX_LEN = 4096;
+    constexpr int ITERATIONS = 20000;
+    /// touched 탐색 상한의 여유분 (len + 1을 넘겨 읽는 커널도 이 범위까지는 값으로 보고)
+    constexpr size_t PROBE_SLACK = 64;
+
+    /// fn을 ITERATIONS번 실행한 평균 시간(ns)을 반환합니다.
+    template<typename Fn>
+    double nsPerOp(Fn&& fn) {
+        for (int i = 0; i < ITERATIONS / 10; ++i) fn(); // 워밍업
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) fn();
+        const auto t1 = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(t1 - t0).count() / ITERATIONS;
+    }
+
+#ifdef CMS_BENCH_GUARD_PAGES
+    /// 접근 가능 영역 + 보호 영역으로 이루어진 매핑입니다. 보호 영역은 시작 주소가 페이지 경계입니다.
+    struct GuardedRegion {
+        unsigned char* map = nullptr;
+        unsigned char* guard = nullptr; ///< 보호 영역 시작 (본문은 guard - g에 배치)
+        size_t guardLen = 0;
+        size_t mapLen = 0;
+
+        bool init() {
+            const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+            const size_t span = ((MAX_LEN + PROBE_SLACK + 1 + page - 1) / page) * page;
+            mapLen = span * 2;
+            void* p = mmap(nullptr, mapLen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED) return false;
+            map = (unsigned char*)p;
+            guard = map + span;
+            guardLen = span;
+            return true;
+        }
+        void protect(bool on) { mprotect(guard, guardLen, on ? PROT_NONE : (PROT_READ | PROT_WRITE)); }
+    };
+
+    GuardedRegion g_region;
+    sigjmp_buf g_faultJump;
+
+    void onFault(int) { siglongjmp(g_faultJump, 1); }
+
+    /// 본문을 앞쪽 g바이트만 접근 가능하게 배치하고 op를 실행합니다. (보호 영역을 건드리면 false)
+    ///
+    /// @param setup 보호 전에 실행할 준비 단계 (예: 버퍼를 감싸는 객체 생성, 본문 전체에 접근 가능)
+    /// @param op 측정 대상 연산 (본문 시작 포인터를 받음)
+    template<typename Setup, typename Op>
+    bool runsWithin(const char* text, size_t len, size_t g, Setup& setup, Op& op) {
+        char* const p = (char*)(g_region.guard - g);
+        g_region.protect(false);
+        memcpy(p, text, len + 1);
+        setup(p);
+        g_region.protect(true);
+        struct sigaction sa, oldSegv, oldBus;
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_handler = onFault;
+        sigemptyset(&sa.sa_mask);
+        sigaction(SIGSEGV, &sa, &oldSegv);
+        sigaction(SIGBUS, &sa, &oldBus);
+        volatile bool ok = false;
+        if (sigsetjmp(g_faultJump, 1) == 0) {
+            op(p);
+            ok = true;
+        }
+        sigaction(SIGSEGV, &oldSegv, nullptr);
+        sigaction(SIGBUS, &oldBus, nullptr);
+        g_region.protect(false);
+        return ok;
+    }
+
+    /// op가 본문 시작부터 접근한 범위(최고 오프셋 + 1)를 이진 탐색으로 구합니다. (상한 초과 시 SIZE_MAX)
+    template<typename Setup, typename Op>
+    size_t bytesTouched(const char* text, size_t len, Setup&& setup, Op&& op) {
+        if (!g_region.guard) return SIZE_MAX;
+        size_t lo = 0, hi = len + 1 + PROBE_SLACK;
+        if (!runsWithin(text, len, hi, setup, op)) return SIZE_MAX;
+        while (lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+            if (runsWithin(text, len, mid, setup, op)) hi = mid;
+            else lo = mid + 1;
+        }
+        return lo;
+    }
+#else
+    template<typename Setup, typename Op>
+    size_t bytesTouched(const char*, size_t, Setup&&, Op&&) { return SIZE_MAX; }
+#endif
+
+    /// 준비 단계가 필요 없는 커널용 touched 측정입니다.
+    template<typename Op>
+    size_t bytesTouched(const char* text, size_t len, Op&& op) {
+        return bytesTouched(text, len, [](char*) {}, op);
+    }
+
+    /// 한 행을 출력합니다.
+    void report(const char* op, const char* path, size_t len, size_t touched, double ns) {
+        if (touched == SIZE_MAX) printf("%-22s %-8s %6zu %9s %10.1f\n", op, path, len, "-", ns);
+        else printf("%-22s %-8s %6zu %9zu %10.1f\n", op, path, len, touched, ns);
+    }
+}
+
+int main() {
+    static char src[MAX_LEN + 1];
+    static char work[MAX_LEN + 1];
+    static char out[64];
+
+#ifdef CMS_BENCH_GUARD_PAGES
+    if (!g_region.init()) printf("(mmap 실패: touched 열 생략)\n");
+#endif
+
+    printf("%-22s %-8s %6s %9s %10s\n", "operation", "path", "len", "touched", "ns/op");
+    printf("--------------------------------------------------------------\n");
+
+    const size_t lengths[] = {64, 1024, MAX_LEN};
+    for (size_t len : lengths) {
+        // 한글(3바이트)과 ASCII를 섞은 유효한 UTF-8 본문
+        size_t n = 0;
+        while (n + 3 <= len) {
+            if ((n / 3) % 4 == 0) { memcpy(src + n, "\xEA\xB0\x80", 3); n += 3; }
+            else { src[n] = (char)('a' + n % 26); n++; }
+        }
+        while (n < len) src[n++] = 'z';
+        src[len] = '\0';
+
+        // 기준선: 같은 길이의 strlen (strlen 경로가 커널 앞에서 추가로 치르는 비용)
+        report("strlen", "-", len,
+               bytesTouched(src, len, [&](char* p) { g_sink = g_sink + strlen(p); }),
+               nsPerOp([&] { g_sink = g_sink + strlen(src); }));
+
+        report("byteSubstring(8B)", "strlen", len,
+               bytesTouched(src, len, [&](char* p) { g_sink = g_sink + cms::string::byteSubstring(p, out, sizeof(out), 0, 8); }),
+               nsPerOp([&] { g_sink = g_sink + cms::string::byteSubstring(src, out, sizeof(out), 0, 8); }));
+        report("byteSubstring(8B)", "length", len,
+               bytesTouched(src, len, [&](char* p) { g_sink = g_sink + cms::string::byteSubstring(p, len, out, sizeof(out), 0, 8); }),
+               nsPerOp([&] { g_sink = g_sink + cms::string::byteSubstring(src, len, out, sizeof(out), 0, 8); }));
+
+        // 앞쪽 몇 글자만 잘라내는 substring (끝 글자 지정)
+        report("substring(0..4)", "strlen", len,
+               bytesTouched(src, len, [&](char* p) { g_sink = g_sink + cms::string::substring(p, out, sizeof(out), 0, 4); }),
+               nsPerOp([&] { g_sink = g_sink + cms::string::substring(src, out, sizeof(out), 0, 4); }));
+        report("substring(0..4)", "length", len,
+               bytesTouched(src, len, [&](char* p) { g_sink = g_sink + cms::string::substring(p, len, out, sizeof(out), 0, 4); }),
+               nsPerOp([&] { g_sink = g_sink + cms::string::substring(src, len, out, sizeof(out), 0, 4); }));
+
+        // 양 끝에 공백이 없는 문자열의 trim (길이 경로는 양 끝만 보지만 끝 바이트와 NUL 기록 위치가 본문 끝이라 touched는 같음)
+        memcpy(work, src, len + 1);
+        report("trim(no spaces)", "strlen", len,
+               bytesTouched(src, len, [&](char* p) { g_sink = g_sink + cms::string::trim(p); }),
+               nsPerOp([&] { g_sink = g_sink + cms::string::trim(work); }));
+        report("trim(no spaces)", "length", len,
+               bytesTouched(src, len, [&](char* p) { g_sink = g_sink + cms::string::trim(p, len); }),
+               nsPerOp([&] { g_sink = g_sink + cms::string::trim(work, len); }));
+
+        // 본문 전체를 바꾸는 연산: 두 경로 모두 O(n)이지만 길이 버전은 NUL 검사 없이 고정 횟수로 돕니다.
+        report("toUpperCase", "strlen", len,
+               bytesTouched(src, len, [&](char* p) { cms::string::toUpperCase(p); g_sink = g_sink + (size_t)p[0]; }),
+               nsPerOp([&] { cms::string::toUpperCase(work); g_sink = g_sink + (size_t)work[0]; }));
+        report("toUpperCase", "length", len,
+               bytesTouched(src, len, [&](char* p) { cms::string::toUpperCase(p, len); g_sink = g_sink + (size_t)p[0]; }),
+               nsPerOp([&] { cms::string::toUpperCase(work, len); g_sink = g_sink + (size_t)work[0]; }));
+
+        report("validateUtf8", "strlen", len,
+               bytesTouched(src, len, [&](char* p) { g_sink = g_sink + cms::string::validateUtf8(p); }),
+               nsPerOp([&] { g_sink = g_sink + cms::string::validateUtf8(src); }));
+        report("validateUtf8", "length", len,
+               bytesTouched(src, len, [&](char* p) { g_sink = g_sink + cms::string::validateUtf8(p, len); }),
+               nsPerOp([&] { g_sink = g_sink + cms::string::validateUtf8(src, len); }));
+
+        // 유효한 본문의 sanitizeUtf8: NUL 버전은 버퍼 안에서 NUL을 먼저 찾습니다.
+        report("sanitizeUtf8", "strlen", len,
+               bytesTouched(src, len, [&](char* p) { g_sink = g_sink + cms::string::sanitizeUtf8(p, len + 1); }),
+               nsPerOp([&] { g_sink = g_sink + cms::string::sanitizeUtf8(work, len + 1); }));
+        report("sanitizeUtf8", "length", len,
+               bytesTouched(src, len, [&](char* p) { g_sink = g_sink + cms::string::sanitizeUtf8(p, len + 1, len); }),
+               nsPerOp([&] { g_sink = g_sink + cms::string::sanitizeUtf8(work, len + 1, len); }));
+
+        // StringBase 경로: _len만 사용하므로 trim은 본문 길이와 무관합니다. (감싸는 객체 생성은 준비 단계에서 수행)
+        std::optional<cms::StringRef> probe;
+        report("StringBase::trim", "cached", len,
+               bytesTouched(src, len, [&](char* p) { probe.emplace(p, len + 1, len); },
+                            [&](char*) { probe->trim(); g_sink = g_sink + probe->length(); }),
+               [&] {
+                   cms::StringRef ref(work, sizeof(work), len);
+                   memcpy(work, src, len + 1);
+                   return nsPerOp([&] { ref.trim(); g_sink = g_sink + ref.length(); });
+               }());
+        probe.reset();
+        printf("\n");
+    }
+    return 0;
+}
+
+#endif // CMS_BENCH_BYTES_TOUCHED
@@ -0,0 +1,425 @@
+#define CMS_BENCH_QUEUE     1
+
+#ifdef CMS_BENCH_QUEUE
+
+/// @author comser.dev
+///
+/// ThreadSafeQueue와 AsyncLogger의 동시성 벤치마크입니다. 생산자 1~8개 구성에서 처리량과 지연 분포를 측정합니다.
+///
+/// 빌드: g++ -std=gnu++17 -O2 -Isrc bench/bench_cmsQueue.cpp src/*.cpp -o bench_cmsQueue -lpthread
+/// 실행: ./bench_cmsQueue [--quick] [--ms=500] [--format=csv|json] [--out=bench_output.txt] [--trace=trace.json] [필터]
+///       (--trace는 -DCMS_ENABLE_TRACE로 빌드한 경우 계측 구간을 Chrome trace-event JSON으로 저장)
+///
+/// How: 생산자 N개와 소비자 1개를 각각 다른 코어에 고정(Linux)한 뒤 정해진 시간 동안 실행합니다.
+///      - enqueue: 생산자 쪽 호출 하나의 소요 시간 (락 경합 포함)
+///      - e2e: 생산자가 찍은 타임스탬프부터 소비자가 꺼낼 때까지의 시간 (큐 대기 포함)
+///      지연은 스레드별 고정 크기 히스토그램(로그-선형 버킷, 약 3% 해상도)에 기록하므로 측정 중 할당이 없습니다.
+///      큐는 가득 차면 가장 오래된 항목을 덮어쓰므로, 생산량과 소비량의 차이를 dropped로 보고합니다.
+///
+/// 새 큐 변형 추가: Item 인코딩(encodeItem/decodeItem)이 있는 타입이면 main()의 queue 목록에
+///                 runQueueBench<새큐타입>("이름", ...) 한 줄을 추가하면 같은 방식으로 측정됩니다.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+#include "../src/cmsAsyncLogger.h"
+#include "../src/cmsQueue.h"
+#include "../src/cmsTrace.h"
+
+namespace {
+    constexpr int MAX_PRODUCERS = 8;
+    const int kProducerCounts[] = {1, 2, 4, 8};
+
+    uint64_t nowNs() {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // -------------------------------------------------------------------------
+    // 지연 히스토그램
+    // -------------------------------------------------------------------------
+
+    /// 할당 없는 로그-선형 지연 히스토그램입니다.
+    ///
+    /// How: 32ns 미만은 1ns 단위, 그 이상은 2의 거듭제곱 구간마다 32개 버킷으로 나눕니다. (상대 오차 약 3%)
+    class LatencyHistogram {
+    public:
+        static constexpr int SUB_BITS = 5;
+        static constexpr uint64_t SUBS = 1ULL << SUB_BITS;
+        static constexpr size_t BUCKETS = SUBS + (64 - SUB_BITS) * SUBS;
+
+        void reset() {
+            memset(_counts, 0, sizeof(_counts));
+            _total = 0;
+            _max = 0;
+        }
+
+        void record(uint64_t ns) {
+            _counts[indexOf(ns)]++;
+            _total++;
+            if (ns > _max) _max = ns;
+        }
+
+        void merge(const LatencyHistogram& other) {
+            for (size_t i = 0; i < BUCKETS; ++i) _counts[i] += other._counts[i];
+            _total += other._total;
+            if (other._max > _max) _max = other._max;
+        }
+
+        uint64_t count() const { return _total; }
+        uint64_t max() const { return _max; }
+
+        /// q(0~1) 분위수를 버킷 대표값(구간 중앙)으로 반환합니다.
+        uint64_t percentile(double q) const {
+            if (_total == 0) return 0;
+            const uint64_t rank = (uint64_t)(q * (double)(_total - 1)) + 1;
+            uint64_t seen = 0;
+            for (size_t i = 0; i < BUCKETS; ++i) {
+                seen += _counts[i];
+                if (seen >= rank) return std::min(valueOf(i), _max);
+            }
+            return _max;
+        }
+
+    private:
+        static size_t indexOf(uint64_t ns) {
+            if (ns < SUBS) return (size_t)ns;
+            const int exp = 63 - __builtin_clzll(ns);
+            const int shift = exp - SUB_BITS;
+            const uint64_t sub = (ns >> shift) - SUBS;
+            return (size_t)(SUBS + (uint64_t)shift * SUBS + sub);
+        }
+
+        static uint64_t valueOf(size_t index) {
+            if (index < SUBS) return index;
+            const int shift = (int)((index - SUBS) / SUBS);
+            const uint64_t sub = (index - SUBS) % SUBS;
+            return ((SUBS + sub) << shift) + ((1ULL << shift) >> 1);
+        }
+
+        uint64_t _counts[BUCKETS];
+        uint64_t _total;
+        uint64_t _max;
+    };
+
+    /// 스레드 하나의 측정 결과 (false sharing 방지를 위해 캐시 라인 정렬)
+    struct alignas(64) ThreadSlot {
+        LatencyHistogram enqueue; ///< 생산자: 호출 소요 시간
+        LatencyHistogram e2e;     ///< 소비자: 생산 시각부터 꺼낸 시각까지
+        uint64_t ops;             ///< 처리한 항목 수
+    };
+
+    // 슬롯 0은 소비자, 1..N은 생산자입니다. 정적 배열이므로 실행 중 할당이 없습니다.
+    ThreadSlot g_slots[MAX_PRODUCERS + 1];
+
+    /// 스레드를 cpu 번 코어에 고정합니다. (코어 수보다 많으면 순환, Linux 외에는 무시)
+    bool pinToCpu(std::thread& t, int cpu) {
+#ifdef __linux__
+        const unsigned n = std::thread::hardware_concurrency();
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(n ? (unsigned)cpu % n : 0, &set);
+        return pthread_setaffinity_np(t.native_handle(), sizeof(set), &set) == 0;
+#else
+        (void)t;
+        (void)cpu;
+        return false;
+#endif
+    }
+
+    // -------------------------------------------------------------------------
+    // 큐 항목 인코딩 (항목 타입마다 생산 시각을 싣고 꺼내는 방법)
+    // -------------------------------------------------------------------------
+
+    /// 최소 크기 항목: 타임스탬프와 생산자 번호만 가집니다.
+    struct Sample {
+        uint64_t stamp;
+        uint32_t producer;
+        uint32_t seq;
+    };
+
+    void encodeItem(Sample& item, uint64_t stamp, uint32_t producer, uint32_t seq) {
+        item.stamp = stamp;
+        item.producer = producer;
+        item.seq = seq;
+    }
+    uint64_t decodeItem(const Sample& item) { return item.stamp; }
+
+    /// 로그 메시지 크기의 항목: AsyncLogger가 큐에 넣는 타입과 같습니다.
+    template<size_t N>
+    void encodeItem(cms::String<N>& item, uint64_t stamp, uint32_t producer, uint32_t seq) {
+        item.clear();
+        item.appendUInt(stamp);
+        item << " producer=" << (unsigned)producer << " seq=" << (unsigned)seq << " payload=0123456789abcdef";
+    }
+    template<size_t N>
+    uint64_t decodeItem(const cms::String<N>& item) { return strtoull(item.c_str(), nullptr, 10); }
+
+    // -------------------------------------------------------------------------
+    // 결과 기록
+    // -------------------------------------------------------------------------
+
+    struct Options {
+        int durationMs = 500;
+        bool json = false;
+        const char* outPath = "bench_output.txt";
+        const char* filter = nullptr;
+        const char* tracePath = nullptr;
+    };
+
+    struct Result {
+        const char* target;
+        int producers;
+        bool pinned;
+        double seconds;
+        uint64_t produced;
+        uint64_t consumed;
+        LatencyHistogram* enqueue;
+        LatencyHistogram* e2e;
+    };
+
+    class Reporter {
+    public:
+        Reporter(const Options& opt) : _opt(opt), _out(fopen(opt.outPath, "w")), _rows(0) {
+            printf("%-24s %3s %12s %12s %9s %8s %8s %8s %8s %8s %8s\n", "target", "P", "prod ops/s", "cons ops/s",
+                   "dropped", "enq p50", "enq p99", "enq p999", "e2e p50", "e2e p99", "e2e p999");
+            printf("-----------------------------------------------------------------------------------------------"
+                   "---------------------\n");
+            if (!_out) fprintf(stderr, "warning: cannot open %s, file output disabled\n", opt.outPath);
+            else if (_opt.json) fprintf(_out, "[\n");
+            else fprintf(_out, "target,producers,pinned,seconds,produced,consumed,dropped,produce_ops_s,consume_ops_s,"
+                               "enq_p50_ns,enq_p99_ns,enq_p999_ns,enq_max_ns,e2e_p50_ns,e2e_p99_ns,e2e_p999_ns,e2e_max_ns\n");
+        }
+        ~Reporter() {
+            if (!_out) return;
+            if (_opt.json) fprintf(_out, "\n]\n");
+            fclose(_out);
+        }
+
+        void write(const Result& r) {
+            const uint64_t dropped = r.produced > r.consumed ? r.produced - r.consumed : 0;
+            const double prodRate = (double)r.produced / r.seconds;
+            const double consRate = (double)r.consumed / r.seconds;
+            const LatencyHistogram& q = *r.enqueue;
+            const LatencyHistogram& e = *r.e2e;
+            printf("%-24s %3d %12.0f %12.0f %9llu %8llu %8llu %8llu %8llu %8llu %8llu\n", r.target, r.producers,
+                   prodRate, consRate, (unsigned long long)dropped, (unsigned long long)q.percentile(0.50),
+                   (unsigned long long)q.percentile(0.99), (unsigned long long)q.percentile(0.999),
+                   (unsigned long long)e.percentile(0.50), (unsigned long long)e.percentile(0.99),
+                   (unsigned long long)e.percentile(0.999));
+            fflush(stdout);
+            if (!_out) return;
+
+            if (_opt.json) {
+                fprintf(_out, "%s  {\"target\": \"%s\", \"producers\": %d, \"pinned\": %s, \"seconds\": %.3f, "
+                              "\"produced\": %llu, \"consumed\": %llu, \"dropped\": %llu, "
+                              "\"produce_ops_s\": %.0f, \"consume_ops_s\": %.0f,\n"
+                              "   \"enqueue_ns\": {\"p50\": %llu, \"p99\": %llu, \"p999\": %llu, \"max\": %llu},\n"
+                              "   \"e2e_ns\": {\"p50\": %llu, \"p99\": %llu, \"p999\": %llu, \"max\": %llu}}",
+                        _rows ? ",\n" : "", r.target, r.producers, r.pinned ? "true" : "false", r.seconds,
+                        (unsigned long long)r.produced, (unsigned long long)r.consumed, (unsigned long long)dropped,
+                        prodRate, consRate,
+                        (unsigned long long)q.percentile(0.50), (unsigned long long)q.percentile(0.99),
+                        (unsigned long long)q.percentile(0.999), (unsigned long long)q.max(),
+                        (unsigned long long)e.percentile(0.50), (unsigned long long)e.percentile(0.99),
+                        (unsigned long long)e.percentile(0.999), (unsigned long long)e.max());
+            } else {
+                fprintf(_out, "%s,%d,%d,%.3f,%llu,%llu,%llu,%.0f,%.0f,%llu,%llu,%llu,%llu,%llu,%llu,%llu,%llu\n",
+                        r.target, r.producers, r.pinned ? 1 : 0, r.seconds,
+                        (unsigned long long)r.produced, (unsigned long long)r.consumed, (unsigned long long)dropped,
+                        prodRate, consRate,
+                        (unsigned long long)q.percentile(0.50), (unsigned long long)q.percentile(0.99),
+                        (unsigned long long)q.percentile(0.999), (unsigned long long)q.max(),
+                        (unsigned long long)e.percentile(0.50), (unsigned long long)e.percentile(0.99),
+                        (unsigned long long)e.percentile(0.999), (unsigned long long)e.max());
+            }
+            _rows++;
+        }
+
+        bool accepts(const char* target) const { return !_opt.filter || strstr(target, _opt.filter); }
+
+    private:
+        const Options& _opt;
+        FILE* _out;
+        int _rows;
+    };
+
+    // -------------------------------------------------------------------------
+    // 실행기
+    // -------------------------------------------------------------------------
+
+    /// 생산자 N개 + 소비자 1개 구성을 실행하고 스레드별 히스토그램을 합쳐 보고합니다.
+    ///
+    /// @param produce 생산자 한 번의 작업: (producer, seq) → 호출 (타임스탬프는 호출 직전에 찍어 넘김)
+    /// @param consume 소비자 한 번의 작업: 항목 하나를 처리했으면 true (e2e 기록은 consume이 수행)
+    template<typename Produce, typename Consume>
+    void runConfig(Reporter& report, const Options& opt, const char* target, int producers,
+                   Produce&& produce, Consume&& consume) {
+        for (ThreadSlot& s : g_slots) {
+            s.enqueue.reset();
+            s.e2e.reset();
+            s.ops = 0;
+        }
+
+        std::atomic<bool> start{false};
+        std::atomic<int> running{producers};
+        bool pinned = true;
+
+        std::thread consumer([&] {
+            while (!start.load(std::memory_order_acquire)) {}
+            ThreadSlot& slot = g_slots[0];
+            for (;;) {
+                if (consume(slot)) {
+                    slot.ops++;
+                } else if (running.load(std::memory_order_acquire) == 0) {
+                    // 모든 생산자가 끝난 뒤 한 번 더 비어 있음을 확인하고 종료합니다.
+                    if (!consume(slot)) break;
+                    slot.ops++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        pinned &= pinToCpu(consumer, 0);
+
+        std::vector<std::thread> threads;
+        threads.reserve((size_t)producers);
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                ThreadSlot& slot = g_slots[p + 1];
+                while (!start.load(std::memory_order_acquire)) {}
+                const uint64_t deadline = nowNs() + (uint64_t)opt.durationMs * 1000000ULL;
+                uint32_t seq = 0;
+                for (;;) {
+                    const uint64_t t0 = nowNs();
+                    if (t0 >= deadline) break;
+                    produce((uint32_t)p, seq++, t0);
+                    slot.enqueue.record(nowNs() - t0);
+                    slot.ops++;
+                }
+                running.fetch_sub(1, std::memory_order_release);
+            });
+            pinned &= pinToCpu(threads.back(), p + 1);
+        }
+
+        const uint64_t t0 = nowNs();
+        start.store(true, std::memory_order_release);
+        for (std::thread& t : threads) t.join();
+        consumer.join();
+        const double seconds = (double)(nowNs() - t0) / 1e9;
+
+        static LatencyHistogram enqueue, e2e;
+        enqueue.reset();
+        e2e.reset();
+        uint64_t produced = 0;
+        for (int p = 1; p <= producers; ++p) {
+            enqueue.merge(g_slots[p].enqueue);
+            produced += g_slots[p].ops;
+        }
+        e2e.merge(g_slots[0].e2e);
+
+        report.write(Result{target, producers, pinned, seconds, produced, g_slots[0].ops, &enqueue, &e2e});
+    }
+
+    /// 큐 타입 하나를 모든 생산자 수 구성으로 측정합니다.
+    template<typename QueueT, typename Item>
+    void runQueueBench(Reporter& report, const Options& opt, const char* target) {
+        if (!report.accepts(target)) return;
+        for (int producers : kProducerCounts) {
+            static QueueT queue;
+            Item scratch;
+            while (queue.pop(scratch)) {}
+
+            runConfig(report, opt, target, producers,
+                [&](uint32_t producer, uint32_t seq, uint64_t stamp) {
+                    Item item;
+                    encodeItem(item, stamp, producer, seq);
+                    queue.enqueue(item);
+                },
+                [&](ThreadSlot& slot) {
+                    Item item;
+                    if (!queue.pop(item)) return false;
+                    slot.e2e.record(nowNs() - decodeItem(item));
+                    return true;
+                });
+        }
+    }
+
+    /// 출력 장치 대신 메시지 속 타임스탬프로 e2e 지연을 기록하는 로거입니다.
+    class BenchLogger : public cms::AsyncLogger<256, 16> {
+    public:
+        LatencyHistogram* e2e = nullptr;
+
+    protected:
+        void outputLog(const cms::StringBase& msg) override {
+            const char* t = strstr(msg.c_str(), "t=");
+            if (t && e2e) e2e->record(nowNs() - strtoull(t + 2, nullptr, 10));
+        }
+    };
+
+    /// AsyncLogger::i() 호출부터 update()가 출력할 때까지를 측정합니다.
+    void runLoggerBench(Reporter& report, const Options& opt, const char* target) {
+        if (!report.accepts(target)) return;
+        static BenchLogger logger;
+        logger.begin(cms::LogLevel::Debug, false);
+
+        for (int producers : kProducerCounts) {
+            logger.e2e = nullptr;
+            while (logger.update()) {}
+            logger.e2e = &g_slots[0].e2e;
+
+            runConfig(report, opt, target, producers,
+                [&](uint32_t producer, uint32_t seq, uint64_t stamp) {
+                    logger.i("bench t=%llu producer=%u seq=%u [Sensor] temp=%d", (unsigned long long)stamp,
+                             (unsigned)producer, (unsigned)seq, 23);
+                },
+                [&](ThreadSlot&) { return logger.update(); });
+        }
+    }
+
+    void parseArgs(int argc, char** argv, Options& opt) {
+        for (int i = 1; i < argc; ++i) {
+            if (strcmp(argv[i], "--quick") == 0) opt.durationMs = 100;
+            else if (strncmp(argv[i], "--ms=", 5) == 0) opt.durationMs = atoi(argv[i] + 5);
+            else if (strcmp(argv[i], "--format=json") == 0) opt.json = true;
+            else if (strcmp(argv[i], "--format=csv") == 0) opt.json = false;
+            else if (strncmp(argv[i], "--out=", 6) == 0) opt.outPath = argv[i] + 6;
+            else if (strncmp(argv[i], "--trace=", 8) == 0) opt.tracePath = argv[i] + 8;
+            else opt.filter = argv[i];
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    parseArgs(argc, argv, opt);
+    Reporter report(opt);
+
+    // 큐 변형 목록: 새 변형은 여기에 한 줄씩 추가합니다.
+    runQueueBench<cms::ThreadSafeQueue<Sample, 64>, Sample>(report, opt, "tsq<Sample,64>");
+    runQueueBench<cms::ThreadSafeQueue<Sample, 1024>, Sample>(report, opt, "tsq<Sample,1024>");
+    runQueueBench<cms::ThreadSafeQueue<cms::String<256>, 16>, cms::String<256>>(report, opt, "tsq<String<256>,16>");
+
+    runLoggerBench(report, opt, "AsyncLogger<256,16>::i");
+
+    if (opt.tracePath) {
+#ifdef CMS_ENABLE_TRACE
+        // 링은 먼저 기록한 CMS_TRACE_MAX_THREADS개 스레드에 배정되므로, 필터로 구성 하나만 실행하는 것이 읽기 쉽습니다.
+        if (!cms::trace::dumpChromeJson(opt.tracePath)) fprintf(stderr, "warning: cannot write %s\n", opt.tracePath);
+#else
+        fprintf(stderr, "warning: --trace requires building with -DCMS_ENABLE_TRACE\n");
+#endif
+    }
+    return 0;
+}
+
+#endif // CMS_BENCH_QUEUE
@@ -0,0 +1,286 @@
+#define CMS_BENCH_STRING     1
+
+#ifdef CMS_BENCH_STRING
+
+/// @author comser.dev
+///
+/// cms::string 커널의 호스트 마이크로벤치마크입니다. 릴리스 전에 성능 회귀를 잡기 위해 사용합니다.
+///
+/// 빌드: g++ -std=gnu++17 -O2 -Isrc bench/bench_cmsString.cpp src/*.cpp -o bench_cmsString -lpthread
+/// 실행: ./bench_cmsString [--quick] [--out=bench_output.txt] [필터]
+///
+/// How: 연산 하나를 배치(batch)로 묶어 배치 하나가 약 1ms가 되도록 반복 횟수를 보정한 뒤, 배치를 여러 번 측정하여
+///      최솟값/중앙값/MAD(중앙 절대 편차)를 구합니다. 중앙값과 MAD는 스케줄러 간섭 같은 이상치에 흔들리지 않습니다.
+///      사람이 읽는 표는 stdout으로, 같은 결과의 CSV는 --out 파일(기본 bench_output.txt)로 출력합니다.
+///      필터를 주면 "연산/입력" 이름에 필터 문자열이 포함된 항목만 실행합니다. (예: utf8, /korean)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "../src/cmsString.h"
+
+namespace {
+    volatile size_t g_sink = 0; ///< 최적화로 연산이 제거되지 않도록 결과를 흘려보내는 곳
+
+    constexpr size_t MAX_LEN = 64 * 1024;
+    const size_t kSizes[] = {16, 256, 4096, MAX_LEN};
+
+    /// 입력 종류별 반복 패턴 (구분자 ' ', ','와 다중 바이트 문자를 섞음)
+    struct InputKind {
+        const char* name;
+        const char* pattern;
+    };
+    const InputKind kInputs[] = {
+        {"ascii",  "The quick brown fox, jumps over 42 lazy dogs. "},
+        {"korean", "안녕하세요 세계, 임베디드 문자열 처리기 "},
+        {"mixed",  "Temp 온도=23.5C, 습도 45% 상태 OK; "},
+    };
+
+    struct Options {
+        int samples = 21;                 ///< 배치 측정 횟수
+        double batchNs = 1e6;             ///< 배치 하나의 목표 시간
+        const char* outPath = "bench_output.txt";
+        const char* filter = nullptr;
+    };
+
+    struct Stats {
+        size_t iterations; ///< 배치당 반복 횟수
+        double minNs;      ///< 연산당 최솟값
+        double medianNs;   ///< 연산당 중앙값
+        double madNs;      ///< 중앙 절대 편차
+    };
+
+    double median(std::vector<double>& v) {
+        std::sort(v.begin(), v.end());
+        const size_t n = v.size();
+        return (n % 2) ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2.0;
+    }
+
+    template<typename Fn>
+    double timeBatch(Fn& fn, size_t iterations) {
+        const auto t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) fn();
+        const auto t1 = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(t1 - t0).count();
+    }
+
+    /// 반복 횟수를 보정한 뒤 배치를 samples번 측정합니다.
+    template<typename Fn>
+    Stats measure(Fn& fn, const Options& opt) {
+        size_t iterations = 1;
+        for (;;) {
+            const double ns = timeBatch(fn, iterations);
+            if (ns >= opt.batchNs || iterations >= ((size_t)1 << 30)) break;
+            // 한 번에 2~16배로만 늘려, 타이머 해상도보다 짧은 첫 측정이 과대 보정으로 이어지지 않도록 합니다.
+            const double scale = ns > 0 ? opt.batchNs / ns : 16.0;
+            iterations = (size_t)((double)iterations * (scale < 2.0 ? 2.0 : (scale > 16.0 ? 16.0 : scale)));
+        }
+
+        std::vector<double> perOp;
+        perOp.reserve((size_t)opt.samples);
+        for (int s = 0; s < opt.samples; ++s) perOp.push_back(timeBatch(fn, iterations) / (double)iterations);
+
+        Stats st;
+        st.iterations = iterations;
+        st.minNs = *std::min_element(perOp.begin(), perOp.end());
+        st.medianNs = median(perOp);
+        std::vector<double> dev;
+        dev.reserve(perOp.size());
+        for (double v : perOp) dev.push_back(v > st.medianNs ? v - st.medianNs : st.medianNs - v);
+        st.madNs = median(dev);
+        return st;
+    }
+
+    /// 결과 한 행을 표와 CSV로 기록합니다.
+    class Reporter {
+    public:
+        Reporter(const Options& opt) : _opt(opt), _csv(fopen(opt.outPath, "w")) {
+            printf("%-16s %-8s %7s %12s %12s %8s %10s\n", "operation", "input", "bytes", "median ns", "min ns", "mad %", "MB/s");
+            printf("--------------------------------------------------------------------------------\n");
+            if (_csv) fprintf(_csv, "op,input,bytes,iterations,samples,ns_min,ns_median,ns_mad,mb_per_s\n");
+            else fprintf(stderr, "warning: cannot open %s, CSV output disabled\n", opt.outPath);
+        }
+        ~Reporter() {
+            if (_csv) fclose(_csv);
+        }
+
+        /// 필터와 일치하면 fn을 측정하여 기록합니다.
+        ///
+        /// @param bytes 연산 하나가 처리하는 입력 바이트 수 (처리량 계산용)
+        template<typename Fn>
+        void run(const char* op, const char* input, size_t bytes, Fn&& fn) {
+            char name[64];
+            snprintf(name, sizeof(name), "%s/%s", op, input);
+            if (_opt.filter && !strstr(name, _opt.filter)) return;
+
+            const Stats st = measure(fn, _opt);
+            const double mbps = st.medianNs > 0 ? (double)bytes / st.medianNs * 1e3 : 0.0;
+            const double madPct = st.medianNs > 0 ? st.madNs / st.medianNs * 100.0 : 0.0;
+            printf("%-16s %-8s %7zu %12.1f %12.1f %8.2f %10.1f\n", op, input, bytes, st.medianNs, st.minNs, madPct, mbps);
+            if (_csv) {
+                fprintf(_csv, "%s,%s,%zu,%zu,%d,%.2f,%.2f,%.2f,%.1f\n", op, input, bytes, st.iterations, _opt.samples,
+                        st.minNs, st.medianNs, st.madNs, mbps);
+            }
+            fflush(stdout);
+        }
+
+    private:
+        const Options& _opt;
+        FILE* _csv;
+    };
+
+    /// 패턴을 반복하여 정확히 len 바이트의 유효한 UTF-8 입력을 만듭니다. (끝에서 잘린 글자는 공백으로 대체)
+    void fillInput(char* buf, size_t len, const char* pattern) {
+        const size_t plen = strlen(pattern);
+        for (size_t i = 0; i < len; ++i) buf[i] = pattern[i % plen];
+        buf[len] = '\0';
+        size_t lead = len;
+        while (lead > 0 && ((uint8_t)buf[lead - 1] & 0xC0) == 0x80) --lead;
+        if (lead > 0 && (uint8_t)buf[lead - 1] >= 0xC0) {
+            const uint8_t c = (uint8_t)buf[lead - 1];
+            const size_t need = c >= 0xF0 ? 4 : (c >= 0xE0 ? 3 : 2);
+            if (lead - 1 + need > len) memset(buf + lead - 1, ' ', len - (lead - 1));
+        }
+    }
+
+    /// 입력의 3/4 지점 글자 경계에 치환 대상 "<#>"를 심습니다. (덮어써서 잘린 글자 조각은 공백으로 대체)
+    void plantMarker(char* buf, size_t len) {
+        size_t pos = len * 3 / 4;
+        if (pos + 3 > len) pos = len - 3;
+        while (pos > 0 && ((uint8_t)buf[pos] & 0xC0) == 0x80) --pos;
+        memcpy(buf + pos, "<#>", 3);
+        for (size_t i = pos + 3; i < len && ((uint8_t)buf[i] & 0xC0) == 0x80; ++i) buf[i] = ' ';
+    }
+
+    void parseArgs(int argc, char** argv, Options& opt) {
+        for (int i = 1; i < argc; ++i) {
+            if (strcmp(argv[i], "--quick") == 0) {
+                opt.samples = 5;
+                opt.batchNs = 2e5;
+            } else if (strncmp(argv[i], "--out=", 6) == 0) {
+                opt.outPath = argv[i] + 6;
+            } else {
+                opt.filter = argv[i];
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    parseArgs(argc, argv, opt);
+    Reporter report(opt);
+
+    static char src[MAX_LEN + 1];
+    static char work[MAX_LEN + 1];
+    static cms::string::Token tokens[MAX_LEN / 2 + 1];
+
+    // -------------------------------------------------------------------------
+    // 입력 크기에 비례하는 커널 (입력 종류 × 크기)
+    // -------------------------------------------------------------------------
+    for (const InputKind& kind : kInputs) {
+        for (size_t len : kSizes) {
+            fillInput(src, len, kind.pattern);
+            plantMarker(src, len);
+
+            // 없는 패턴 검색은 본문 전체를 훑는 최악의 경우입니다.
+            report.run("find(miss)", kind.name, len, [&] {
+                g_sink = g_sink + (size_t)cms::string::find(src, len, "XYZ!", 4, 0, false);
+            });
+            report.run("find(icase)", kind.name, len, [&] {
+                g_sink = g_sink + (size_t)cms::string::find(src, len, "<#>", 3, 0, true);
+            });
+            report.run("contains", kind.name, len, [&] {
+                g_sink = g_sink + cms::string::contains(src, len, "<#>", 3, false);
+            });
+
+            // 같은 길이의 두 패턴을 번갈아 치환하므로 매 호출이 정확히 한 번 치환하고 입력 복원이 필요 없습니다.
+            memcpy(work, src, len + 1);
+            bool planted = true;
+            report.run("replace", kind.name, len, [&] {
+                g_sink = g_sink + cms::string::replace(work, sizeof(work), len, planted ? "<#>" : "[#]", planted ? "[#]" : "<#>");
+                planted = !planted;
+            });
+
+            report.run("split", kind.name, len, [&] {
+                g_sink = g_sink + cms::string::split(src, len, ' ', tokens, sizeof(tokens) / sizeof(tokens[0]));
+            });
+            report.run("utf8_strlen", kind.name, len, [&] {
+                g_sink = g_sink + cms::string::utf8_strlen(src, len);
+            });
+            report.run("validateUtf8", kind.name, len, [&] {
+                g_sink = g_sink + cms::string::validateUtf8(src, len);
+            });
+
+            // 유효한 입력은 바뀌지 않으므로 반복 사이에 복원하지 않습니다.
+            memcpy(work, src, len + 1);
+            report.run("sanitizeUtf8", kind.name, len, [&] {
+                g_sink = g_sink + cms::string::sanitizeUtf8(work, sizeof(work));
+            });
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // 숫자 포맷/파싱 (입력 크기와 무관, bytes는 출력 또는 입력 문자열 길이)
+    // -------------------------------------------------------------------------
+    cms::String<64> out;
+
+    out.clear();
+    out.appendPrintf("id=%d t=%s v=%u", -12345, "sensor", 678u);
+    report.run("appendPrintf", "mixed", out.length(), [&] {
+        out.clear();
+        out.appendPrintf("id=%d t=%s v=%u", -12345, "sensor", 678u);
+        g_sink = g_sink + out.length();
+    });
+
+    const long long ints[] = {7, -12345, 2147483647LL, -9223372036854775807LL};
+    for (long long v : ints) {
+        out.clear();
+        out.appendInt(v);
+        report.run("appendInt", "int", out.length(), [&] {
+            out.clear();
+            out.appendInt(v);
+            g_sink = g_sink + out.length();
+        });
+    }
+
+    const double floats[] = {0.1, 23.456, -1234567.875, 6.02214076e23};
+    for (double v : floats) {
+        out.clear();
+        out.appendFloat(v, cms::string::FloatFormat::Shortest);
+        report.run("appendFloat", "shortest", out.length(), [&] {
+            out.clear();
+            out.appendFloat(v, cms::string::FloatFormat::Shortest);
+            g_sink = g_sink + out.length();
+        });
+        out.clear();
+        out.appendFloat(v, cms::string::FloatFormat::Fixed, 3);
+        report.run("appendFloat", "fixed3", out.length(), [&] {
+            out.clear();
+            out.appendFloat(v, cms::string::FloatFormat::Fixed, 3);
+            g_sink = g_sink + out.length();
+        });
+    }
+
+    const char* intTexts[] = {"7", "-12345", "2147483647"};
+    for (const char* text : intTexts) {
+        const size_t len = strlen(text);
+        report.run("toInt", "int", len, [&] {
+            g_sink = g_sink + (size_t)cms::string::toInt(text, len);
+        });
+    }
+
+    const char* floatTexts[] = {"0.1", "23.456", "-1234567.875", "6.02214076e23"};
+    for (const char* text : floatTexts) {
+        const size_t len = strlen(text);
+        report.run("toFloat", "float", len, [&] {
+            g_sink = g_sink + (size_t)cms::string::toFloat(text, len);
+        });
+    }
+
+    return 0;
+}
+
+#endif // CMS_BENCH_STRING
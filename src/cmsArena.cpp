@@ -0,0 +1,43 @@
+/// @author comser.dev
+///
+/// ArenaBase 할당 로직 구현부입니다.
+
+#include "cmsArena.h"
+
+namespace cms {
+
+    /// [allocate] 범프 할당 상세 구현
+    ///
+    /// 1) 현재 주소를 align 경계까지 올리는 패딩 계산
+    /// 2) 패딩 + 요청 크기가 남은 공간을 넘으면 실패 처리
+    /// 3) 오프셋 이동 및 최대 사용량 갱신
+    void* ArenaBase::allocate(size_t bytes, size_t align) noexcept {
+        if (align == 0 || (align & (align - 1)) != 0) align = alignof(max_align_t);
+
+        const uintptr_t addr = (uintptr_t)(_buf + _used);
+        const size_t pad = (size_t)((align - (addr & (align - 1))) & (align - 1));
+
+        if (pad > _capacity - _used || bytes > _capacity - _used - pad) {
+            _failures++;
+            return nullptr;
+        }
+
+        uint8_t* p = _buf + _used + pad;
+        _used += pad + bytes;
+        if (_used > _peak) _peak = _used;
+        return p;
+    }
+
+    /// [allocateText] 문자열 버퍼 할당 상세 구현
+    ArenaBase::Block ArenaBase::allocateText(size_t capacity) noexcept {
+        if (capacity > 0) {
+            void* p = allocate(capacity, 1);
+            if (p) return Block{static_cast<char*>(p), capacity};
+        } else {
+            _failures++;
+        }
+        _overflow = '\0';
+        return Block{&_overflow, 1};
+    }
+
+} // namespace cms
@@ -0,0 +1,171 @@
+/// @author comser.dev
+///
+/// 고정 크기 정적 버퍼 위에서 동작하는 범프(Bump) 할당기 정의서입니다.
+/// 루프 한 바퀴 동안만 필요한 임시 문자열을 스택 대신 태스크별 스크래치 영역에서 꺼내 쓰고,
+/// 마커(Marker) 되감기로 한 번에 반납합니다.
+
+#pragma once
+
+#include <stddef.h> // size_t, max_align_t
+#include <cstdint>  // uint8_t, uint16_t
+#include "cmsStringRef.h"
+
+namespace cms {
+
+// ==================================================================================================
+// [Arena] 개요
+// - 왜 존재하는가: vlog()나 operator+처럼 임시 String<N>을 만드는 함수는 호출 경로마다 최악의 경우만큼
+//                  스택을 요구하므로 모든 태스크 스택이 가장 큰 임시 버퍼 기준으로 커졌습니다.
+// - 어떻게 동작하는가: 정적 버퍼의 사용 오프셋(_used)만 앞으로 밀어 할당하고, mark()로 저장한 오프셋으로
+//                      rewind()하면 그 이후 할당이 한꺼번에 해제됩니다. (개별 해제 없음, O(1))
+// ==================================================================================================
+
+    /// 아레나의 공통 로직을 담당하는 베이스 클래스입니다.
+    ///
+    /// Why: 크기(Bytes)마다 할당 코드가 중복 생성되는 것을 막기 위함입니다. (Thin Template)
+    /// How: 자식 클래스(Arena<Bytes>)가 주입한 버퍼 포인터와 용량만으로 동작합니다.
+    ///
+    /// @note 스레드 안전하지 않습니다. 태스크마다 별도의 아레나를 사용하세요.
+    class ArenaBase {
+    public:
+        /// 되감기 위치를 나타내는 값입니다. (할당 오프셋)
+        using Marker = size_t;
+
+        /// 할당된 문자 버퍼와 실제 크기입니다.
+        struct Block {
+            char* ptr;   ///< 버퍼 시작 (nullptr 아님)
+            size_t size; ///< 사용 가능한 바이트 수 (널 종료 문자 포함)
+        };
+
+        /// [RAII] 생성 시점의 마커를 기억했다가 소멸 시 자동으로 되감습니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// void loop() {
+        ///     cms::ArenaBase::Scope scope(scratch);   // 루프가 끝나면 이번 바퀴의 할당이 모두 반납됨
+        ///     cms::ArenaString line(scratch, 512);
+        ///     line << "t=" << millis();
+        /// }
+        /// @endcode
+        class Scope {
+        public:
+            explicit Scope(ArenaBase& arena) noexcept : _arena(arena), _mark(arena.mark()) {}
+            ~Scope() { _arena.rewind(_mark); }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            ArenaBase& _arena;
+            Marker _mark;
+        };
+
+        /// [allocate] 정렬된 메모리 블록을 할당합니다.
+        ///
+        /// @param bytes 요청 바이트 수
+        /// @param align 정렬 단위 (2의 거듭제곱, 기본 max_align_t)
+        /// @return 블록 시작 포인터 (공간이 부족하면 nullptr, failures() 증가)
+        void* allocate(size_t bytes, size_t align = alignof(max_align_t)) noexcept;
+
+        /// [allocateText] 문자열용 버퍼를 할당합니다. (정렬 1, 실패해도 nullptr을 반환하지 않음)
+        ///
+        /// Why: 문자열 생성자는 항상 유효한 버퍼를 요구하므로, 공간이 부족할 때도 사용할 수 있는 대체 버퍼가 필요합니다.
+        /// How: 실패 시 아레나 내부의 1바이트 버퍼(항상 빈 문자열)를 반환하여 이후 추가가 모두 잘리도록 합니다.
+        ///
+        /// @param capacity 요청 바이트 수 (널 종료 문자 포함)
+        Block allocateText(size_t capacity) noexcept;
+
+        /// 현재 할당 위치를 반환합니다. (rewind()에 전달)
+        Marker mark() const noexcept { return _used; }
+
+        /// [rewind] 마커 이후에 할당된 모든 블록을 해제합니다.
+        ///
+        /// @param marker mark()로 얻은 위치 (현재 위치보다 뒤면 무시)
+        /// @note 해제된 블록을 가리키는 ArenaString 등은 더 이상 사용할 수 없습니다.
+        void rewind(Marker marker) noexcept { if (marker < _used) _used = marker; }
+
+        /// 모든 할당을 해제합니다.
+        void reset() noexcept { _used = 0; }
+
+        /// 버퍼 전체 크기를 반환합니다.
+        size_t capacity() const noexcept { return _capacity; }
+        /// 현재 사용 중인 바이트 수를 반환합니다. (정렬 패딩 포함)
+        size_t used() const noexcept { return _used; }
+        /// 남은 바이트 수를 반환합니다.
+        size_t remaining() const noexcept { return _capacity - _used; }
+        /// 생성 이후 최대 사용량(High Water Mark)을 반환합니다. (아레나 크기 튜닝용)
+        size_t peak() const noexcept { return _peak; }
+        /// 공간 부족으로 실패한 할당 횟수를 반환합니다.
+        size_t failures() const noexcept { return _failures; }
+
+    protected:
+        /// 자식 클래스에서 버퍼를 주입받아 초기화합니다.
+        ArenaBase(uint8_t* buffer, size_t capacity) noexcept
+            : _buf(buffer), _capacity(capacity), _used(0), _peak(0), _failures(0), _overflow('\0') {}
+
+        /// 같은 버퍼를 가리키는 사본이 생기지 않도록 복사를 금지합니다.
+        ArenaBase(const ArenaBase&) = delete;
+        ArenaBase& operator=(const ArenaBase&) = delete;
+
+    private:
+        uint8_t* _buf;     ///< 자식 클래스가 주입한 버퍼
+        size_t _capacity;  ///< 버퍼 전체 크기
+        size_t _used;      ///< 다음 할당 오프셋
+        size_t _peak;      ///< 최대 사용량
+        size_t _failures;  ///< 실패한 할당 횟수
+        char _overflow;    ///< allocateText() 실패 시 반환하는 1바이트 대체 버퍼
+    };
+
+    /// 고정 크기 정적 버퍼를 소유하는 아레나입니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// static cms::Arena<2048> scratch;           // 태스크별 스크래치 영역
+    ///
+    /// cms::ArenaBase::Marker m = scratch.mark();
+    /// cms::ArenaString body(scratch, 1500);      // 스택이 아닌 아레나에서 할당
+    /// ...
+    /// scratch.rewind(m);
+    /// @endcode
+    ///
+    /// @tparam Bytes 버퍼 크기 (바이트)
+    template<size_t Bytes>
+    class Arena : public ArenaBase {
+        static_assert(Bytes > 0, "Arena size must be greater than 0");
+
+    public:
+        Arena() noexcept : ArenaBase(_storage, Bytes) {}
+
+    private:
+        alignas(max_align_t) uint8_t _storage[Bytes]; ///< 실제 데이터 저장소
+    };
+
+    /// 아레나에서 버퍼를 할당받는 문자열입니다.
+    ///
+    /// Why: 임시 문자열의 크기를 스택이 아닌 아레나 크기로 제한하기 위함입니다.
+    /// How: 생성 시 allocateText()로 버퍼를 받아 StringRef로 감쌉니다. 소멸 시 해제하지 않으며 rewind()/Scope로 일괄 반납합니다.
+    ///
+    /// @tparam SizeT 길이 저장 타입 (기본 uint16_t로 StringBase&를 받는 API에 그대로 전달 가능)
+    /// @note 아레나 공간이 부족하면 빈 문자열(용량 1)이 되어 모든 추가가 잘립니다. (ArenaBase::failures()로 확인)
+    template<typename SizeT = uint16_t>
+    class BasicArenaString : public BasicStringRef<SizeT> {
+        using Base = BasicStringRef<SizeT>;
+
+    public:
+        /// 아레나에서 capacity 바이트를 할당받아 빈 문자열로 초기화합니다.
+        ///
+        /// @param arena 버퍼를 제공할 아레나
+        /// @param capacity 버퍼 크기 (널 종료 문자 포함, SizeT 최대값으로 제한)
+        BasicArenaString(ArenaBase& arena, size_t capacity)
+            : BasicArenaString(arena.allocateText(capacity < (size_t)(SizeT)~(SizeT)0 ? capacity : (size_t)(SizeT)~(SizeT)0)) {}
+
+        using Base::operator=;
+
+    private:
+        explicit BasicArenaString(ArenaBase::Block block) : Base(block.ptr, block.size) {}
+    };
+
+    /// uint16_t 길이를 사용하는 기본 아레나 문자열입니다.
+    using ArenaString = BasicArenaString<uint16_t>;
+
+} // namespace cms
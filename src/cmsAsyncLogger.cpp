@@ -9,6 +9,8 @@
 #include <Arduino.h>
 #endif
 #include "cmsAsyncLogger.h"
+#include "cmsCString.h"
+#include "cmsTrace.h"
 
 // ANSI 이스케이프 시퀀스 정의
 #define ANSI_ESC        "\033["
@@ -21,11 +23,21 @@
 #define ANSI_COLOR_RED  ANSI_ESC "31m"
 
 namespace {
-    // 강조 키워드 정의
-    struct Keyword { const char* name; size_t len; };
-    static constexpr Keyword KEYWORDS[] = { {"ERROR", 5}, {"CRITICAL", 8}, {"FATAL", 5}, {"FAIL", 4} };
+    // 강조 키워드 정의 (길이는 컴파일 타임에 계산)
+    static constexpr cms::StringView KEYWORDS[] = { "ERROR", "CRITICAL", "FATAL", "FAIL" };
     static constexpr size_t KEYWORD_COUNT = sizeof(KEYWORDS) / sizeof(KEYWORDS[0]);
-    static const char* TAG_COLORS[] = { "92", "93", "94", "95", "96", "32", "33", "35", "36" };
+
+    /// SGR 코드로 완성된 ANSI 시퀀스를 만듭니다. (예: 92 → "\033[92m")
+    constexpr cms::CString<8> ansiSequence(int code) {
+        cms::CString<8> seq(ANSI_ESC);
+        seq.appendInt(code).append('m');
+        return seq;
+    }
+    // 태그 색상 시퀀스 테이블: 컴파일 타임에 조립되어 출력 시 한 번의 append로 기록됩니다.
+    static constexpr cms::CString<8> TAG_STYLES[] = {
+        ansiSequence(92), ansiSequence(93), ansiSequence(94), ansiSequence(95), ansiSequence(96),
+        ansiSequence(32), ansiSequence(33), ansiSequence(35), ansiSequence(36)
+    };
 }
 
 namespace cms {
@@ -71,6 +83,7 @@ namespace cms {
     /// 4) [태그] 및 키워드 스타일링 적용
     void LoggerBase::logV(cms::StringBase& out, cms::StringBase& tmp, LogLevel level, const char* format, va_list args) {
         if (level < _runtimeLevel || !format) return;
+        CMS_TRACE("logV");
         out.clear();
 
         if (_timeSynced) {
@@ -105,19 +118,16 @@ namespace cms {
     /// 대괄호로 감싸진 [TAG]를 찾아 DJB2 해시를 기반으로 고유 색상을 입힙니다.
     /// 태그가 아닌 일반 텍스트는 키워드 강조 로직으로 전달합니다.
     void LoggerBase::applyStyling(cms::StringBase& out, const char* rawMsg, LogLevel level) {
+        CMS_TRACE("applyStyling");
         const char* p = rawMsg;
         const char* startBracket;
         while ((startBracket = strchr(p, '[')) != nullptr) {
             appendWithKeywords(out, p, startBracket - p);
             const char* endBracket = strchr(startBracket, ']');
             if (endBracket && (endBracket > startBracket + 1)) {
-                unsigned int hash = 5381;
-                for (const char* h = startBracket + 1; h < endBracket; h++) {
-                    char c = (*h >= 'a' && *h <= 'z') ? (*h - 'a' + 'A') : *h;
-                    hash = ((hash << 5) + hash) + (unsigned char)c;
-                }
-                const char* color = TAG_COLORS[hash % (sizeof(TAG_COLORS) / sizeof(TAG_COLORS[0]))];
-                out << ANSI_ESC << color << "m";
+                // 대소문자를 접은 DJB2: 플랫폼과 관계없이 같은 태그는 항상 같은 색상
+                const uint32_t hash = cms::string::djb2(startBracket + 1, endBracket - startBracket - 1, true);
+                out << TAG_STYLES[hash % (sizeof(TAG_STYLES) / sizeof(TAG_STYLES[0]))];
                 out.append(startBracket, (endBracket - startBracket) + 1);
                 out << ANSI_RESET;
                 p = endBracket + 1;
@@ -140,16 +150,16 @@ namespace cms {
         while (p < end) {
             int matchIdx = -1;
             for (size_t i = 0; i < KEYWORD_COUNT; ++i) {
-                if (p + KEYWORDS[i].len <= end && cms::string::startsWith(p, KEYWORDS[i].name, KEYWORDS[i].len, true)) {
+                if (p + KEYWORDS[i].length() <= end && cms::string::startsWith(p, KEYWORDS[i].data(), KEYWORDS[i].length(), true)) {
                     matchIdx = (int)i;
                     break;
                 }
             }
             if (matchIdx != -1) {
                 out << ANSI_BOLD_RED;
-                out.append(p, KEYWORDS[matchIdx].len);
+                out.append(p, KEYWORDS[matchIdx].length());
                 out << ANSI_RESET;
-                p += KEYWORDS[matchIdx].len;
+                p += KEYWORDS[matchIdx].length();
             } else {
                 char c = *p++;
                 out.append(&c, 1);
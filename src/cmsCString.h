@@ -0,0 +1,193 @@
+/// @author comser.dev
+///
+/// 컴파일 타임에 조립할 수 있는 고정 크기 문자열(CString) 정의서입니다.
+/// 결합, 정수 포맷, 대소문자 변환이 모두 constexpr이므로 이름 테이블과 ANSI 시퀀스를 플래시 상수로 만들 수 있습니다.
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <cstdint>  // uint8_t
+#include "cmsStringView.h"
+
+namespace cms {
+
+// ==================================================================================================
+// [CString] 개요
+// - 왜 존재하는가: String<N>은 리터럴로 생성할 수 있지만 연산이 constexpr이 아니어서, 색상 코드나 토픽 접두사처럼
+//                  내용이 빌드 시점에 정해지는 문자열도 부팅 시 RAM에서 조립하거나 출력할 때마다 조각을 이어 붙였습니다.
+// - 어떻게 동작하는가: 버퍼와 길이만 가진 리터럴 타입으로, 모든 연산을 상수 식에서 평가할 수 있게 작성했습니다.
+//                      static constexpr로 선언하면 결과가 완성된 채로 플래시에 놓이며, StringView로 변환되어
+//                      StringBase의 <<, append, equals 등에 그대로 전달됩니다.
+// ==================================================================================================
+
+    /// 컴파일 타임 조립이 가능한 고정 크기 문자열입니다.
+    ///
+    /// Why: 빌드 시점에 내용이 정해지는 문자열 조립 비용(부팅 시 초기화, 출력마다 조각 결합)을 없애기 위함입니다.
+    /// How: 모든 멤버 함수가 constexpr이며, 용량을 넘는 내용은 StringBase와 같은 규칙으로 잘리고 isTruncated()에 기록됩니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// static constexpr auto kPrefix = cms::CString("sensor/") + "temp";           // CString<11>
+    /// static constexpr auto kWarn = cms::CString<8>("\033[").appendInt(33).append('m');
+    /// static_assert(!kWarn.isTruncated(), "too small");
+    ///
+    /// out << kWarn << "hot" << kPrefix;                                          // StringBase에 그대로 결합
+    /// @endcode
+    ///
+    /// @tparam N 최대 바이트 수 (널 종료 문자 제외)
+    /// @note UTF-8을 해석하지 않으며, 대소문자 변환은 ASCII 영문자만 바꿉니다.
+    template<size_t N>
+    class CString {
+    public:
+        /// 빈 문자열을 생성합니다.
+        constexpr CString() noexcept : _buf{}, _len(0), _truncated(false) {}
+
+        /// 리터럴로 생성합니다. (CString("abc")는 CString<3>으로 추론)
+        template<size_t M>
+        constexpr CString(const char (&str)[M]) noexcept : _buf{}, _len(0), _truncated(false) {
+            append(StringView(str));
+        }
+
+        /// StringView(다른 CString 포함)의 내용으로 생성합니다.
+        constexpr explicit CString(StringView view) noexcept : _buf{}, _len(0), _truncated(false) { append(view); }
+
+        /// 바이트 길이를 반환합니다.
+        constexpr size_t length() const noexcept { return _len; }
+        /// 최대 바이트 수를 반환합니다.
+        constexpr size_t capacity() const noexcept { return N; }
+        /// 비어있는지 확인합니다.
+        constexpr bool isEmpty() const noexcept { return _len == 0; }
+        /// 용량 부족으로 내용이 잘린 적이 있는지 확인합니다. (static_assert용)
+        constexpr bool isTruncated() const noexcept { return _truncated; }
+        /// 널 종료 문자열을 반환합니다.
+        constexpr const char* c_str() const noexcept { return _buf; }
+        /// 내용 포인터를 반환합니다.
+        constexpr const char* data() const noexcept { return _buf; }
+        /// index번째 바이트를 반환합니다.
+        constexpr char operator[](size_t index) const noexcept { return _buf[index]; }
+
+        /// 내용을 가리키는 StringView를 반환합니다.
+        constexpr StringView view() const noexcept { return StringView(_buf, _len); }
+        /// StringView로 변환합니다. (StringBase의 StringView 오버로드에 그대로 전달)
+        constexpr operator StringView() const noexcept { return view(); }
+
+        /// 내용 일치 여부를 확인합니다.
+        constexpr bool equals(StringView other) const noexcept {
+            if (other.length() != _len) return false;
+            for (size_t i = 0; i < _len; ++i) {
+                if (_buf[i] != other[i]) return false;
+            }
+            return true;
+        }
+
+        /// [append] 바이트를 덧붙입니다. (남은 용량만큼만 복사하고 나머지는 잘림)
+        constexpr CString& append(const char* s, size_t len) noexcept {
+            for (size_t i = 0; i < len; ++i) {
+                if (_len >= N) {
+                    _truncated = true;
+                    break;
+                }
+                _buf[_len++] = s[i];
+            }
+            _buf[_len] = '\0';
+            return *this;
+        }
+        constexpr CString& append(StringView view) noexcept { return append(view.data(), view.length()); }
+        constexpr CString& append(char c) noexcept { return append(&c, 1); }
+
+        /// [appendInt] 부호 있는 10진 정수를 덧붙입니다.
+        ///
+        /// @param width 최소 출력 너비 (부족하면 padChar로 왼쪽 채움)
+        /// @note 런타임 appendInt와 같이, 숫자 전체가 들어가지 않으면 아무것도 쓰지 않고 잘림으로 기록합니다.
+        constexpr CString& appendInt(long long value, int width = 0, char padChar = ' ') noexcept {
+            const bool negative = value < 0;
+            // LLONG_MIN도 안전하도록 부호 없는 정수로 절댓값을 구합니다.
+            const unsigned long long magnitude = negative ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+            return appendDigits(magnitude, 10, negative, width, padChar, false);
+        }
+
+        /// [appendUInt] 부호 없는 10진 정수를 덧붙입니다.
+        constexpr CString& appendUInt(unsigned long long value, int width = 0, char padChar = ' ') noexcept {
+            return appendDigits(value, 10, false, width, padChar, false);
+        }
+
+        /// [appendHex] 16진수를 덧붙입니다. (접두사 없음, 최소 digits자리까지 '0'으로 채움)
+        constexpr CString& appendHex(unsigned long long value, int digits = 0, bool upperCase = true) noexcept {
+            return appendDigits(value, 16, false, digits, '0', upperCase);
+        }
+
+        /// [toUpperCase] ASCII 영문자를 대문자로 바꿉니다.
+        constexpr CString& toUpperCase() noexcept {
+            for (size_t i = 0; i < _len; ++i) {
+                if (_buf[i] >= 'a' && _buf[i] <= 'z') _buf[i] = (char)(_buf[i] - 'a' + 'A');
+            }
+            return *this;
+        }
+
+        /// [toLowerCase] ASCII 영문자를 소문자로 바꿉니다.
+        constexpr CString& toLowerCase() noexcept {
+            for (size_t i = 0; i < _len; ++i) {
+                if (_buf[i] >= 'A' && _buf[i] <= 'Z') _buf[i] = (char)(_buf[i] - 'A' + 'a');
+            }
+            return *this;
+        }
+
+        /// 두 CString을 이어 붙인 새 CString을 만듭니다. (용량은 두 용량의 합)
+        template<size_t M>
+        constexpr CString<N + M> operator+(const CString<M>& rhs) const noexcept {
+            CString<N + M> out;
+            out.append(_buf, _len).append(rhs._buf, rhs._len);
+            return out;
+        }
+        template<size_t M>
+        constexpr CString<N + M - 1> operator+(const char (&rhs)[M]) const noexcept {
+            CString<N + M - 1> out;
+            out.append(_buf, _len).append(StringView(rhs));
+            return out;
+        }
+        template<size_t M>
+        friend constexpr CString<M - 1 + N> operator+(const char (&lhs)[M], const CString& rhs) noexcept {
+            CString<M - 1 + N> out(lhs);
+            out.append(rhs._buf, rhs._len);
+            return out;
+        }
+
+    private:
+        template<size_t> friend class CString;
+
+        /// 숫자를 뒤에서부터 임시 버퍼에 만든 뒤, 너비 채움과 함께 한 번에 덧붙입니다.
+        constexpr CString& appendDigits(unsigned long long value, unsigned base, bool negative, int width,
+                                        char padChar, bool upperCase) noexcept {
+            char tmp[24] = {};
+            size_t n = 0;
+            do {
+                const unsigned d = (unsigned)(value % base);
+                tmp[n++] = (char)(d < 10 ? '0' + d : (upperCase ? 'A' : 'a') + d - 10);
+                value /= base;
+            } while (value);
+
+            const size_t body = n + (negative ? 1 : 0);
+            const size_t pad = width > 0 && (size_t)width > body ? (size_t)width - body : 0;
+            if (_len + pad + body > N) {
+                _truncated = true;
+                return *this;
+            }
+            // '0' 채움은 부호 뒤에, 공백 채움은 부호 앞에 둡니다. (printf와 동일)
+            if (negative && padChar == '0') _buf[_len++] = '-';
+            for (size_t i = 0; i < pad; ++i) _buf[_len++] = padChar;
+            if (negative && padChar != '0') _buf[_len++] = '-';
+            while (n > 0) _buf[_len++] = tmp[--n];
+            _buf[_len] = '\0';
+            return *this;
+        }
+
+        char _buf[N + 1];   ///< 내용 + 널 종료
+        size_t _len;        ///< 바이트 길이
+        bool _truncated;    ///< 잘림 발생 여부
+    };
+
+    /// 리터럴에서 용량을 추론합니다. (CString("abc") → CString<3>)
+    template<size_t M>
+    CString(const char (&)[M]) -> CString<M - 1>;
+
+} // namespace cms
@@ -0,0 +1,225 @@
+/// @author comser.dev
+///
+/// 스트리밍 CSV 파서 구현부입니다.
+/// 필드 본문 탐색은 findAnyOf(구분자, '\n', '\r')와 memchr(따옴표)에 위임하여
+/// 바이트 단위 분기 없이 한 번에 여러 바이트를 건너뜁니다.
+
+#include <cstring>          // memcpy, memchr
+#include "cmsCsvParser.h"   // CsvParserBase 정의
+
+namespace cms {
+
+    using cms::string::Token;
+
+    /// 내부 생성자입니다. 자식 클래스에서 캐리 버퍼를 주입받습니다.
+    CsvParserBase::CsvParserBase(char* carry, size_t carryCapacity)
+        : _carry(carry), _carryCapacity(carryCapacity) {}
+
+    /// 파서 상태와 통계를 초기화합니다. (구분자/따옴표 설정은 유지)
+    void CsvParserBase::reset() noexcept {
+        _carryLen = 0;
+        _fieldStart = nullptr;
+        _fieldEnd = nullptr;
+        _column = 0;
+        _records = 0;
+        _truncated = 0;
+        _state = State::FieldStart;
+        _inCarry = false;
+        _fieldTruncated = false;
+        _skipLF = false;
+    }
+
+    /// 캐리 버퍼 끝에 데이터를 덧붙입니다.
+    ///
+    /// Why: 버퍼 용량을 넘는 필드가 들어와도 파싱을 멈추지 않기 위함입니다.
+    /// How: 남은 공간만큼만 복사하고, 필드가 잘렸음을 기록해 두었다가 emitField에서 집계합니다.
+    void CsvParserBase::carryAppend(const char* src, size_t len) {
+        size_t room = _carryCapacity - _carryLen;
+        if (len > room) {
+            len = room;
+            _fieldTruncated = true;
+        }
+        if (len > 0) {
+            memcpy(_carry + _carryLen, src, len);
+            _carryLen += len;
+        }
+    }
+
+    /// 완성된 필드를 onField로 전달하고 필드 상태를 정리합니다.
+    void CsvParserBase::emitField(const char* ptr, size_t len) {
+        if (_fieldTruncated) _truncated++;
+        onField(Token{ptr, len}, _column);
+
+        _carryLen = 0;
+        _inCarry = false;
+        _fieldTruncated = false;
+        _fieldStart = nullptr;
+        _fieldEnd = nullptr;
+    }
+
+    /// 구분자 또는 개행을 처리합니다.
+    void CsvParserBase::terminate(char c) {
+        _state = State::FieldStart;
+        if (c == _delimiter) {
+            _column++;
+            return;
+        }
+        // '\n' 또는 '\r': 레코드 종료. '\r' 직후의 '\n'은 다음 청크에 있어도 건너뜁니다.
+        _records++;
+        onRecordEnd(_column + 1);
+        _column = 0;
+        _skipLF = (c == '\r');
+    }
+
+    /// 청크가 끝날 때 진행 중인 필드를 캐리 버퍼로 옮깁니다.
+    ///
+    /// Why: feed() 반환 후 호출자가 청크 메모리를 재사용하므로, 원본을 가리키는 포인터를 남기면 안 됩니다.
+    /// How: 아직 캐리 버퍼를 쓰지 않던 필드만 [필드 시작, 끝) 구간을 복사합니다.
+    ///      (이미 캐리 중인 필드는 feed() 본문에서 이어붙였습니다.)
+    void CsvParserBase::spillToCarry(const char* end) {
+        if (_inCarry) return;
+        switch (_state) {
+            case State::Unquoted:
+            case State::Quoted:
+                carryAppend(_fieldStart, (size_t)(end - _fieldStart));
+                break;
+            case State::QuoteSeen:
+                carryAppend(_fieldStart, (size_t)(_fieldEnd - _fieldStart));
+                break;
+            default:
+                return; // 진행 중인 필드 없음
+        }
+        _inCarry = true;
+    }
+
+    /// 입력 청크를 파싱합니다.
+    ///
+    /// How: 상태별로 다음 관심 바이트까지 한 번에 건너뜁니다.
+    ///      - 일반 필드/따옴표 이후: findAnyOf(구분자, '\n', '\r')
+    ///      - 따옴표 필드 본문: memchr(따옴표)
+    ///      필드가 청크 안에서 끝나고 이스케이프가 없으면 원본 포인터를 그대로 전달합니다.
+    void CsvParserBase::feed(const char* chunk, size_t len) {
+        if (!chunk || len == 0) return;
+
+        const char* p = chunk;
+        const char* end = chunk + len;
+        const char set[3] = {_delimiter, '\n', '\r'};
+
+        while (p < end) {
+            switch (_state) {
+                case State::FieldStart: {
+                    char c = *p;
+                    if (_skipLF) {
+                        _skipLF = false;
+                        if (c == '\n') { p++; break; }
+                    }
+                    // 레코드 첫 위치의 개행은 빈 줄이므로 레코드로 취급하지 않습니다.
+                    if (_column == 0 && (c == '\n' || c == '\r')) {
+                        _skipLF = (c == '\r');
+                        p++;
+                        break;
+                    }
+                    if (_quote && c == _quote) {
+                        _state = State::Quoted;
+                        _fieldStart = ++p;
+                    } else {
+                        _state = State::Unquoted;
+                        _fieldStart = p;
+                    }
+                    break;
+                }
+
+                case State::Unquoted: {
+                    const char* q = cms::string::findAnyOf(p, (size_t)(end - p), set, 3);
+                    if (!q) {
+                        if (_inCarry) carryAppend(p, (size_t)(end - p));
+                        p = end;
+                        break;
+                    }
+                    if (_inCarry) {
+                        carryAppend(p, (size_t)(q - p));
+                        emitField(_carry, _carryLen);
+                    } else {
+                        emitField(_fieldStart, (size_t)(q - _fieldStart));
+                    }
+                    terminate(*q);
+                    p = q + 1;
+                    break;
+                }
+
+                case State::Quoted: {
+                    const char* q = (const char*)memchr(p, _quote, (size_t)(end - p));
+                    if (!q) {
+                        if (_inCarry) carryAppend(p, (size_t)(end - p));
+                        p = end;
+                        break;
+                    }
+                    if (_inCarry) carryAppend(p, (size_t)(q - p));
+                    else _fieldEnd = q;
+                    _state = State::QuoteSeen;
+                    p = q + 1;
+                    break;
+                }
+
+                case State::QuoteSeen: {
+                    if (*p == _quote) {
+                        // "" 이스케이프: 원본과 내용이 달라지므로 이 시점부터 캐리 버퍼로 복사합니다.
+                        if (!_inCarry) {
+                            carryAppend(_fieldStart, (size_t)(_fieldEnd - _fieldStart));
+                            _inCarry = true;
+                        }
+                        carryAppend(p, 1);
+                        _state = State::Quoted;
+                        p++;
+                        break;
+                    }
+                    // 닫는 따옴표였습니다. 필드를 내보내고 현재 바이트는 AfterQuoted에서 처리합니다.
+                    if (_inCarry) emitField(_carry, _carryLen);
+                    else emitField(_fieldStart, (size_t)(_fieldEnd - _fieldStart));
+                    _state = State::AfterQuoted;
+                    break;
+                }
+
+                case State::AfterQuoted: {
+                    // 닫는 따옴표와 구분자 사이의 문자는 버립니다. (예: "abc"xyz,)
+                    const char* q = cms::string::findAnyOf(p, (size_t)(end - p), set, 3);
+                    if (!q) {
+                        p = end;
+                        break;
+                    }
+                    terminate(*q);
+                    p = q + 1;
+                    break;
+                }
+            }
+        }
+
+        spillToCarry(end);
+    }
+
+    /// 입력 종료를 알리고, 개행 없이 끝난 마지막 레코드를 내보냅니다.
+    ///
+    /// @note 닫히지 않은 따옴표 필드는 그때까지 모인 내용으로 내보냅니다.
+    void CsvParserBase::finish() {
+        switch (_state) {
+            case State::FieldStart:
+                _skipLF = false;
+                if (_column == 0) return;     // 진행 중인 레코드 없음
+                emitField(_carry, 0);         // "a,b," 처럼 구분자로 끝난 경우의 빈 마지막 필드
+                break;
+            case State::Unquoted:
+            case State::Quoted:
+            case State::QuoteSeen:
+                emitField(_carry, _carryLen); // feed()가 항상 캐리 버퍼로 옮겨 두었습니다.
+                break;
+            case State::AfterQuoted:
+                break;                        // 필드는 이미 전달됨
+        }
+
+        _records++;
+        onRecordEnd(_column + 1);
+        _column = 0;
+        _state = State::FieldStart;
+    }
+
+} // namespace cms
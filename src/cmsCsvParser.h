@@ -0,0 +1,143 @@
+/// @author comser.dev
+///
+/// 임의 크기의 청크 단위로 입력을 받는 스트리밍 CSV 파서 정의서입니다.
+/// 필드가 청크 안에 온전히 있으면 원본을 가리키는 Token을 그대로 전달하고(Zero-Copy),
+/// 청크 경계를 넘는 필드만 작은 캐리(Carry) 버퍼에 모아 전달합니다.
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <cstdint>  // uint8_t
+#include "cmsStringUtil.h"
+
+namespace cms {
+
+// ==================================================================================================
+// [CsvParserBase] 개요
+// - 왜 존재하는가: 수 MB 크기의 CSV 로그를 한 줄 전체를 담는 버퍼(MAX_SAFE_SIZE) 없이 처리하기 위해 존재합니다.
+// - 어떻게 동작하는가: 상태 기계가 청크 사이에서 필드/따옴표 상태를 유지하며, 구분자 탐색은 findAnyOf(SIMD)에 위임합니다.
+// ==================================================================================================
+
+    /// 캐리 버퍼 크기에 의존하지 않는 CSV 파싱 공통 로직입니다.
+    ///
+    /// Why: 버퍼 크기별로 파서 로직이 중복 생성되는 것을 막기 위함입니다. (Thin Template)
+    /// How: 자식 클래스가 주입한 캐리 버퍼를 사용하며, 파싱 결과는 가상 함수 onField/onRecordEnd로 전달합니다.
+    ///
+    /// @note RFC 4180 방식의 "" 이중 따옴표 이스케이프를 지원하며, 빈 줄은 레코드로 취급하지 않습니다.
+    class CsvParserBase {
+    public:
+        /// [feed] 입력 청크를 파싱합니다.
+        ///
+        /// 청크는 레코드/필드 경계와 무관하게 임의의 위치에서 잘려도 됩니다.
+        /// 이 함수가 반환된 뒤에는 청크 메모리를 재사용해도 안전합니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// while ((n = file.read(buf, sizeof(buf))) > 0) parser.feed(buf, n);
+        /// parser.finish();
+        /// @endcode
+        ///
+        /// @param chunk 입력 데이터 (NUL 종료 불필요)
+        /// @param len 입력 바이트 길이
+        void feed(const char* chunk, size_t len);
+
+        /// [finish] 입력 종료를 알리고, 개행 없이 끝난 마지막 레코드를 내보냅니다.
+        void finish();
+
+        /// [reset] 파서 상태와 통계를 초기화합니다.
+        void reset() noexcept;
+
+        /// [setDelimiter] 필드 구분자를 변경합니다. (기본값: ',')
+        void setDelimiter(char delimiter) noexcept { _delimiter = delimiter; }
+
+        /// [setQuote] 따옴표 문자를 변경합니다. ('\0'이면 따옴표 처리 비활성)
+        void setQuote(char quote) noexcept { _quote = quote; }
+
+        /// 지금까지 완성된 레코드 수를 반환합니다.
+        size_t recordCount() const noexcept { return _records; }
+
+        /// 캐리 버퍼 용량 부족으로 잘린 필드 수를 반환합니다.
+        size_t truncatedFields() const noexcept { return _truncated; }
+
+    protected:
+        /// 내부 생성자입니다. 자식 클래스에서 캐리 버퍼를 주입받습니다.
+        CsvParserBase(char* carry, size_t carryCapacity);
+        virtual ~CsvParserBase() = default;
+
+        /// [onField] 완성된 필드를 전달받습니다. (순수 가상 함수)
+        ///
+        /// @param field 필드 내용 (따옴표 제외, 이스케이프 해제됨). 콜백 반환 후에는 무효입니다.
+        /// @param column 레코드 내 0부터 시작하는 필드 번호
+        virtual void onField(const cms::string::Token& field, size_t column) = 0;
+
+        /// [onRecordEnd] 레코드 하나가 끝났음을 알립니다.
+        ///
+        /// @param fieldCount 해당 레코드의 필드 수
+        virtual void onRecordEnd(size_t fieldCount) { (void)fieldCount; }
+
+    private:
+        /// 파서 상태 기계의 상태.
+        enum class State : uint8_t {
+            FieldStart,   ///< 새 필드 시작 전
+            Unquoted,     ///< 따옴표 없는 필드 본문
+            Quoted,       ///< 따옴표 필드 본문
+            QuoteSeen,    ///< 따옴표 필드에서 따옴표를 만남 (닫힘 또는 "" 판단 대기)
+            AfterQuoted   ///< 닫는 따옴표 이후 다음 구분자까지
+        };
+
+        char* const _carry;               ///< 청크 경계를 넘는 필드를 모으는 버퍼
+        const size_t _carryCapacity;      ///< 캐리 버퍼 용량
+        size_t _carryLen = 0;             ///< 캐리 버퍼에 쌓인 바이트 수
+        const char* _fieldStart = nullptr;///< 현재 청크 안에서의 필드 시작 위치 (캐리 미사용 시)
+        const char* _fieldEnd = nullptr;  ///< 따옴표 필드의 본문 끝 위치 (캐리 미사용 시)
+        size_t _column = 0;               ///< 현재 레코드의 필드 번호
+        size_t _records = 0;              ///< 완성된 레코드 수
+        size_t _truncated = 0;            ///< 잘린 필드 수
+        State _state = State::FieldStart; ///< 현재 상태
+        bool _inCarry = false;            ///< 현재 필드가 캐리 버퍼에 있는지 여부
+        bool _fieldTruncated = false;     ///< 현재 필드가 잘렸는지 여부
+        bool _skipLF = false;             ///< 직전 문자가 '\r'이었는지 여부 (\r\n 처리)
+        char _delimiter = ',';            ///< 필드 구분자
+        char _quote = '"';                ///< 따옴표 문자
+
+        /// 캐리 버퍼 끝에 데이터를 덧붙입니다. (용량 초과분은 잘림으로 기록)
+        void carryAppend(const char* src, size_t len);
+        /// 완성된 필드를 onField로 전달하고 필드 상태를 정리합니다.
+        void emitField(const char* ptr, size_t len);
+        /// 구분자 또는 개행을 처리합니다.
+        void terminate(char c);
+        /// 청크가 끝날 때 진행 중인 필드를 캐리 버퍼로 옮깁니다.
+        void spillToCarry(const char* end);
+    };
+
+// ==================================================================================================
+// [CsvParser] 개요
+// - 왜 존재하는가: 캐리 버퍼를 정적 배열로 소유하여 힙 없이 파서를 선언하기 위해 존재합니다.
+// - 어떻게 동작하는가: CARRY 크기의 배열을 CsvParserBase에 주입하며, 사용자는 onField를 재정의합니다.
+// ==================================================================================================
+
+    /// 고정 크기 캐리 버퍼를 소유하는 스트리밍 CSV 파서입니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// class SensorCsv : public cms::CsvParser<128> {
+    /// protected:
+    ///     void onField(const cms::string::Token& f, size_t col) override { if (col == 2) sum += f.toFloat(); }
+    /// };
+    /// @endcode
+    ///
+    /// @tparam CARRY 청크 경계를 넘는 필드 하나의 최대 바이트 크기
+    template <size_t CARRY = 128>
+    class CsvParser : public CsvParserBase {
+    public:
+        static_assert(CARRY > 0, "cms::CsvParser carry buffer must be at least 1 byte.");
+
+    protected:
+        CsvParser() : CsvParserBase(_carryData, CARRY) {}
+
+    private:
+        /// 청크 경계를 넘는 필드를 보관하는 정적 버퍼.
+        char _carryData[CARRY];
+    };
+
+} // namespace cms
@@ -0,0 +1,148 @@
+/// @author comser.dev
+///
+/// FlatMapBase 그룹 탐사 구현부입니다.
+
+#include "cmsFlatMap.h"
+#include <cstring> // memset
+
+// 호스트/고성능 코어에서만 SIMD 그룹 비교를 사용합니다. (MCU는 스칼라 경로 사용)
+#if defined(__SSE2__)
+#include <emmintrin.h> // _mm_cmpeq_epi8, _mm_movemask_epi8
+#define CMS_SIMD_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>  // vceqq_u8, vpadd_u8
+#define CMS_SIMD_NEON 1
+#endif
+
+namespace cms {
+
+    namespace {
+        constexpr uint8_t CTRL_EMPTY = 0x80;
+        constexpr uint8_t CTRL_DELETED = 0xFE;
+
+        /// 16바이트 그룹에서 b와 같은 바이트 위치를 비트마스크로 반환합니다.
+        inline uint32_t matchByte(const uint8_t* g, uint8_t b) noexcept {
+#if defined(CMS_SIMD_SSE2)
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(g));
+            return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8((char)b)));
+#elif defined(CMS_SIMD_NEON)
+            // movemask가 없으므로 레인별 비트 가중치를 곱한 뒤 8레인씩 수평 합산합니다.
+            static const uint8_t kBits[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+            const uint8x16_t m = vandq_u8(vceqq_u8(vld1q_u8(g), vdupq_n_u8(b)), vld1q_u8(kBits));
+            uint8x8_t lo = vget_low_u8(m), hi = vget_high_u8(m);
+            lo = vpadd_u8(lo, lo); lo = vpadd_u8(lo, lo); lo = vpadd_u8(lo, lo);
+            hi = vpadd_u8(hi, hi); hi = vpadd_u8(hi, hi); hi = vpadd_u8(hi, hi);
+            return (uint32_t)vget_lane_u8(lo, 0) | ((uint32_t)vget_lane_u8(hi, 0) << 8);
+#else
+            uint32_t mask = 0;
+            for (uint32_t i = 0; i < 16; ++i) mask |= (uint32_t)(g[i] == b) << i;
+            return mask;
+#endif
+        }
+
+        /// 16바이트 그룹에서 빈 칸 또는 삭제 표시(최상위 비트 1) 위치를 비트마스크로 반환합니다.
+        inline uint32_t matchFree(const uint8_t* g) noexcept {
+#if defined(CMS_SIMD_SSE2)
+            return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(g)));
+#else
+            uint32_t mask = 0;
+            for (uint32_t i = 0; i < 16; ++i) mask |= (uint32_t)(g[i] >> 7) << i;
+            return mask;
+#endif
+        }
+
+        /// 최하위 1비트의 위치를 반환합니다. (mask != 0)
+        inline uint32_t lowestBit(uint32_t mask) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return (uint32_t)__builtin_ctz(mask);
+#else
+            uint32_t i = 0;
+            while (!(mask & 1u)) { mask >>= 1; ++i; }
+            return i;
+#endif
+        }
+    } // namespace
+
+    FlatMapBase::FlatMapBase(uint8_t* ctrl, size_t slotCount, size_t maxSize) noexcept
+        : _ctrl(ctrl), _mask(slotCount - 1), _maxSize(maxSize), _size(0) {
+#ifdef CMS_ENABLE_PROFILING
+        _stats = ProbeStats{0, 0, 0, 0};
+#endif
+        resetSlots();
+    }
+
+    void FlatMapBase::resetSlots() noexcept {
+        memset(_ctrl, CTRL_EMPTY, _mask + 1 + GROUP);
+        _size = 0;
+    }
+
+    void FlatMapBase::setCtrl(size_t slot, uint8_t value) noexcept {
+        _ctrl[slot] = value;
+        // 테이블 끝에서 시작하는 그룹도 16바이트를 한 번에 읽을 수 있도록 앞부분을 뒤에 복제합니다.
+        if (slot < GROUP) _ctrl[_mask + 1 + slot] = value;
+    }
+
+    /// [findSlot] 그룹 단위 탐사
+    ///
+    /// 1) h1(해시 상위 비트)으로 시작 위치를 정하고 16개 메타데이터를 한 번에 h2와 비교
+    /// 2) 일치한 슬롯만 실제 키 비교
+    /// 3) 그룹에 빈 칸이 있으면 더 뒤에 있을 수 없으므로 종료, 없으면 다음 그룹으로 이동
+    size_t FlatMapBase::findSlot(uint32_t hash, SlotEquals eq, const void* self, const void* key) const noexcept {
+        const uint8_t h2 = (uint8_t)(hash & 0x7F);
+        size_t pos = (size_t)(hash >> 7) & _mask;
+        const size_t maxGroups = (_mask + 1) / GROUP;
+#ifdef CMS_ENABLE_PROFILING
+        _stats.lookups++;
+        size_t groups = 0;
+#endif
+        size_t found = NPOS;
+        for (size_t g = 0; g < maxGroups; ++g) {
+#ifdef CMS_ENABLE_PROFILING
+            groups++;
+#endif
+            const uint8_t* group = _ctrl + pos;
+            uint32_t m = matchByte(group, h2);
+            while (m) {
+                const size_t slot = (pos + lowestBit(m)) & _mask;
+#ifdef CMS_ENABLE_PROFILING
+                _stats.keyCompares++;
+#endif
+                if (eq(self, slot, key)) {
+                    found = slot;
+                    break;
+                }
+                m &= m - 1;
+            }
+            if (found != NPOS || matchByte(group, CTRL_EMPTY)) break;
+            pos = (pos + GROUP) & _mask;
+        }
+#ifdef CMS_ENABLE_PROFILING
+        _stats.groups += (uint32_t)groups;
+        if (groups > _stats.maxGroups) _stats.maxGroups = (uint16_t)groups;
+#endif
+        return found;
+    }
+
+    /// [claimSlot] 탐사 순서에서 처음 만나는 빈 칸/삭제 슬롯을 차지합니다.
+    size_t FlatMapBase::claimSlot(uint32_t hash) noexcept {
+        if (_size >= _maxSize) return NPOS;
+        size_t pos = (size_t)(hash >> 7) & _mask;
+        for (;;) {
+            const uint32_t m = matchFree(_ctrl + pos);
+            if (m) {
+                const size_t slot = (pos + lowestBit(m)) & _mask;
+                setCtrl(slot, (uint8_t)(hash & 0x7F));
+                _size++;
+                return slot;
+            }
+            // 적재율이 7/8 이하이므로 빈 슬롯이 반드시 존재합니다.
+            pos = (pos + GROUP) & _mask;
+        }
+    }
+
+    void FlatMapBase::eraseSlot(size_t slot) noexcept {
+        setCtrl(slot, CTRL_DELETED);
+        _size--;
+    }
+
+} // namespace cms
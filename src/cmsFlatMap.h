@@ -0,0 +1,242 @@
+/// @author comser.dev
+///
+/// 정적 저장소 위의 개방 주소법 해시 맵(FlatMap) 정의서입니다.
+/// 문자열 키를 Token, const char*, StringBase 어느 형태로든 키 객체를 만들지 않고 조회할 수 있습니다.
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <cstdint>  // uint8_t, uint32_t
+#include <type_traits>
+#include "cmsStringBase.h"
+#include "cmsStringView.h"
+
+namespace cms {
+
+// ==================================================================================================
+// [FlatMap] 개요
+// - 왜 존재하는가: 설정값과 라우팅 테이블을 배열에 두고 equals()로 순차 비교하면 조회마다 O(n)이 걸렸습니다.
+// - 어떻게 동작하는가: SwissTable 방식으로 해시를 상위(h1: 시작 위치)와 하위 7비트(h2: 태그)로 나누고,
+//                      슬롯마다 1바이트 메타데이터(빈 칸/삭제/h2)를 둡니다. 조회는 16바이트 메타데이터 그룹을
+//                      한 번에 h2와 비교(호스트 SIMD, MCU 스칼라)하여 태그가 맞는 슬롯의 키만 실제로 비교합니다.
+// ==================================================================================================
+
+    /// FlatMap의 탐사 로직을 담당하는 베이스 클래스입니다.
+    ///
+    /// Why: 키/값 타입과 크기마다 그룹 탐사 코드(SIMD 포함)가 중복 생성되는 것을 막기 위함입니다. (Thin Template)
+    /// How: 메타데이터 배열만 관리하고, 키 비교는 자식 클래스가 넘긴 함수 포인터로 위임합니다.
+    ///
+    /// @note 스레드 안전하지 않습니다.
+    class FlatMapBase {
+    public:
+        /// 저장된 항목 수를 반환합니다.
+        size_t size() const noexcept { return _size; }
+        /// 저장 가능한 최대 항목 수를 반환합니다. (템플릿 인자 N)
+        size_t maxSize() const noexcept { return _maxSize; }
+        /// 비어있는지 확인합니다.
+        bool isEmpty() const noexcept { return _size == 0; }
+        /// 가득 찼는지 확인합니다.
+        bool isFull() const noexcept { return _size >= _maxSize; }
+        /// 내부 슬롯 수를 반환합니다. (2의 거듭제곱, 적재율 7/8 이하)
+        size_t slotCount() const noexcept { return _mask + 1; }
+
+#ifdef CMS_ENABLE_PROFILING
+        /// 조회 시 탐사 길이 통계입니다. (테이블 크기/해시 품질 튜닝용)
+        struct ProbeStats {
+            uint32_t lookups;     ///< 조회/삽입 시도 횟수
+            uint32_t groups;      ///< 검사한 메타데이터 그룹 수 합계
+            uint32_t keyCompares; ///< h2가 일치하여 실제로 키를 비교한 횟수 합계
+            uint16_t maxGroups;   ///< 한 번의 조회에서 검사한 최대 그룹 수
+        };
+        /// 탐사 통계를 반환합니다.
+        const ProbeStats& probeStats() const noexcept { return _stats; }
+        /// 탐사 통계를 초기화합니다.
+        void resetProbeStats() noexcept { _stats = ProbeStats{0, 0, 0, 0}; }
+#endif
+
+    protected:
+        /// 메타데이터 그룹 크기 (SSE2/NEON 레지스터 하나)
+        static constexpr size_t GROUP = 16;
+        /// 찾지 못함을 나타내는 슬롯 번호
+        static constexpr size_t NPOS = (size_t)-1;
+        /// 키 비교 콜백 (self: 자식 맵, slot: 후보 슬롯, key: 조회 키)
+        using SlotEquals = bool (*)(const void* self, size_t slot, const void* key);
+
+        /// 자식 클래스에서 메타데이터 배열을 주입받아 초기화합니다.
+        ///
+        /// @param ctrl 메타데이터 배열 (slotCount + GROUP 바이트, 끝 GROUP 바이트는 앞부분의 복제본)
+        /// @param slotCount 슬롯 수 (2의 거듭제곱, GROUP 이상)
+        /// @param maxSize 최대 항목 수
+        FlatMapBase(uint8_t* ctrl, size_t slotCount, size_t maxSize) noexcept;
+
+        FlatMapBase(const FlatMapBase&) = delete;
+        FlatMapBase& operator=(const FlatMapBase&) = delete;
+
+        /// [findSlot] 키가 저장된 슬롯을 찾습니다.
+        /// @return 슬롯 번호 (없으면 NPOS)
+        size_t findSlot(uint32_t hash, SlotEquals eq, const void* self, const void* key) const noexcept;
+
+        /// [claimSlot] 새 항목을 위한 슬롯을 차지합니다. (findSlot으로 없음을 확인한 뒤 호출)
+        /// @return 슬롯 번호 (가득 찼으면 NPOS)
+        size_t claimSlot(uint32_t hash) noexcept;
+
+        /// [eraseSlot] 슬롯을 삭제 표시합니다. (이후 탐사가 끊기지 않도록 빈 칸이 아닌 삭제 표시를 남김)
+        void eraseSlot(size_t slot) noexcept;
+
+        /// 모든 슬롯을 빈 칸으로 되돌립니다.
+        void resetSlots() noexcept;
+
+        /// 슬롯에 항목이 들어 있는지 확인합니다.
+        bool isOccupied(size_t slot) const noexcept { return (_ctrl[slot] & 0x80) == 0; }
+
+    private:
+        /// 메타데이터를 기록합니다. (앞쪽 GROUP개는 끝의 복제본도 함께 갱신)
+        void setCtrl(size_t slot, uint8_t value) noexcept;
+
+        uint8_t* _ctrl;   ///< 슬롯별 메타데이터 (0x80: 빈 칸, 0xFE: 삭제, 0x00~0x7F: h2)
+        size_t _mask;     ///< slotCount - 1
+        size_t _maxSize;  ///< 최대 항목 수
+        size_t _size;     ///< 현재 항목 수
+#ifdef CMS_ENABLE_PROFILING
+        mutable ProbeStats _stats;
+#endif
+    };
+
+    /// 문자열 키를 사용하는 고정 크기 해시 맵입니다.
+    ///
+    /// Why: 설정/라우팅 조회를 O(1)로 만들면서도 힙을 사용하지 않기 위함입니다.
+    /// How: 키/값/메타데이터를 모두 객체 안의 배열에 두고, 조회 키는 StringView로 변환하여 해시/비교합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// cms::FlatMap<cms::String<16>, int, 32> cfg;
+    /// cfg.insert("baud", 115200);
+    ///
+    /// cms::string::Token key = ...;           // 수신 버퍼의 일부
+    /// if (int* v = cfg.find(key)) { ... }     // String 키를 만들지 않고 조회
+    ///
+    /// // 키가 상수 문자열이면 StringView를 키로 써서 복사를 없앨 수 있습니다.
+    /// cms::FlatMap<cms::StringView, void (*)(), 8> routes;
+    /// routes.insert("/status", handleStatus);
+    /// @endcode
+    ///
+    /// @tparam Key 키 타입 (String<N> 등 StringBase 파생 타입 또는 StringView, 기본 생성/대입 가능해야 함)
+    /// @tparam Value 값 타입 (기본 생성/대입 가능해야 함)
+    /// @tparam N 최대 항목 수
+    /// @note 내부 슬롯은 N * 8 / 7 이상인 2의 거듭제곱(최소 16)이므로 Key/Value 배열도 그 크기로 잡힙니다.
+    ///       삭제된 슬롯은 삽입 시 재사용되며, 삭제가 많이 누적되면 clear() 후 다시 채우는 것이 좋습니다.
+    template<typename Key, typename Value, size_t N>
+    class FlatMap : public FlatMapBase {
+        static_assert(N > 0, "FlatMap must hold at least one entry");
+        static_assert(std::is_base_of<StringBase, Key>::value || std::is_base_of<LargeStringBase, Key>::value ||
+                      std::is_same<Key, StringView>::value,
+                      "FlatMap key must be a cms string type (String<N>, StringView)");
+
+        /// 적재율 7/8 이하를 보장하는 2의 거듭제곱 슬롯 수 (최소 한 그룹)
+        static constexpr size_t slotsFor(size_t n) {
+            size_t s = GROUP;
+            while (s * 7 < n * 8) s <<= 1;
+            return s;
+        }
+        static constexpr size_t SLOTS = slotsFor(N);
+
+    public:
+        FlatMap() noexcept : FlatMapBase(_ctrl, SLOTS, N) {}
+
+        /// [find] 키에 해당하는 값을 찾습니다.
+        ///
+        /// @param key 조회 키 (const char*, Token, StringView, StringBase 파생 타입)
+        /// @return 값 포인터 (없으면 nullptr)
+        template<typename K>
+        Value* find(const K& key) noexcept {
+            const size_t slot = lookup(keyView(key));
+            return slot == NPOS ? nullptr : &_values[slot];
+        }
+        template<typename K>
+        const Value* find(const K& key) const noexcept {
+            const size_t slot = lookup(keyView(key));
+            return slot == NPOS ? nullptr : &_values[slot];
+        }
+
+        /// 키 존재 여부를 확인합니다.
+        template<typename K>
+        bool contains(const K& key) const noexcept { return lookup(keyView(key)) != NPOS; }
+
+        /// [insert] 키와 값을 저장합니다. (이미 있으면 값을 덮어씀)
+        ///
+        /// @return 저장된 값 포인터 (가득 찼거나 키가 Key 용량보다 길면 nullptr)
+        template<typename K>
+        Value* insert(const K& key, const Value& value) {
+            const StringView v = keyView(key);
+            const uint32_t h = v.hash();
+            size_t slot = findSlot(h, &slotEquals, this, &v);
+            if (slot == NPOS) {
+                slot = claimSlot(h);
+                if (slot == NPOS) return nullptr;
+                _keys[slot] = v;
+                if (keyView(_keys[slot]).length() != v.length()) {
+                    // 잘린 키로는 다시 찾을 수 없으므로 저장하지 않습니다.
+                    _keys[slot] = Key();
+                    eraseSlot(slot);
+                    return nullptr;
+                }
+            }
+            _values[slot] = value;
+            return &_values[slot];
+        }
+
+        /// [erase] 키를 삭제합니다.
+        /// @return true: 삭제함, false: 없음
+        template<typename K>
+        bool erase(const K& key) {
+            const size_t slot = lookup(keyView(key));
+            if (slot == NPOS) return false;
+            _keys[slot] = Key();
+            _values[slot] = Value();
+            eraseSlot(slot);
+            return true;
+        }
+
+        /// 모든 항목을 삭제합니다.
+        void clear() {
+            for (size_t i = 0; i < SLOTS; ++i) {
+                if (isOccupied(i)) {
+                    _keys[i] = Key();
+                    _values[i] = Value();
+                }
+            }
+            resetSlots();
+        }
+
+        /// [forEach] 모든 항목에 대해 fn(const Key&, Value&)를 호출합니다. (순서는 해시 순)
+        template<typename Fn>
+        void forEach(Fn&& fn) {
+            for (size_t i = 0; i < SLOTS; ++i) {
+                if (isOccupied(i)) fn(static_cast<const Key&>(_keys[i]), _values[i]);
+            }
+        }
+        template<typename Fn>
+        void forEach(Fn&& fn) const {
+            for (size_t i = 0; i < SLOTS; ++i) {
+                if (isOccupied(i)) fn(_keys[i], _values[i]);
+            }
+        }
+
+    private:
+        /// 조회 키를 StringView로 변환합니다. (const char*, Token은 StringView 생성자로 변환)
+        static StringView keyView(StringView v) noexcept { return v; }
+        template<typename SizeT>
+        static StringView keyView(const BasicStringBase<SizeT>& s) noexcept { return s.view(); }
+
+        static bool slotEquals(const void* self, size_t slot, const void* key) noexcept {
+            return keyView(static_cast<const FlatMap*>(self)->_keys[slot]).equals(*static_cast<const StringView*>(key));
+        }
+
+        size_t lookup(StringView v) const noexcept { return findSlot(v.hash(), &slotEquals, this, &v); }
+
+        Key _keys[SLOTS];              ///< 슬롯별 키
+        Value _values[SLOTS];          ///< 슬롯별 값
+        uint8_t _ctrl[SLOTS + GROUP];  ///< 슬롯별 메타데이터 (+ 그룹 경계 복제본)
+    };
+
+} // namespace cms
@@ -0,0 +1,342 @@
+/// @author comser.dev
+///
+/// 컴파일 타임에 해석되는 printf 스타일 포맷팅 프런트엔드 정의서입니다.
+/// 포맷 문자열을 컴파일 시점에 리터럴 구간과 타입이 정해진 변환 명령으로 분해하므로,
+/// 실행 시에는 파싱과 va_list 없이 append 커널 호출만 일렬로 남습니다.
+
+#pragma once
+
+#include <stddef.h>      // size_t
+#include <cstdint>       // uint16_t, uintptr_t
+#include <cstring>       // strlen
+#include <tuple>         // std::tuple, std::get
+#include <type_traits>   // std::is_integral 등 타입 검사
+#include <utility>       // std::index_sequence
+#include "cmsStringUtil.h"
+#include "cmsStringBase.h"
+
+namespace cms {
+
+// ==================================================================================================
+// [fmt] 개요
+// - 왜 존재하는가: appendPrintf는 호출마다 포맷 문자열을 다시 훑고(strchr, 너비/정밀도 숫자 루프)
+//   va_list로 인자를 꺼내며, 타입 검사는 CMS_PRINTF_CHECK 경고에만 의존합니다.
+// - 어떻게 동작하는가: constexpr 파서가 포맷을 Spec 배열로 컴파일하고, 인자마다 if constexpr로
+//   알맞은 커널(appendInt, appendHex, appendFloat 등)을 골라 호출합니다. 타입이 맞지 않으면 컴파일 오류입니다.
+// ==================================================================================================
+
+    namespace fmt {
+
+        /// 컴파일된 변환 명령 하나입니다. (앞쪽 리터럴 구간 + 변환 지정자)
+        struct Spec {
+            uint16_t litOffset;  ///< 변환 앞 리터럴의 시작 오프셋
+            uint16_t litLen;     ///< 변환 앞 리터럴 길이 ("%%"이면 '%' 한 글자를 포함)
+            char conv;           ///< 변환 문자 ('\0'이면 리터럴만 출력, '?'이면 지원하지 않는 지정자)
+            char padChar;        ///< 채움 문자 (' ' 또는 '0')
+            int16_t width;       ///< 최소 출력 너비
+            int8_t precision;    ///< 정밀도 (-1이면 기본값)
+            uint8_t argIndex;    ///< 사용할 인자 번호
+        };
+
+        /// 포맷 문자열 전체의 컴파일 결과입니다.
+        template <size_t N>
+        struct Program {
+            Spec specs[N > 0 ? N : 1];  ///< 변환 명령 목록
+            uint16_t tailOffset;        ///< 마지막 변환 뒤 리터럴의 시작 오프셋
+            uint16_t tailLen;           ///< 마지막 변환 뒤 리터럴 길이
+            uint8_t argCount;           ///< 필요한 인자 수
+            bool valid;                 ///< 모든 지정자를 지원하는지 여부
+        };
+
+        /// 컴파일 타임 strlen입니다.
+        constexpr size_t length(const char* f) {
+            size_t n = 0;
+            while (f[n]) n++;
+            return n;
+        }
+
+        /// '%' 위치(pos)에서 지정자 하나를 해석하고 다음 위치를 반환합니다.
+        ///
+        /// How: 런타임 appendPrintf와 같은 문법(플래그 '0', 너비, .정밀도, 길이 수정자)을 받아들입니다.
+        ///      길이 수정자는 인자 타입으로 폭이 결정되므로 건너뛰기만 합니다.
+        constexpr size_t parseSpec(const char* f, size_t pos, Spec& out) {
+            size_t i = pos + 1;
+            out.conv = '?';
+            out.padChar = ' ';
+            out.width = 0;
+            out.precision = -1;
+
+            if (f[i] == '%') {
+                out.conv = '\0';
+                return i + 1;
+            }
+            if (f[i] == '0') {
+                out.padChar = '0';
+                i++;
+            }
+            while (f[i] >= '0' && f[i] <= '9') {
+                if (out.width < 100) out.width = (int16_t)(out.width * 10 + (f[i] - '0'));
+                i++;
+            }
+            if (f[i] == '.') {
+                i++;
+                out.precision = 0;
+                while (f[i] >= '0' && f[i] <= '9') {
+                    if (out.precision < 100) out.precision = (int8_t)(out.precision * 10 + (f[i] - '0'));
+                    i++;
+                }
+            }
+            if ((f[i] == 'h' || f[i] == 'l') && f[i + 1] == f[i]) i += 2;
+            else if (f[i] == 'h' || f[i] == 'l' || f[i] == 'z' || f[i] == 'j' || f[i] == 't' || f[i] == 'L') i++;
+
+            switch (f[i]) {
+                case 'd': case 'i': case 'u': case 'x': case 'X': case 'p': case 'c': case 's':
+                case 'f': case 'F': case 'e': case 'E': case 'g': case 'G':
+                    out.conv = f[i];
+                    return i + 1;
+                case '\0':
+                    return i;     // "%l"처럼 지정자 없이 끝남 (conv == '?')
+                default:
+                    return i + 1; // 지원하지 않는 지정자 (conv == '?')
+            }
+        }
+
+        /// 포맷 문자열에 포함된 '%' 지정자 수를 셉니다. ("%%" 포함)
+        constexpr size_t countSpecs(const char* f) {
+            size_t n = 0;
+            size_t i = 0;
+            while (f[i]) {
+                if (f[i] != '%') { i++; continue; }
+                Spec s{};
+                i = parseSpec(f, i, s);
+                n++;
+            }
+            return n;
+        }
+
+        /// 포맷 문자열을 N개의 Spec으로 컴파일합니다.
+        template <size_t N>
+        constexpr Program<N> compile(const char* f) {
+            Program<N> prog{};
+            prog.valid = true;
+            size_t litStart = 0;
+            size_t i = 0;
+            size_t k = 0;
+            while (f[i]) {
+                if (f[i] != '%') { i++; continue; }
+                Spec& s = prog.specs[k++];
+                const size_t next = parseSpec(f, i, s);
+                s.litOffset = (uint16_t)litStart;
+                // "%%"는 앞 리터럴에 '%' 한 글자를 포함시키고 인자를 소비하지 않습니다.
+                s.litLen = (uint16_t)(i - litStart + (s.conv == '\0' ? 1 : 0));
+                if (s.conv == '?') prog.valid = false;
+                else if (s.conv != '\0') s.argIndex = prog.argCount++;
+                litStart = next;
+                i = next;
+            }
+            prog.tailOffset = (uint16_t)litStart;
+            prog.tailLen = (uint16_t)(i - litStart);
+            return prog;
+        }
+
+        /// 포맷 소스(Src::str())의 컴파일 결과를 보관합니다.
+        ///
+        /// @tparam Src static constexpr const char* str()를 제공하는 타입 (CMS_FORMAT 매크로가 생성)
+        template <typename Src>
+        struct Compiled {
+            static_assert(length(Src::str()) < 0xFFFF, "cms::format: format string is too long.");
+            static constexpr size_t count = countSpecs(Src::str());
+            static constexpr Program<count> program = compile<count>(Src::str());
+        };
+
+        /// 정수 인자를 같은 폭의 부호 없는 값으로 변환합니다. (printf %u/%x 규칙)
+        template <typename T>
+        constexpr unsigned long long toUnsigned(T v) {
+            if constexpr (std::is_same<T, bool>::value) return v ? 1ULL : 0ULL;
+            else return (unsigned long long)(typename std::make_unsigned<T>::type)v;
+        }
+
+        /// 변환 문자 C에 맞는 커널로 인자 하나를 추가합니다.
+        ///
+        /// Why: 타입과 지정자의 불일치를 런타임 쓰레기 출력 대신 컴파일 오류로 드러내기 위함입니다.
+        /// How: 출력 규칙은 appendPrintf와 같습니다. (%f 기본 정밀도 2, %s/%c 너비 무시, %p는 "0x" 접두사)
+        /// @return 공간이 부족해 버려진 바이트 수
+        template <char C, typename T>
+        inline size_t appendArg(char* buffer, size_t maxLen, size_t& curLen, const T& arg, int width, char padChar, int precision) {
+            using D = typename std::decay<T>::type;
+
+            if constexpr (C == 's') {
+                if constexpr (std::is_base_of<StringBase, D>::value || std::is_base_of<LargeStringBase, D>::value) {
+                    return cms::string::append(buffer, maxLen, curLen, arg.c_str(), arg.length());
+                } else if constexpr (std::is_same<D, StringView>::value) {
+                    return cms::string::append(buffer, maxLen, curLen, arg.data(), arg.length());
+                } else if constexpr (std::is_same<D, cms::string::Token>::value) {
+                    return cms::string::append(buffer, maxLen, curLen, arg.ptr, arg.len);
+                } else if constexpr (std::is_array<T>::value) {
+                    static_assert(std::is_convertible<D, const char*>::value, "cms::format: %s requires a string argument.");
+                    return cms::string::append(buffer, maxLen, curLen, arg, strlen(arg));
+                } else {
+                    static_assert(std::is_convertible<D, const char*>::value, "cms::format: %s requires a string argument.");
+                    const char* s = arg ? (const char*)arg : "(null)";
+                    return cms::string::append(buffer, maxLen, curLen, s, strlen(s));
+                }
+            } else if constexpr (C == 'd' || C == 'i') {
+                static_assert(std::is_integral<D>::value, "cms::format: %d requires an integer argument.");
+                if constexpr (std::is_signed<D>::value) return cms::string::appendInt(buffer, maxLen, curLen, (long long)arg, width, padChar);
+                else return cms::string::appendUInt(buffer, maxLen, curLen, (unsigned long long)arg, width, padChar);
+            } else if constexpr (C == 'u') {
+                static_assert(std::is_integral<D>::value, "cms::format: %u requires an integer argument.");
+                return cms::string::appendUInt(buffer, maxLen, curLen, toUnsigned<D>(arg), width, padChar);
+            } else if constexpr (C == 'x' || C == 'X') {
+                static_assert(std::is_integral<D>::value, "cms::format: %x requires an integer argument.");
+                return cms::string::appendHex(buffer, maxLen, curLen, toUnsigned<D>(arg), width, padChar, C == 'X');
+            } else if constexpr (C == 'p') {
+                static_assert(std::is_pointer<D>::value, "cms::format: %p requires a pointer argument.");
+                const size_t dropped = cms::string::append(buffer, maxLen, curLen, "0x", 2);
+                return dropped + cms::string::appendHex(buffer, maxLen, curLen, (unsigned long long)reinterpret_cast<uintptr_t>(arg),
+                                                        width > 2 ? width - 2 : 0, padChar, false);
+            } else if constexpr (C == 'c') {
+                static_assert(std::is_integral<D>::value, "cms::format: %c requires a character argument.");
+                const char c = (char)arg;
+                return cms::string::append(buffer, maxLen, curLen, &c, 1);
+            } else {
+                static_assert(std::is_floating_point<D>::value, "cms::format: %f/%e/%g require a floating-point argument.");
+                constexpr cms::string::FloatFormat format = (C == 'f' || C == 'F') ? cms::string::FloatFormat::Fixed
+                                                          : (C == 'e' || C == 'E') ? cms::string::FloatFormat::Exponent
+                                                                                   : cms::string::FloatFormat::General;
+                constexpr bool uppercase = (C == 'F' || C == 'E' || C == 'G');
+                if (format == cms::string::FloatFormat::Fixed && precision < 0) precision = 2;
+                // printf와 같이 float 인자도 double로 승격하여 출력합니다.
+                return cms::string::appendFloat(buffer, maxLen, curLen, (double)arg, format, precision, uppercase, width, padChar);
+            }
+        }
+
+        /// I번째 Spec을 실행합니다. (앞 리터럴 복사 + 인자 변환)
+        /// @return 공간이 부족해 버려진 바이트 수
+        template <typename Src, size_t I, typename Tuple>
+        inline size_t emit(char* buffer, size_t maxLen, size_t& curLen, const Tuple& args) {
+            constexpr Spec spec = Compiled<Src>::program.specs[I];
+            size_t dropped = 0;
+            if constexpr (spec.litLen > 0) {
+                dropped += cms::string::append(buffer, maxLen, curLen, Src::str() + spec.litOffset, spec.litLen);
+            }
+            if constexpr (spec.conv != '\0') {
+                dropped += appendArg<spec.conv>(buffer, maxLen, curLen, std::get<spec.argIndex>(args), spec.width, spec.padChar,
+                                                spec.precision);
+            }
+            return dropped;
+        }
+
+        template <typename Src, typename Tuple, size_t... I>
+        inline size_t emitAll(char* buffer, size_t maxLen, size_t& curLen, const Tuple& args, std::index_sequence<I...>) {
+            return (size_t(0) + ... + emit<Src, I>(buffer, maxLen, curLen, args));
+        }
+
+        /// 컴파일된 포맷을 원시 버퍼에 실행합니다.
+        ///
+        /// @param format 포맷 문자열 (매크로 호환용으로만 받으며 실행 시에는 읽지 않습니다)
+        /// @return 공간이 충분했다면 됐을 최종 바이트 길이 (appendPrintf와 동일, curLen보다 크면 잘림)
+        template <typename Src, typename... Args>
+        inline int executeTo(char* buffer, size_t maxLen, size_t& curLen, const char* format, const Args&... args) {
+            (void)format;
+            using C = Compiled<Src>;
+            static_assert(C::program.valid, "cms::format: unsupported or incomplete conversion specifier.");
+            static_assert(C::program.argCount == sizeof...(Args), "cms::format: argument count does not match the format string.");
+            size_t dropped = 0;
+            if constexpr (C::program.valid && C::program.argCount == sizeof...(Args)) {
+                if (!buffer) return 0;
+                dropped = emitAll<Src>(buffer, maxLen, curLen, std::forward_as_tuple(args...), std::make_index_sequence<C::count>{});
+                if constexpr (C::program.tailLen > 0) {
+                    dropped += cms::string::append(buffer, maxLen, curLen, Src::str() + C::program.tailOffset, C::program.tailLen);
+                }
+            }
+            return (int)(curLen + dropped);
+        }
+
+        /// 컴파일된 포맷을 StringBase 뒤에 실행합니다. (길이/통계/잘림 기록 동기화는 한 번만 수행)
+        template <typename Src, typename SizeT, typename... Args>
+        inline int execute(BasicStringBase<SizeT>& out, const char* format, const Args&... args) {
+            size_t wouldBe = 0;
+            out.appendWith([&](char* buffer, size_t maxLen, size_t& curLen) {
+                wouldBe = (size_t)executeTo<Src>(buffer, maxLen, curLen, format, args...);
+                return wouldBe > curLen ? wouldBe - curLen : 0;
+            });
+            return (int)wouldBe;
+        }
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+        /// C++20 클래스 타입 템플릿 인자로 포맷 리터럴을 받기 위한 고정 문자열입니다.
+        template <size_t M>
+        struct FixedString {
+            char data[M];
+            constexpr FixedString(const char (&s)[M]) : data{} {
+                for (size_t i = 0; i < M; i++) data[i] = s[i];
+            }
+        };
+
+        /// FixedString을 Compiled가 요구하는 str() 인터페이스로 감쌉니다.
+        template <FixedString F>
+        struct FixedSource {
+            static constexpr const char* str() { return F.data; }
+        };
+#endif
+
+    } // namespace fmt
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+    /// [format] 컴파일 타임 포맷을 StringBase 뒤에 추가합니다. (C++20)
+    ///
+    /// 사용 예:
+    /// @code
+    /// cms::String<64> line;
+    /// cms::format<"[%s] %d">(line, tag, value);
+    /// @endcode
+    ///
+    /// @return 공간이 충분했다면 됐을 최종 문자열의 전체 바이트 길이 (length()보다 크면 잘림)
+    template <fmt::FixedString F, typename SizeT, typename... Args>
+    inline int format(BasicStringBase<SizeT>& out, const Args&... args) {
+        return fmt::execute<fmt::FixedSource<F>>(out, F.data, args...);
+    }
+
+    /// [formatTo] 컴파일 타임 포맷을 원시 버퍼 뒤에 추가합니다. (C++20)
+    template <fmt::FixedString F, typename... Args>
+    inline int formatTo(char* buffer, size_t maxLen, size_t& curLen, const Args&... args) {
+        return fmt::executeTo<fmt::FixedSource<F>>(buffer, maxLen, curLen, F.data, args...);
+    }
+#endif
+
+} // namespace cms
+
+/// C++17에서는 문자열 리터럴을 템플릿 인자로 받을 수 없으므로, 리터럴을 반환하는 지역 타입을 만들어 전달합니다.
+#define CMS_FORMAT_FIRST_(first, ...) first
+#define CMS_FORMAT_SOURCE_(...) \
+    struct CmsFormatSource { static constexpr const char* str() { return CMS_FORMAT_FIRST_(__VA_ARGS__, 0); } }
+
+// ---------------------------------------------------------
+// [CMS_FORMAT] 컴파일 타임 포맷을 StringBase 뒤에 추가합니다. (C++17)
+//
+// Usage: CMS_FORMAT(line, "[%s] %d", tag, value);
+//
+// @param out cms::String<N> 등 StringBase 객체
+// @param ... 포맷 문자열 리터럴과 인자
+// @return 공간이 충분했다면 됐을 최종 문자열의 전체 바이트 길이 (length()보다 크면 잘림, isTruncated()도 설정됨)
+//
+// @note 지정자와 인자 타입/개수가 맞지 않으면 컴파일 오류가 발생합니다.
+// ---------------------------------------------------------
+#define CMS_FORMAT(out, ...) \
+    ([&]() -> int { CMS_FORMAT_SOURCE_(__VA_ARGS__); return ::cms::fmt::execute<CmsFormatSource>((out), __VA_ARGS__); }())
+
+// ---------------------------------------------------------
+// [CMS_FORMAT_TO] 컴파일 타임 포맷을 원시 버퍼 뒤에 추가합니다. (C++17)
+//
+// Usage: CMS_FORMAT_TO(buf, sizeof(buf), len, "T=%.1f", temp);
+//
+// @param buffer 대상 버퍼
+// @param maxLen 버퍼 최대 크기
+// @param curLen 현재 길이 (업데이트됨)
+// @param ... 포맷 문자열 리터럴과 인자
+// @return 공간이 충분했다면 됐을 최종 바이트 길이 (curLen보다 크면 잘림)
+// ---------------------------------------------------------
+#define CMS_FORMAT_TO(buffer, maxLen, curLen, ...) \
+    ([&]() -> int { CMS_FORMAT_SOURCE_(__VA_ARGS__); \
+                    return ::cms::fmt::executeTo<CmsFormatSource>((buffer), (maxLen), (curLen), __VA_ARGS__); }())
@@ -0,0 +1,82 @@
+/// @author comser.dev
+///
+/// InternPoolBase 등록/탐색 구현부입니다.
+
+#include "cmsIntern.h"
+#include <cstring> // memcpy
+
+namespace cms {
+
+    InternPoolBase::InternPoolBase(Entry* entries, size_t maxEntries, uint16_t* slots, size_t slotCount,
+                                   char* chars, size_t charCapacity, bool ignoreCase) noexcept
+        : _entries(entries), _slots(slots), _chars(chars), _maxEntries(maxEntries), _slotMask(slotCount - 1),
+          _charCapacity(charCapacity), _charsUsed(0), _size(0), _ignoreCase(ignoreCase) {
+        clear();
+    }
+
+    void InternPoolBase::clear() noexcept {
+        memset(_slots, 0, (_slotMask + 1) * sizeof(uint16_t));
+        _charsUsed = 0;
+        _size = 0;
+    }
+
+    /// [hashBytes] 기본 알고리즘(CMS_HASH_DEFAULT) 해시
+    ///
+    /// How: 대소문자 무시 풀에서는 바이트를 대문자로 접어서 계산하므로 "WiFi"와 "wifi"가 같은 슬롯으로 모입니다.
+    uint32_t InternPoolBase::hashBytes(const char* s, size_t len) const noexcept {
+        return cms::string::hash(s, len, _ignoreCase);
+    }
+
+    /// [probe] 선형 탐사
+    ///
+    /// 해시가 같을 때만 본문을 비교하므로, 대부분의 불일치 슬롯은 정수 비교 한 번으로 지나갑니다.
+    /// 슬롯 수가 항상 엔트리 수의 2배 이상이므로 빈 슬롯을 반드시 만납니다.
+    size_t InternPoolBase::probe(const char* s, size_t len, uint32_t hash) const noexcept {
+        size_t i = hash & _slotMask;
+        for (;;) {
+            const uint16_t slot = _slots[i];
+            if (slot == 0) return i;
+            const Entry& e = _entries[slot - 1];
+            if (e.hash == hash && cms::string::equals(_chars + e.offset, e.len, s, len, _ignoreCase)) return i;
+            i = (i + 1) & _slotMask;
+        }
+    }
+
+    InternPoolBase::Handle InternPoolBase::find(StringView s) const noexcept {
+        const uint16_t slot = _slots[probe(s.data(), s.length(), hashBytes(s.data(), s.length()))];
+        return slot ? (Handle)(slot - 1) : INVALID;
+    }
+
+    /// [intern] 등록 상세 구현
+    ///
+    /// 1) 해시 계산 후 슬롯 탐색 (이미 있으면 기존 핸들 반환)
+    /// 2) 엔트리/문자 영역 여유 확인
+    /// 3) 본문을 NUL 종료로 복사하고 슬롯에 엔트리 번호 기록
+    InternPoolBase::Handle InternPoolBase::intern(StringView s) noexcept {
+        const size_t len = s.length();
+        if (len > 0xFFFF) return INVALID;
+
+        const uint32_t hash = hashBytes(s.data(), len);
+        const size_t i = probe(s.data(), len, hash);
+        if (_slots[i]) return (Handle)(_slots[i] - 1);
+
+        if (_size >= _maxEntries || len + 1 > _charCapacity - _charsUsed) return INVALID;
+
+        Entry& e = _entries[_size];
+        e.hash = hash;
+        e.offset = (uint32_t)_charsUsed;
+        e.len = (uint16_t)len;
+        memcpy(_chars + _charsUsed, s.data(), len);
+        _chars[_charsUsed + len] = '\0';
+        _charsUsed += len + 1;
+
+        _slots[i] = (uint16_t)(_size + 1);
+        return _size++;
+    }
+
+    StringView InternPoolBase::view(Handle h) const noexcept {
+        if (h >= _size) return StringView();
+        return StringView(_chars + _entries[h].offset, _entries[h].len);
+    }
+
+} // namespace cms
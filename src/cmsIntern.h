@@ -0,0 +1,143 @@
+/// @author comser.dev
+///
+/// 반복되는 식별자(태그, 토픽, 키)를 한 번만 저장하고 작은 정수 핸들로 다루는 인턴(Intern) 풀 정의서입니다.
+/// 등록 이후의 비교는 핸들 비교 한 번으로 끝나며, 해시는 등록 시 한 번만 계산됩니다.
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <cstdint>  // uint16_t, uint32_t
+#include "cmsStringView.h"
+
+namespace cms {
+
+// ==================================================================================================
+// [InternPool] 개요
+// - 왜 존재하는가: 태그 이름이나 토픽 문자열은 매번 equals/compareIgnoreCase로 바이트 단위 비교되고,
+//                  같은 내용이 여러 String<N>에 중복 저장되었습니다.
+// - 어떻게 동작하는가: 문자열 본문은 고정 크기 문자 영역에 한 번만 이어 붙여 저장하고, 해시 → 엔트리 번호를
+//                      개방 주소법(선형 탐사) 테이블로 찾아 엔트리 번호 자체를 핸들로 돌려줍니다.
+// ==================================================================================================
+
+    /// 인턴 풀의 공통 로직을 담당하는 베이스 클래스입니다.
+    ///
+    /// Why: 엔트리 수/문자 영역 크기마다 탐색 코드가 중복 생성되는 것을 막기 위함입니다. (Thin Template)
+    /// How: 자식 클래스(InternPool)가 주입한 엔트리 배열, 슬롯 테이블, 문자 영역만으로 동작합니다.
+    ///
+    /// @note 등록만 가능하며 개별 삭제는 지원하지 않습니다. (clear()로 전체 초기화) 스레드 안전하지 않습니다.
+    class InternPoolBase {
+    public:
+        /// 인턴된 문자열을 가리키는 핸들입니다. (0부터 등록 순서대로 증가)
+        using Handle = uint16_t;
+        /// 유효하지 않은 핸들 (찾지 못함 또는 풀이 가득 참)
+        static constexpr Handle INVALID = 0xFFFF;
+
+        /// [intern] 문자열을 등록하고 핸들을 반환합니다. (이미 있으면 기존 핸들)
+        ///
+        /// 사용 예:
+        /// @code
+        /// auto wifi = tags.intern("WiFi");
+        /// if (tags.intern(token) == wifi) { ... }   // 이후 비교는 정수 비교
+        /// @endcode
+        ///
+        /// @param s 등록할 문자열 (NUL 종료 불필요)
+        /// @return 핸들 (엔트리나 문자 영역이 부족하면 INVALID)
+        Handle intern(StringView s) noexcept;
+
+        /// [find] 등록하지 않고 핸들만 찾습니다.
+        ///
+        /// @return 핸들 (없으면 INVALID)
+        Handle find(StringView s) const noexcept;
+
+        /// 핸들이 가리키는 문자열을 반환합니다. (INVALID나 범위 밖이면 빈 뷰)
+        StringView view(Handle h) const noexcept;
+        /// 핸들이 가리키는 NUL 종료 문자열을 반환합니다. (INVALID나 범위 밖이면 "")
+        const char* c_str(Handle h) const noexcept { return view(h).data(); }
+        /// 등록 시 계산해 둔 해시를 반환합니다. (색상 선택, 버킷 분배 등에 재사용)
+        uint32_t hashOf(Handle h) const noexcept { return h < _size ? _entries[h].hash : 0; }
+
+        /// 등록된 문자열 수를 반환합니다.
+        size_t size() const noexcept { return _size; }
+        /// 등록 가능한 최대 문자열 수를 반환합니다.
+        size_t capacity() const noexcept { return _maxEntries; }
+        /// 문자 영역 사용량을 반환합니다. (NUL 종료 문자 포함)
+        size_t bytesUsed() const noexcept { return _charsUsed; }
+        /// 대소문자를 무시하는 풀인지 확인합니다.
+        bool ignoresCase() const noexcept { return _ignoreCase; }
+
+        /// 모든 등록을 해제합니다. (이전 핸들은 무효)
+        void clear() noexcept;
+
+    protected:
+        /// 엔트리 하나 (문자 영역 내 위치와 미리 계산한 해시)
+        struct Entry {
+            uint32_t hash;   ///< 등록 시 계산한 해시
+            uint32_t offset; ///< 문자 영역 내 시작 위치
+            uint16_t len;    ///< 바이트 길이 (NUL 제외)
+        };
+
+        /// 자식 클래스에서 저장소를 주입받아 초기화합니다.
+        ///
+        /// @param entries 엔트리 배열 (maxEntries개)
+        /// @param slots 해시 슬롯 테이블 (slotCount개, 2의 거듭제곱, maxEntries보다 커야 함)
+        /// @param chars 문자 영역
+        /// @param ignoreCase true면 "WiFi"와 "wifi"를 같은 문자열로 취급 (먼저 등록된 표기를 보관)
+        InternPoolBase(Entry* entries, size_t maxEntries, uint16_t* slots, size_t slotCount,
+                       char* chars, size_t charCapacity, bool ignoreCase) noexcept;
+
+        InternPoolBase(const InternPoolBase&) = delete;
+        InternPoolBase& operator=(const InternPoolBase&) = delete;
+
+    private:
+        /// 설정된 대소문자 규칙으로 해시를 계산합니다.
+        uint32_t hashBytes(const char* s, size_t len) const noexcept;
+        /// s가 들어 있거나 들어갈 슬롯 번호를 찾습니다.
+        size_t probe(const char* s, size_t len, uint32_t hash) const noexcept;
+
+        Entry* _entries;      ///< 등록 순서대로 쌓이는 엔트리
+        uint16_t* _slots;     ///< 엔트리 번호 + 1 (0은 빈 슬롯)
+        char* _chars;         ///< 문자열 본문 (NUL 종료로 이어 붙임)
+        size_t _maxEntries;   ///< 최대 엔트리 수
+        size_t _slotMask;     ///< slotCount - 1
+        size_t _charCapacity; ///< 문자 영역 크기
+        size_t _charsUsed;    ///< 문자 영역 사용량
+        Handle _size;         ///< 등록된 엔트리 수
+        bool _ignoreCase;     ///< 대소문자 무시 여부
+    };
+
+    /// 고정 크기 인턴 풀입니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// static cms::InternPool<32, 512> topics;           // 최대 32개, 본문 합계 512바이트
+    /// auto h = topics.intern("sensor/temp");
+    /// topics.c_str(h);                                  // "sensor/temp"
+    /// @endcode
+    ///
+    /// @tparam MaxEntries 최대 등록 문자열 수 (65534 이하)
+    /// @tparam CharBytes 문자열 본문을 저장할 영역 크기 (NUL 종료 문자 포함)
+    template<size_t MaxEntries, size_t CharBytes>
+    class InternPool : public InternPoolBase {
+        static_assert(MaxEntries > 0 && MaxEntries < INVALID, "MaxEntries must be between 1 and 65534");
+        static_assert(CharBytes > 0 && CharBytes <= 0xFFFFFFFFu, "CharBytes must fit in 32 bits");
+
+        /// 적재율 50% 이하를 보장하는 2의 거듭제곱 슬롯 수
+        static constexpr size_t slotCountFor(size_t n) {
+            size_t s = 1;
+            while (s < n * 2) s <<= 1;
+            return s;
+        }
+        static constexpr size_t SLOTS = slotCountFor(MaxEntries);
+
+    public:
+        /// @param ignoreCase true면 대소문자를 무시하고 같은 문자열로 취급합니다.
+        explicit InternPool(bool ignoreCase = false) noexcept
+            : InternPoolBase(_entryStore, MaxEntries, _slotStore, SLOTS, _charStore, CharBytes, ignoreCase) {}
+
+    private:
+        Entry _entryStore[MaxEntries];
+        uint16_t _slotStore[SLOTS];
+        char _charStore[CharBytes];
+    };
+
+} // namespace cms
@@ -12,6 +12,7 @@
 #include <freertos/FreeRTOS.h> // FreeRTOS 커널
 #include <freertos/semphr.h> // 세마포어/뮤텍스 API
 #endif
+#include "cmsTrace.h" // CMS_TRACE
 
 namespace cms {
 
@@ -198,6 +199,7 @@ public:
     ///
     /// @param item 추가할 데이터 참조
     void enqueue(const T& item) {
+        CMS_TRACE("ThreadSafeQueue::enqueue");
         lock();
         _queue.enqueue(item);
         unlock();
@@ -215,6 +217,7 @@ public:
     ///
     /// @return true: 성공, false: 큐가 비어있음
     bool pop(T& outItem) {
+        CMS_TRACE("ThreadSafeQueue::pop");
         lock();
         bool ok = _queue.pop(outItem);
         unlock();
@@ -0,0 +1,143 @@
+/// @author comser.dev
+///
+/// BlockPoolBase 및 Rope 구현부입니다.
+
+#include "cmsRope.h"
+#include <cstring> // memcpy
+
+namespace cms {
+
+    /// [BlockPoolBase] 저장소를 블록 단위로 나눠 프리 리스트를 구성합니다.
+    BlockPoolBase::BlockPoolBase(uint8_t* storage, size_t blockSize, size_t stride, size_t count) noexcept
+        : _free(nullptr), _blockSize(blockSize), _count(count), _available(count), _peak(0) {
+        // 뒤쪽 블록부터 엮어 acquire()가 앞쪽 블록부터 꺼내도록 합니다.
+        for (size_t i = count; i-- > 0;) {
+            FreeNode* node = reinterpret_cast<FreeNode*>(storage + i * stride);
+            node->next = _free;
+            _free = node;
+        }
+    }
+
+    void* BlockPoolBase::acquire() noexcept {
+        if (!_free) return nullptr;
+        FreeNode* node = _free;
+        _free = node->next;
+        _available--;
+        if (_count - _available > _peak) _peak = _count - _available;
+        return node;
+    }
+
+    void BlockPoolBase::release(void* block) noexcept {
+        if (!block) return;
+        FreeNode* node = static_cast<FreeNode*>(block);
+        node->next = _free;
+        _free = node;
+        _available++;
+    }
+
+    /// [clear] 체인을 따라가며 모든 블록을 풀에 반납합니다.
+    void Rope::clear() noexcept {
+        Segment* seg = _head;
+        while (seg) {
+            Segment* next = seg->next;
+            _pool.release(seg);
+            seg = next;
+        }
+        _pool.release(_stage);
+        _head = _tail = nullptr;
+        _stage = nullptr;
+        _length = 0;
+        _segments = 0;
+        _truncated = false;
+    }
+
+    /// [grow] 새 블록 연결
+    bool Rope::grow() noexcept {
+        Segment* seg = static_cast<Segment*>(_pool.acquire());
+        if (!seg) {
+            _truncated = true;
+            return false;
+        }
+        seg->next = nullptr;
+        seg->len = 0;
+        if (_tail) _tail->next = seg;
+        else _head = seg;
+        _tail = seg;
+        _segments++;
+        return true;
+    }
+
+    /// [stageBuffer] 스테이징 블록 지연 획득
+    char* Rope::stageBuffer() noexcept {
+        if (!_stage) {
+            _stage = static_cast<char*>(_pool.acquire());
+            if (!_stage) _truncated = true;
+        }
+        return _stage;
+    }
+
+    /// [append] 원시 데이터 기록
+    ///
+    /// 마지막 블록의 남은 공간만큼 복사하고, 남은 데이터가 있으면 새 블록을 빌려 이어서 복사합니다.
+    void Rope::append(const char* s, size_t len) noexcept {
+        if (!s) return;
+        while (len > 0) {
+            if (tailRoom() == 0 && !grow()) return;
+            const size_t room = tailRoom();
+            const size_t n = len < room ? len : room;
+            memcpy(tailData(), s, n);
+            commit(n);
+            s += n;
+            len -= n;
+        }
+    }
+
+    /// [appendPrintf] 포맷 조각 기록
+    int Rope::appendPrintf(const char* format, va_list args) {
+        if (!format) return (int)_length;
+        appendWith([&](StringBase& piece) { piece.appendPrintf(format, args); });
+        return (int)_length;
+    }
+
+    int Rope::appendPrintf(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        int ret = appendPrintf(format, args);
+        va_end(args);
+        return ret;
+    }
+
+    /// [operator<<] 바이트 덤프 기록
+    ///
+    /// How: 스테이징 블록 하나에 들어가는 바이트 수(구분자 포함 3문자/바이트 기준)씩 나눠 기록하고, 조각 사이에 구분자를 넣습니다.
+    Rope& Rope::operator<<(const BytesManip& m) {
+        const uint8_t* p = static_cast<const uint8_t*>(m.data);
+        const size_t perByte = m.separator ? 3 : 2;
+        const size_t chunk = (_pool.blockSize() - 1) / perByte;
+        size_t left = p ? m.len : 0;
+        while (left > 0) {
+            const size_t n = left < chunk ? left : chunk;
+            appendWith([&](StringBase& piece) { piece << cms::bytes(p, n, m.separator); });
+            p += n;
+            left -= n;
+            if (left > 0 && m.separator) append(&m.separator, 1);
+        }
+        return *this;
+    }
+
+    /// [spans] 블록별 구간 목록 생성
+    size_t Rope::spans(Span* out, size_t maxSpans) const noexcept {
+        if (!out) return 0;
+        size_t n = 0;
+        for (const Segment* seg = _head; seg && n < maxSpans; seg = seg->next) {
+            if (seg->len > 0) out[n++] = Span{seg->data(), seg->len};
+        }
+        return n;
+    }
+
+    /// [copyTo] 연속 버퍼로 복사
+    void Rope::copyTo(StringBase& dest) const {
+        forEachSpan([&](const char* data, size_t len) { dest.append(data, len); });
+    }
+
+} // namespace cms
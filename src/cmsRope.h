@@ -0,0 +1,248 @@
+/// @author comser.dev
+///
+/// 고정 크기 블록을 이어 붙여 큰 출력을 조립하는 세그먼트 문자열 빌더(Rope) 정의서입니다.
+/// 블록은 정적 블록 풀에서 빌려오며, 결과는 연속 버퍼로 복사하지 않고 (포인터, 길이) 목록으로 내보냅니다.
+
+#pragma once
+
+#include <stddef.h> // size_t, max_align_t
+#include <cstdint>  // uint8_t
+#include <cstdarg>  // va_list
+#include "cmsStringRef.h"
+
+namespace cms {
+
+// ==================================================================================================
+// [BlockPool] 개요
+// - 왜 존재하는가: Rope처럼 크기가 같은 블록을 빌리고 반납하는 컴포넌트가 힙 없이 메모리를 재사용하기 위해 존재합니다.
+// - 어떻게 동작하는가: 정적 배열을 같은 크기의 블록으로 나누고, 비어 있는 블록의 첫 바이트에 다음 빈 블록 포인터를
+//                      기록하는 침투형(Intrusive) 프리 리스트로 O(1) 획득/반납합니다.
+// ==================================================================================================
+
+    /// 블록 풀의 공통 로직을 담당하는 베이스 클래스입니다.
+    ///
+    /// Why: 블록 크기/개수마다 획득/반납 코드가 중복 생성되는 것을 막기 위함입니다. (Thin Template)
+    /// How: 자식 클래스(BlockPool)가 주입한 저장소를 생성 시 한 번 프리 리스트로 엮습니다.
+    ///
+    /// @note 스레드 안전하지 않습니다. 같은 풀을 여러 태스크가 공유하려면 외부에서 잠금을 거세요.
+    class BlockPoolBase {
+    public:
+        /// [acquire] 빈 블록 하나를 꺼냅니다.
+        ///
+        /// @return 블록 시작 포인터 (max_align_t 정렬, 풀이 비었으면 nullptr)
+        void* acquire() noexcept;
+
+        /// [release] acquire()로 받은 블록을 반납합니다. (nullptr은 무시)
+        void release(void* block) noexcept;
+
+        /// 블록 하나의 크기를 반환합니다. (바이트)
+        size_t blockSize() const noexcept { return _blockSize; }
+        /// 전체 블록 수를 반환합니다.
+        size_t blockCount() const noexcept { return _count; }
+        /// 남은 블록 수를 반환합니다.
+        size_t available() const noexcept { return _available; }
+        /// 생성 이후 동시에 사용된 최대 블록 수(High Water Mark)를 반환합니다.
+        size_t peak() const noexcept { return _peak; }
+
+    protected:
+        /// 자식 클래스에서 저장소를 주입받아 프리 리스트를 구성합니다.
+        ///
+        /// @param storage 블록 저장소 (stride * count 바이트)
+        /// @param blockSize 사용자에게 보고할 블록 크기
+        /// @param stride 블록 간 간격 (max_align_t 배수)
+        /// @param count 블록 수
+        BlockPoolBase(uint8_t* storage, size_t blockSize, size_t stride, size_t count) noexcept;
+
+        BlockPoolBase(const BlockPoolBase&) = delete;
+        BlockPoolBase& operator=(const BlockPoolBase&) = delete;
+
+    private:
+        struct FreeNode { FreeNode* next; };
+
+        FreeNode* _free;    ///< 빈 블록 리스트의 머리
+        size_t _blockSize;  ///< 블록 크기
+        size_t _count;      ///< 전체 블록 수
+        size_t _available;  ///< 남은 블록 수
+        size_t _peak;       ///< 최대 사용 블록 수
+    };
+
+    /// 고정 크기 블록 Count개를 소유하는 풀입니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// static cms::BlockPool<256, 16> pool;   // 256바이트 블록 16개 (4KiB)
+    /// @endcode
+    ///
+    /// @tparam BlockSize 블록 하나의 크기 (바이트)
+    /// @tparam Count 블록 수
+    template<size_t BlockSize, size_t Count>
+    class BlockPool : public BlockPoolBase {
+        static_assert(BlockSize >= 2 * sizeof(void*) + sizeof(size_t), "BlockSize is too small to hold a block header");
+        static_assert(Count > 0, "BlockPool must have at least one block");
+
+        /// 블록 간 간격 (모든 블록이 max_align_t 경계에서 시작하도록 올림)
+        static constexpr size_t STRIDE = (BlockSize + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1);
+
+    public:
+        BlockPool() noexcept : BlockPoolBase(_storage, BlockSize, STRIDE, Count) {}
+
+    private:
+        alignas(max_align_t) uint8_t _storage[STRIDE * Count]; ///< 실제 블록 저장소
+    };
+
+// ==================================================================================================
+// [Rope] 개요
+// - 왜 존재하는가: 수 KiB의 JSON 응답을 String에 계속 append하면 1024바이트 제한에 걸리거나, 응답 전체 크기의
+//                  연속 버퍼 하나를 따로 잡아야 했습니다.
+// - 어떻게 동작하는가: 블록 풀에서 빌린 블록을 단일 연결 리스트로 이어 붙여 기록하고, 전송 시에는 블록별
+//                      (포인터, 길이) 목록(Span)을 넘겨 Scatter-Gather 방식으로 내보냅니다.
+// ==================================================================================================
+
+    /// 블록 체인 위에 문자열을 조립하는 빌더입니다.
+    ///
+    /// Why: 출력 전체를 담는 연속 버퍼 없이 StringBase와 같은 방식(append, appendPrintf, operator<<)으로 큰 응답을 만들기 위함입니다.
+    /// How: 원시 문자열은 블록 경계에서 나뉘어 이어서 기록되고, 숫자/포맷 조각은 스테이징 블록에서 만든 뒤 같은 방식으로 복사됩니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// static cms::BlockPool<256, 16> pool;
+    /// cms::Rope json(pool);
+    /// json << "{\"items\":[";
+    /// for (int i = 0; i < n; ++i) json.appendPrintf("%s{\"id\":%d}", i ? "," : "", ids[i]);
+    /// json << "]}";
+    ///
+    /// cms::Rope::Span iov[16];
+    /// size_t cnt = json.spans(iov, 16);
+    /// netconn_write_vectors_partly(conn, (netvector*)iov, cnt, ...); // 연속 복사 없이 전송
+    /// @endcode
+    ///
+    /// @note 포맷 조각(appendPrintf 한 번, 숫자, 조작자) 하나는 blockSize() - 1바이트를 넘을 수 없습니다. (넘는 부분은 잘림)
+    ///       포맷 기능을 사용하면 스테이징용 블록 하나를 추가로 빌려 clear() 때까지 보관합니다.
+    class Rope {
+    public:
+        /// 연속된 바이트 구간 하나입니다. (struct iovec과 같은 배치: 포인터, 길이)
+        struct Span {
+            const char* data; ///< 구간 시작 (NUL 종료 아님)
+            size_t len;       ///< 바이트 길이
+        };
+
+        /// 블록을 빌려올 풀로 빈 빌더를 생성합니다.
+        explicit Rope(BlockPoolBase& pool) noexcept
+            : _pool(pool), _head(nullptr), _tail(nullptr), _stage(nullptr), _length(0), _segments(0), _truncated(false) {}
+
+        /// 빌린 블록을 모두 풀에 반납합니다.
+        ~Rope() { clear(); }
+
+        Rope(const Rope&) = delete;
+        Rope& operator=(const Rope&) = delete;
+
+        /// 모든 블록을 풀에 반납하고 빈 상태로 되돌립니다. (잘림 플래그도 초기화)
+        void clear() noexcept;
+
+        /// 전체 바이트 길이를 반환합니다.
+        size_t length() const noexcept { return _length; }
+        /// 비어있는지 확인합니다.
+        bool isEmpty() const noexcept { return _length == 0; }
+        /// 사용 중인 블록(구간) 수를 반환합니다. (spans()에 필요한 배열 크기)
+        size_t segmentCount() const noexcept { return _segments; }
+        /// 풀이 비었거나 조각 하나가 블록 크기를 넘어 내용이 잘린 적이 있는지 확인합니다.
+        bool isTruncated() const noexcept { return _truncated; }
+
+        /// [append] 길이를 아는 데이터를 덧붙입니다. (블록 경계에서 나뉘어 기록됨)
+        void append(const char* s, size_t len) noexcept;
+        void append(StringView view) noexcept { append(view.data(), view.length()); }
+
+        /// [appendPrintf] printf 스타일로 내용을 덧붙입니다.
+        ///
+        /// @return 포맷팅 후 전체 바이트 길이 (조각이 블록 크기를 넘어 잘리면 isTruncated()가 설정됨)
+        int appendPrintf(const char* format, va_list args);
+        int appendPrintf(const char* format, ...) CMS_PRINTF_CHECK(2, 3);
+
+        /// [appendWith] 스테이징 블록을 StringBase로 감싸 fn에 기록을 맡긴 뒤, 결과를 체인에 덧붙입니다.
+        ///
+        /// Why: StringBase의 숫자/조작자/포맷 커널을 그대로 재사용하면서, 조각이 블록 경계에 걸려도 잘리지 않게 하기 위함입니다.
+        /// How: 커널은 공간이 부족하면 값을 통째로 생략하므로 블록 끝의 남은 공간에 직접 쓰지 않고,
+        ///      처음 한 번 빌려 둔 스테이징 블록(블록 전체 크기)에 기록한 뒤 append()로 나눠 복사합니다.
+        ///
+        /// @param fn void(StringBase& piece) 형태의 호출 가능 객체
+        template<typename Fn>
+        void appendWith(Fn&& fn) {
+            char* stage = stageBuffer();
+            if (!stage) return;
+            SmallStringRef piece(stage, _pool.blockSize());
+            fn(static_cast<StringBase&>(piece));
+            if (piece.isTruncated()) _truncated = true; // 조각 하나가 블록 크기를 넘은 경우
+            append(piece.c_str(), piece.length());
+        }
+
+        Rope& operator<<(const char* s) { if (s) append(StringView(s)); return *this; }
+        Rope& operator<<(StringView view) { append(view); return *this; }
+        Rope& operator<<(const cms::string::Token& token) { append(token.ptr, token.len); return *this; }
+        Rope& operator<<(const StringBase& s) { append(s.c_str(), s.length()); return *this; }
+        Rope& operator<<(char c) { append(&c, 1); return *this; }
+        Rope& operator<<(int v) { appendWith([&](StringBase& s) { s << v; }); return *this; }
+        Rope& operator<<(long v) { appendWith([&](StringBase& s) { s << v; }); return *this; }
+        Rope& operator<<(unsigned int v) { appendWith([&](StringBase& s) { s << v; }); return *this; }
+        Rope& operator<<(unsigned long v) { appendWith([&](StringBase& s) { s << v; }); return *this; }
+        Rope& operator<<(long long v) { appendWith([&](StringBase& s) { s << v; }); return *this; }
+        Rope& operator<<(unsigned long long v) { appendWith([&](StringBase& s) { s << v; }); return *this; }
+        Rope& operator<<(float v) { appendWith([&](StringBase& s) { s << v; }); return *this; }
+        Rope& operator<<(double v) { appendWith([&](StringBase& s) { s << v; }); return *this; }
+        Rope& operator<<(const HexManip& m) { appendWith([&](StringBase& s) { s << m; }); return *this; }
+        Rope& operator<<(const FixedManip& m) { appendWith([&](StringBase& s) { s << m; }); return *this; }
+        Rope& operator<<(const PadManip& m) { appendWith([&](StringBase& s) { s << m; }); return *this; }
+        /// 바이트 덤프는 블록 크기에 맞춰 나눠 기록합니다. (긴 패킷도 잘리지 않음)
+        Rope& operator<<(const BytesManip& m);
+
+        /// [spans] 블록별 구간을 배열에 채웁니다. (Scatter-Gather 전송용)
+        ///
+        /// @param out 결과 배열
+        /// @param maxSpans 배열 크기
+        /// @return 채운 구간 수 (segmentCount()보다 작으면 배열이 부족한 것)
+        size_t spans(Span* out, size_t maxSpans) const noexcept;
+
+        /// [forEachSpan] 구간마다 fn(const char* data, size_t len)을 호출합니다.
+        template<typename Fn>
+        void forEachSpan(Fn&& fn) const {
+            for (const Segment* seg = _head; seg; seg = seg->next) {
+                if (seg->len > 0) fn(seg->data(), seg->len);
+            }
+        }
+
+        /// [copyTo] 내용을 연속 버퍼로 복사합니다. (디버깅이나 작은 결과 확인용)
+        ///
+        /// @param dest 대상 문자열 (기존 내용 뒤에 덧붙이며, 용량을 넘는 부분은 잘림)
+        void copyTo(StringBase& dest) const;
+
+    private:
+        /// 블록 앞부분에 놓이는 헤더입니다. 데이터는 헤더 바로 뒤에 이어집니다.
+        struct Segment {
+            Segment* next; ///< 다음 블록
+            size_t len;    ///< 기록된 바이트 수
+            char* data() noexcept { return reinterpret_cast<char*>(this + 1); }
+            const char* data() const noexcept { return reinterpret_cast<const char*>(this + 1); }
+        };
+
+        /// 블록 하나에 기록할 수 있는 데이터 바이트 수
+        size_t payload() const noexcept { return _pool.blockSize() - sizeof(Segment); }
+        /// 마지막 블록의 남은 바이트 수 (블록이 없으면 0)
+        size_t tailRoom() const noexcept { return _tail ? payload() - _tail->len : 0; }
+        /// 마지막 블록의 기록 위치
+        char* tailData() noexcept { return _tail->data() + _tail->len; }
+        /// 스테이징 블록을 반환합니다. (처음 호출 시 풀에서 빌림, 실패 시 잘림 플래그 설정 후 nullptr)
+        char* stageBuffer() noexcept;
+        /// 마지막 블록에 기록한 n바이트를 확정합니다.
+        void commit(size_t n) noexcept { _tail->len += n; _length += n; }
+        /// 새 블록을 빌려 체인 끝에 연결합니다. (풀이 비었으면 잘림 플래그 설정 후 false)
+        bool grow() noexcept;
+
+        BlockPoolBase& _pool; ///< 블록 공급원
+        Segment* _head;       ///< 첫 블록
+        Segment* _tail;       ///< 마지막 블록 (기록 위치)
+        char* _stage;         ///< 포맷 조각을 만드는 스테이징 블록 (지연 획득)
+        size_t _length;       ///< 전체 바이트 길이
+        size_t _segments;     ///< 블록 수
+        bool _truncated;      ///< 풀 부족으로 잘림 발생 여부
+    };
+
+} // namespace cms
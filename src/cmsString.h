@@ -10,6 +10,7 @@
 #include <cstring>   // strlen, memcpy, memmove
 #include "cmsStringUtil.h" // cms::string helpers (UTF-8, regex, etc.)
 #include "cmsStringBase.h" // StringBase API
+#include "cmsStringRef.h"  // 외부 버퍼용 StringRef
 
 namespace cms {
 
@@ -82,7 +83,8 @@ namespace cms {
         /// C 스타일 문자열 포인터로부터 객체를 생성합니다.
         ///
         /// Why: 외부에서 전달된 문자열 포인터를 기반으로 객체를 생성하기 위함입니다.
-        /// How: 대입 연산자를 호출하여 안전하게 데이터를 복사합니다.
+        /// How: 빈 상태(길이 0)로 베이스를 초기화한 뒤 대입 연산자로 복사합니다.
+        ///      (초기화되지 않은 _data에 strlen을 수행하지 않도록 길이를 명시합니다)
         ///
         /// 사용 예:
         /// @code
@@ -90,15 +92,37 @@ namespace cms {
         /// @endcode
         ///
         /// @param src 복사할 원본 문자열 포인터
-        String(const char* src) : StringBase(_data, N) {
+        String(const char* src) : StringBase(_data, N, 0) {
+            _data[0] = '\0';
             *this = src;
         }
 
+        /// 같은 크기의 String 객체를 복사 생성합니다.
+        ///
+        /// Why: 암시적 복사 생성자는 _buf 포인터까지 복사하므로, 사본이 원본의 버퍼를 가리키게 됩니다.
+        ///      (operator+처럼 사본을 만들어 수정하는 코드가 원본을 함께 변경하는 문제가 있었습니다)
+        /// How: 자신의 _data를 베이스에 주입한 뒤 내용만 복사합니다.
+        String(const String& other) : StringBase(_data, N, 0) {
+            StringBase::operator=(other);
+        }
+
+        /// 다른 크기(M)의 String 객체를 복사 생성합니다. (용량을 넘는 부분은 잘림)
+        template<size_t M>
+        String(const String<M>& other) : StringBase(_data, N, 0) {
+            _data[0] = '\0';
+            append(other.c_str(), other.length());
+        }
+
         /// Token 객체로부터 객체를 생성합니다.
         String(const cms::string::Token& token) : StringBase(_data, N, 0) {
             *this = token;
         }
 
+        /// StringView로부터 객체를 생성합니다. (NUL 종료 불필요, strlen 없음)
+        String(StringView view) : StringBase(_data, N, 0) {
+            *this = view;
+        }
+
         // --------------------------------------------------------------------------------------------------
         // [operator=] C 문자열을 대입합니다.
         //
@@ -144,6 +168,16 @@ namespace cms {
             return *this;
         }
 
+        // --------------------------------------------------------------------------------------------------
+        // [operator=] StringView를 대입합니다. (자기 자신의 부분 구간도 안전)
+        //
+        // Usage: s = s.view().substr(4);
+        // --------------------------------------------------------------------------------------------------
+        String& operator=(StringView view) {
+            StringBase::operator=(view);
+            return *this;
+        }
+
         // --------------------------------------------------------------------------------------------------
         // [operator+=] C 문자열을 덧붙입니다.
         //
@@ -183,6 +217,14 @@ namespace cms {
             return *this;
         }
 
+        // --------------------------------------------------------------------------------------------------
+        // [operator+=] StringView를 덧붙입니다.
+        // --------------------------------------------------------------------------------------------------
+        String& operator+=(StringView view) {
+            StringBase::operator+=(view);
+            return *this;
+        }
+
         // --------------------------------------------------------------------------------------------------
         // [operator+] C 문자열을 결합해 새 객체를 반환합니다.
         //
@@ -251,11 +293,19 @@ namespace cms {
         String<N>& operator<<(char c) { StringBase::operator<<(c); return *this; }
         String<N>& operator<<(int v) { StringBase::operator<<(v); return *this; }
         String<N>& operator<<(long v) { StringBase::operator<<(v); return *this; }
+        String<N>& operator<<(unsigned int v) { StringBase::operator<<(v); return *this; }
         String<N>& operator<<(unsigned long v) { StringBase::operator<<(v); return *this; }
+        String<N>& operator<<(long long v) { StringBase::operator<<(v); return *this; }
+        String<N>& operator<<(unsigned long long v) { StringBase::operator<<(v); return *this; }
         String<N>& operator<<(float v) { StringBase::operator<<(v); return *this; }
         String<N>& operator<<(double v) { StringBase::operator<<(v); return *this; }
         String<N>& operator<<(const StringBase& other) { StringBase::operator<<(other); return *this; }
         String<N>& operator<<(const cms::string::Token& token) { StringBase::operator<<(token); return *this; }
+        String<N>& operator<<(StringView view) { StringBase::operator<<(view); return *this; }
+        String<N>& operator<<(const HexManip& m) { StringBase::operator<<(m); return *this; }
+        String<N>& operator<<(const FixedManip& m) { StringBase::operator<<(m); return *this; }
+        String<N>& operator<<(const PadManip& m) { StringBase::operator<<(m); return *this; }
+        String<N>& operator<<(const BytesManip& m) { StringBase::operator<<(m); return *this; }
 
         using StringBase::substring;
         using StringBase::byteSubstring;
@@ -4,9 +4,16 @@
 /// 실제 버퍼를 소유하지 않고 주입된 메모리를 관리함으로써 템플릿 코드 비대화(Code Bloat)를
 /// 방지하고 시스템 자원을 효율적으로 사용합니다.
 
-#include <cstdint>              // uint16_t 정의
+#include <cstdint>              // uint16_t, SIZE_MAX 정의
 #include "cmsStringBase.h"      // 베이스 클래스 정의
 #include "cmsStringUtil.h"      // 문자열 처리 헬퍼 함수
+#include <atomic>               // 전역 잘림 통계
+
+namespace {
+    // 상수 초기화되므로 다른 번역 단위의 정적 String이 생성 중에 잘려도 안전하게 집계됩니다.
+    std::atomic<uint32_t> g_truncationEvents{0};
+    std::atomic<uint32_t> g_truncatedBytes{0};
+}
 
 namespace cms {
 
@@ -28,22 +35,28 @@ namespace cms {
     ///
     /// @param b 문자열 데이터를 저장할 외부 char 배열 포인터
     /// @param c 버퍼의 전체 물리적 용량 (단위: bytes, 널 종료 문자 포함)
-    StringBase::StringBase(char* b, size_t c)
-        : _buf(b), _capacity(static_cast<uint16_t>(c)), _len(0) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>::BasicStringBase(char* b, size_t c)
+        : _buf(b), _capacity(static_cast<SizeT>(c)), _len(0), _truncated(false) {
 #ifdef CMS_ENABLE_PROFILING
         _maxLenSeen = 0;
 #endif
+        invalidateCount();
+        registerSelf();
         if (b) {
-            _len = static_cast<uint16_t>(strlen(b));
+            _len = static_cast<SizeT>(strlen(b));
             updatePeak();
         }
     }
 
-    StringBase::StringBase(char* b, size_t c, size_t l)
-        : _buf(b), _capacity(static_cast<uint16_t>(c)), _len(static_cast<uint16_t>(l)) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>::BasicStringBase(char* b, size_t c, size_t l)
+        : _buf(b), _capacity(static_cast<SizeT>(c)), _len(static_cast<SizeT>(l)), _truncated(false) {
 #ifdef CMS_ENABLE_PROFILING
         _maxLenSeen = _len;
 #endif
+        invalidateCount();
+        registerSelf();
     }
 
     /// 현재 버퍼의 사용량을 퍼센트(%) 단위로 계산합니다.
@@ -57,14 +70,16 @@ namespace cms {
     /// @endcode
     ///
     /// @return 0.0 ~ 100.0 사이의 현재 사용률
-    float StringBase::utilization() const noexcept {
+    template<typename SizeT>
+    float BasicStringBase<SizeT>::utilization() const noexcept {
         if (_capacity <= 1) return 0.0f;
         return (static_cast<float>(_len) / (_capacity - 1)) * 100.0f;
     }
 
 #ifdef CMS_ENABLE_PROFILING
     /// 객체 생성 이후 도달했던 최대 버퍼 사용량을 반환합니다.
-    float StringBase::peakUtilization() const noexcept {
+    template<typename SizeT>
+    float BasicStringBase<SizeT>::peakUtilization() const noexcept {
         if (_capacity <= 1) return 0.0f;
         return (static_cast<float>(_maxLenSeen) / (_capacity - 1)) * 100.0f;
     }
@@ -79,10 +94,15 @@ namespace cms {
     /// @code
     /// s.clear();
     /// @endcode
-    void StringBase::clear() {
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::clear() {
         if (_capacity > 0) {
             _buf[0] = '\0';
             _len = 0;
+#ifdef CMS_ENABLE_COUNT_CACHE
+            _charCount = 0; // 빈 문자열의 글자 수는 확정값이므로 바로 캐시
+#endif
+            invalidateHash();
         }
     }
 
@@ -99,7 +119,8 @@ namespace cms {
     /// @param src 복사할 원본 문자열 포인터
     ///
     /// @return 자기 자신의 참조
-    StringBase& StringBase::operator=(const char* src) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator=(const char* src) {
         clear();
         if (src) append(src, strlen(src));
         return *this;
@@ -118,7 +139,8 @@ namespace cms {
     /// @param other 복사 대상 객체 참조
     ///
     /// @return 자기 자신의 참조
-    StringBase& StringBase::operator=(const StringBase& other) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator=(const BasicStringBase& other) {
         if (this != &other) {
             clear();
             append(other.c_str(), other.length());
@@ -126,16 +148,38 @@ namespace cms {
         return *this;
     }
 
-    StringBase& StringBase::operator=(const cms::string::Token& token) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator=(const cms::string::Token& token) {
         clear();
         append(token.ptr, token.len);
         return *this;
     }
 
+    /// StringView의 내용을 대입합니다.
+    ///
+    /// Why: s = s.view().substr(2) 처럼 자기 자신의 구간을 대입하는 경우가 흔하기 때문입니다.
+    /// How: clear() 후 append(memcpy)하면 겹친 구간을 덮어쓰므로, memmove로 한 번에 옮깁니다.
+    ///
+    /// @param view 대입할 구간 (NUL 종료 불필요)
+    /// @return 자기 자신의 참조
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator=(StringView view) {
+        size_t n = (_capacity > 1) ? _capacity - 1 : 0;
+        if (view.length() < n) n = view.length();
+        else if (view.length() > n) noteTruncation(view.length() - n);
+        if (n > 0) memmove(_buf, view.data(), n);
+        _len = static_cast<SizeT>(n);
+        _buf[_len] = '\0';
+        invalidateCount();
+        updatePeak();
+        return *this;
+    }
+
     /// 기존 문자열 뒤에 문자열을 결합합니다.
     /// @param src 추가할 문자열 포인터
     /// @return 자기 자신의 참조
-    StringBase& StringBase::operator+=(const char* src) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator+=(const char* src) {
         if (src) append(src, strlen(src));
         return *this;
     }
@@ -143,7 +187,8 @@ namespace cms {
     /// 기존 문자열 뒤에 단일 문자를 결합합니다.
     /// @param c 추가할 문자
     /// @return 자기 자신의 참조
-    StringBase& StringBase::operator+=(char c) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator+=(char c) {
         append(&c, 1);
         return *this;
     }
@@ -151,16 +196,24 @@ namespace cms {
     /// 기존 문자열 뒤에 다른 객체의 내용을 결합합니다.
     /// @param other 추가할 대상 객체
     /// @return 자기 자신의 참조
-    StringBase& StringBase::operator+=(const StringBase& other) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator+=(const BasicStringBase& other) {
         append(other.c_str(), other.length());
         return *this;
     }
 
-    StringBase& StringBase::operator+=(const cms::string::Token& token) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator+=(const cms::string::Token& token) {
         append(token.ptr, token.len);
         return *this;
     }
 
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator+=(StringView view) {
+        append(view.data(), view.length());
+        return *this;
+    }
+
     /// 데이터를 안전하게 덧붙이는 핵심 로직입니다.
     ///
     /// Why: 버퍼 경계를 넘지 않으면서 데이터를 효율적으로 추가하기 위함입니다.
@@ -173,31 +226,50 @@ namespace cms {
     ///
     /// @param s 추가할 데이터 포인터
     /// @param len 추가할 데이터의 바이트 길이
-    void StringBase::append(const char* s, size_t len) {
-        if (!s || len == 0 || _capacity <= 1) return;
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::append(const char* s, size_t len) {
+        if (!s || len == 0) return;
+        if (_capacity <= 1) {
+            noteTruncation(len);
+            return;
+        }
 
         // [최적화] 외부 유틸리티 호출 대신 직접 memcpy 수행 (함수 호출 오버헤드 제거)
         size_t available = (_len < _capacity - 1) ? (_capacity - 1 - _len) : 0;
         size_t toCopy = (len < available) ? len : available;
+        if (toCopy < len) noteTruncation(len - toCopy);
 
         if (toCopy > 0) {
             memcpy(_buf + _len, s, toCopy);
+#ifdef CMS_ENABLE_COUNT_CACHE
+            // 선두 바이트 수는 구간별로 더할 수 있으므로 캐시가 유효하면 추가분만 집계합니다.
+            if (_charCount != COUNT_INVALID) _charCount += static_cast<SizeT>(cms::string::utf8_strlen(s, toCopy));
+#endif
             _len += toCopy;
             _buf[_len] = '\0';
+            invalidateHash();
             updatePeak();
         }
     }
 
-    void StringBase::append(const cms::string::Token& token) {
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::append(const cms::string::Token& token) {
         append(token.ptr, token.len);
     }
 
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::append(StringView view) {
+        append(view.data(), view.length());
+    }
+
     /// 문자열 양 끝의 공백을 제거합니다.
     ///
     /// Why: 사용자 입력이나 통신 데이터의 불필요한 여백을 정리하기 위함입니다.
     /// How: memmove를 사용하여 데이터를 재배치하는 In-place 수정 방식입니다.
-    void StringBase::trim() {
-        _len = cms::string::trim(_buf);
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::trim() {
+        _len = static_cast<SizeT>(cms::string::trim(_buf, _len));
+        invalidateCount();
         updatePeak();
     }
 
@@ -205,12 +277,18 @@ namespace cms {
     /// @param prefix 찾을 접두사
     /// @param ignoreCase 대소문자 무시 여부
     /// @return 일치 여부
-    bool StringBase::startsWith(const char* prefix, bool ignoreCase) const {
+    template<typename SizeT>
+    bool BasicStringBase<SizeT>::startsWith(const char* prefix, bool ignoreCase) const {
         if (!prefix) return false;
-        size_t pLen = strlen(prefix);
+        return startsWith(StringView(prefix), ignoreCase);
+    }
+
+    /// 길이를 알고 있는 접두사로 시작하는지 확인합니다.
+    template<typename SizeT>
+    bool BasicStringBase<SizeT>::startsWith(StringView prefix, bool ignoreCase) const {
         // [최적화] 접두사가 현재 문자열보다 길면 절대 일치할 수 없음
-        if (pLen > _len) return false;
-        return cms::string::startsWith(_buf, prefix, pLen, ignoreCase);
+        if (prefix.length() > _len) return false;
+        return cms::string::equals(_buf, prefix.length(), prefix.data(), prefix.length(), ignoreCase);
     }
 
     /// 특정 문자열의 논리적 위치를 찾습니다.
@@ -218,60 +296,100 @@ namespace cms {
     /// @param startChar 검색 시작 글자 위치
     /// @param ignoreCase 대소문자 무시 여부
     /// @return 글자 단위 인덱스 (없으면 -1)
-    int StringBase::find(const char* target, size_t startChar, bool ignoreCase) const {
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::find(const char* target, size_t startChar, bool ignoreCase) const {
         if (!target) return -1;
-        return cms::string::find(_buf, _len, target, strlen(target), startChar, ignoreCase);
+        return find(StringView(target), startChar, ignoreCase);
+    }
+
+    /// 길이를 알고 있는 문자열의 논리적 위치를 찾습니다.
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::find(StringView target, size_t startChar, bool ignoreCase) const {
+        return cms::string::find(_buf, _len, target.data(), target.length(), startChar, ignoreCase);
     }
 
     /// 특정 문자의 논리적 위치를 찾습니다.
-    int StringBase::indexOf(char c, size_t startChar, bool ignoreCase) const {
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::indexOf(char c, size_t startChar, bool ignoreCase) const {
         char tmp[2] = {c, '\0'};
         return cms::string::find(_buf, _len, tmp, 1, startChar, ignoreCase);
     }
 
     /// 특정 문자열의 논리적 위치를 찾습니다.
-    int StringBase::indexOf(const char* str, size_t startChar, bool ignoreCase) const {
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::indexOf(const char* str, size_t startChar, bool ignoreCase) const {
         return find(str, startChar, ignoreCase);
     }
 
     /// 마지막으로 나타나는 문자열의 위치를 찾습니다.
-    int StringBase::lastIndexOf(const char* target, bool ignoreCase) const {
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::lastIndexOf(const char* target, bool ignoreCase) const {
         if (!target) return -1;
-        return cms::string::lastIndexOf(_buf, _len, target, strlen(target), ignoreCase);
+        return lastIndexOf(StringView(target), ignoreCase);
+    }
+
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::lastIndexOf(StringView target, bool ignoreCase) const {
+        return cms::string::lastIndexOf(_buf, _len, target.data(), target.length(), ignoreCase);
     }
 
     /// 마지막으로 나타나는 문자의 위치를 찾습니다.
-    int StringBase::lastIndexOf(char c, bool ignoreCase) const {
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::lastIndexOf(char c, bool ignoreCase) const {
         char tmp[2] = {c, '\0'};
         return cms::string::lastIndexOf(_buf, _len, tmp, 1, ignoreCase);
     }
 
     /// 특정 문자열 포함 여부를 확인합니다.
-    bool StringBase::contains(const char* target, bool ignoreCase) const {
+    template<typename SizeT>
+    bool BasicStringBase<SizeT>::contains(const char* target, bool ignoreCase) const {
         if (!target) return false;
-        return cms::string::contains(_buf, _len, target, strlen(target), ignoreCase);
+        return contains(StringView(target), ignoreCase);
+    }
+
+    template<typename SizeT>
+    bool BasicStringBase<SizeT>::contains(StringView target, bool ignoreCase) const {
+        return cms::string::contains(_buf, _len, target.data(), target.length(), ignoreCase);
     }
 
     /// 정규표현식 패턴과 일치하는지 확인합니다.
-    bool StringBase::matches(const char* pattern) const {
-        return cms::string::matches(_buf, pattern);
+    template<typename SizeT>
+    bool BasicStringBase<SizeT>::matches(const char* pattern) const {
+        return cms::string::matches(_buf, _len, pattern);
     }
 
     /// 특정 접미사로 끝나는지 확인합니다.
-    bool StringBase::endsWith(const char* suffix, bool ignoreCase) const {
+    template<typename SizeT>
+    bool BasicStringBase<SizeT>::endsWith(const char* suffix, bool ignoreCase) const {
         if (!suffix) return false;
-        size_t sLen = strlen(suffix);
-        // [최적화] 접미사가 현재 문자열보다 길면 절대 일치할 수 없음
-        if (sLen > _len) return false;
-        return cms::string::endsWith(_buf, _len, suffix, sLen, ignoreCase);
+        return endsWith(StringView(suffix), ignoreCase);
+    }
+
+    /// 길이를 알고 있는 접미사로 끝나는지 확인합니다.
+    template<typename SizeT>
+    bool BasicStringBase<SizeT>::endsWith(StringView suffix, bool ignoreCase) const {
+        // [최적화] 접미사가 현재 문자열보다 길면 절대 일치할 수 없음 (커널 내부에서도 검사)
+        return cms::string::endsWith(_buf, _len, suffix.data(), suffix.length(), ignoreCase);
     }
 
     /// 문자열 내의 특정 패턴을 모두 치환합니다.
     ///
     /// Why: 텍스트 가공 및 템플릿 치환을 위해 필요합니다.
     /// How: 치환 후 길이가 변할 경우 데이터를 재배치하며 버퍼 크기를 초과하면 중단됩니다.
-    void StringBase::replace(const char* from, const char* to, bool ignoreCase) {
-        _len = cms::string::replace(_buf, _capacity, _len, from, to, ignoreCase);
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::replace(const char* from, const char* to, bool ignoreCase) {
+        if (!from || !to) return;
+        replace(StringView(from), StringView(to), ignoreCase);
+    }
+
+    /// 길이를 알고 있는 패턴/치환 문자열로 모두 치환합니다.
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::replace(StringView from, StringView to, bool ignoreCase) {
+        size_t dropped = 0;
+        _len = static_cast<SizeT>(cms::string::replace(_buf, _capacity, _len, from.data(), from.length(),
+                                                          to.data(), to.length(), ignoreCase, &dropped));
+        if (dropped) noteTruncation(dropped);
+        invalidateCount();
         updatePeak();
     }
 
@@ -283,27 +401,111 @@ namespace cms {
     /// @param val 추가할 정수 값
     /// @param width 최소 출력 너비
     /// @param padChar 채움 문자
-    void StringBase::appendInt(long val, int width, char padChar) {
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::appendInt(long long val, int width, char padChar) {
         size_t curLen = _len;
-        cms::string::appendInt(_buf, _capacity, curLen, val, width, padChar);
-        _len = static_cast<uint16_t>(curLen);
+        const size_t dropped = cms::string::appendInt(_buf, _capacity, curLen, val, width, padChar);
+        if (dropped) noteTruncation(dropped);
+        _len = static_cast<SizeT>(curLen);
+        invalidateCount();
         updatePeak();
     }
 
+    /// 부호 없는 정수 데이터를 텍스트로 변환하여 덧붙입니다.
+    /// @param val 추가할 값 (uint64_t 전체 범위)
+    /// @param width 최소 출력 너비
+    /// @param padChar 채움 문자
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::appendUInt(unsigned long long val, int width, char padChar) {
+        size_t curLen = _len;
+        const size_t dropped = cms::string::appendUInt(_buf, _capacity, curLen, val, width, padChar);
+        if (dropped) noteTruncation(dropped);
+        _len = static_cast<SizeT>(curLen);
+        invalidateCount();
+        updatePeak();
+    }
+
+    /// 바이너리 데이터를 16진수 덤프로 덧붙입니다.
+    /// @return 기록한 원본 바이트 수 (len보다 작으면 잘림으로 기록)
+    template<typename SizeT>
+    size_t BasicStringBase<SizeT>::appendHex(const void* data, size_t len, char separator, bool uppercase) {
+        size_t done = 0;
+        appendWith([&](char* buffer, size_t maxLen, size_t& curLen) {
+            const size_t start = curLen;
+            done = cms::string::appendHexBytes(buffer, maxLen, curLen, data, len, separator, uppercase);
+            if (!data || done == len) return (size_t)0;
+            // 전부 기록했을 때의 길이(바이트당 2자 + 구분자)에서 실제로 기록한 길이를 뺍니다.
+            return len * 2 + (separator ? len - 1 : 0) - (curLen - start);
+        });
+        return done;
+    }
+
+    /// 바이너리 데이터를 Base64로 인코딩하여 덧붙입니다.
+    /// @return 인코딩한 원본 바이트 수 (len보다 작으면 잘림으로 기록)
+    template<typename SizeT>
+    size_t BasicStringBase<SizeT>::appendBase64(const void* data, size_t len, bool urlSafe) {
+        size_t done = 0;
+        appendWith([&](char* buffer, size_t maxLen, size_t& curLen) {
+            const size_t start = curLen;
+            done = cms::string::appendBase64(buffer, maxLen, curLen, data, len, urlSafe);
+            if (!data || done == len) return (size_t)0;
+            return (urlSafe ? (len * 4 + 2) / 3 : (len + 2) / 3 * 4) - (curLen - start);
+        });
+        return done;
+    }
+
+    /// 바이너리 데이터를 Base32로 인코딩하여 덧붙입니다.
+    /// @return 인코딩한 원본 바이트 수 (len보다 작으면 잘림으로 기록)
+    template<typename SizeT>
+    size_t BasicStringBase<SizeT>::appendBase32(const void* data, size_t len) {
+        size_t done = 0;
+        appendWith([&](char* buffer, size_t maxLen, size_t& curLen) {
+            const size_t start = curLen;
+            done = cms::string::appendBase32(buffer, maxLen, curLen, data, len);
+            if (!data || done == len) return (size_t)0;
+            return (len + 4) / 5 * 8 - (curLen - start);
+        });
+        return done;
+    }
+
     /// 실수 데이터를 텍스트로 변환하여 덧붙입니다.
     /// @param val 추가할 실수 값
     /// @param decimalPlaces 소수점 이하 자리수
-    void StringBase::appendFloat(float val, int decimalPlaces) {
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::appendFloat(float val, int decimalPlaces) {
+        appendFloat(val, cms::string::FloatFormat::Fixed, decimalPlaces < 0 ? 0 : decimalPlaces);
+    }
+
+    /// 실수 데이터를 지정한 형식으로 변환하여 덧붙입니다.
+    /// @param val 추가할 실수 값 (Shortest에서 float은 float 정밀도 기준 자릿수 사용)
+    /// @param format 출력 형식
+    /// @param precision 정밀도 (-1이면 형식별 기본값)
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::appendFloat(float val, cms::string::FloatFormat format, int precision) {
         size_t curLen = _len;
-        cms::string::appendFloat(_buf, _capacity, curLen, val, decimalPlaces);
-        _len = static_cast<uint16_t>(curLen);
+        const size_t dropped = cms::string::appendFloat(_buf, _capacity, curLen, val, format, precision);
+        if (dropped) noteTruncation(dropped);
+        _len = static_cast<SizeT>(curLen);
+        invalidateCount();
+        updatePeak();
+    }
+
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::appendFloat(double val, cms::string::FloatFormat format, int precision) {
+        size_t curLen = _len;
+        const size_t dropped = cms::string::appendFloat(_buf, _capacity, curLen, val, format, precision);
+        if (dropped) noteTruncation(dropped);
+        _len = static_cast<SizeT>(curLen);
+        invalidateCount();
         updatePeak();
     }
 
     /// 기존 내용을 지우고 정수 값을 설정합니다.
-    void StringBase::fromInt(long val) { clear(); appendInt(val, 0, ' '); }
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::fromInt(long val) { clear(); appendInt(val, 0, ' '); }
     /// 기존 내용을 지우고 실수 값을 설정합니다.
-    void StringBase::fromFloat(float val, int decimalPlaces) { clear(); appendFloat(val, decimalPlaces); }
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::fromFloat(float val, int decimalPlaces) { clear(); appendFloat(val, decimalPlaces); }
 
     /// 가변 인자 리스트를 사용하여 포맷팅된 문자열을 기존 내용 뒤에 추가합니다.
     ///
@@ -313,16 +515,20 @@ namespace cms {
     /// @param format 포맷 문자열
     /// @param args 가변 인자 리스트
     ///
-    /// @return 포맷팅 후 최종 문자열의 전체 바이트 길이
-    int StringBase::appendPrintf(const char* format, va_list args) {
+    /// @return 공간이 충분했다면 됐을 최종 문자열의 전체 바이트 길이 (length()보다 크면 잘림)
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::appendPrintf(const char* format, va_list args) {
         size_t curLen = _len;
         int ret = cms::string::appendPrintf(_buf, _capacity, curLen, format, args);
-        _len = static_cast<uint16_t>(curLen);
+        if ((size_t)ret > curLen) noteTruncation((size_t)ret - curLen);
+        _len = static_cast<SizeT>(curLen);
+        invalidateCount();
         updatePeak();
         return ret;
     }
 
-    int StringBase::appendPrintf(const char* format, ...) {
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::appendPrintf(const char* format, ...) {
         va_list args;
         va_start(args, format);
         int ret = appendPrintf(format, args);
@@ -340,13 +546,15 @@ namespace cms {
     /// @param format 포맷 문자열
     ///
     /// @return 작성된 문자열의 바이트 길이
-    int StringBase::printf(const char* format, va_list args) {
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::printf(const char* format, va_list args) {
         if (!format) return 0;
         clear();
         return appendPrintf(format, args);
     }
 
-    int StringBase::printf(const char* format, ...) {
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::printf(const char* format, ...) {
         va_list args;
         va_start(args, format);
         int ret = printf(format, args);
@@ -355,106 +563,205 @@ namespace cms {
     }
 
     /// 스트림 스타일로 문자열을 결합합니다.
-    StringBase& StringBase::operator<<(const char* s) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(const char* s) {
         append(s, s ? strlen(s) : 0);
         return *this;
     }
 
     /// 스트림 스타일로 문자를 결합합니다.
-    StringBase& StringBase::operator<<(char c) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(char c) {
         append(&c, 1);
         return *this;
     }
 
     /// 스트림 스타일로 정수를 결합합니다.
-    StringBase& StringBase::operator<<(int v) {
-        appendInt((long)v);
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(int v) {
+        appendInt(v);
         return *this;
     }
 
     /// 스트림 스타일로 long 정수를 결합합니다.
-    StringBase& StringBase::operator<<(long v) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(long v) {
         appendInt(v);
         return *this;
     }
 
+    /// 스트림 스타일로 unsigned int 정수를 결합합니다.
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(unsigned int v) {
+        appendUInt(v);
+        return *this;
+    }
+
     /// 스트림 스타일로 unsigned long 정수를 결합합니다.
-    StringBase& StringBase::operator<<(unsigned long v) {
-        appendInt((long)v);
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(unsigned long v) {
+        appendUInt(v);
+        return *this;
+    }
+
+    /// 스트림 스타일로 long long 정수를 결합합니다.
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(long long v) {
+        appendInt(v);
+        return *this;
+    }
+
+    /// 스트림 스타일로 unsigned long long 정수를 결합합니다.
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(unsigned long long v) {
+        appendUInt(v);
         return *this;
     }
 
     /// 스트림 스타일로 실수를 결합합니다.
-    StringBase& StringBase::operator<<(float v) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(float v) {
         appendFloat(v);
         return *this;
     }
 
     /// 스트림 스타일로 double 실수를 결합합니다.
-    StringBase& StringBase::operator<<(double v) {
-        appendFloat((float)v);
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(double v) {
+        appendFloat(v, cms::string::FloatFormat::Fixed, 2);
         return *this;
     }
 
     /// 스트림 스타일로 다른 객체의 내용을 결합합니다.
-    StringBase& StringBase::operator<<(const StringBase& other) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(const BasicStringBase& other) {
         append(other.c_str(), other.length());
         return *this;
     }
 
-    StringBase& StringBase::operator<<(const cms::string::Token& token) {
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(const cms::string::Token& token) {
         append(token.ptr, token.len);
         return *this;
     }
 
+    /// 스트림 스타일로 StringView 내용을 결합합니다.
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(StringView view) {
+        append(view.data(), view.length());
+        return *this;
+    }
+
+    /// cms::hex() 조작자를 결합합니다. (16진수 커널 직접 호출)
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(const HexManip& m) {
+        appendWith([&](char* buffer, size_t maxLen, size_t& curLen) {
+            return cms::string::appendHex(buffer, maxLen, curLen, m.value, m.width, '0', m.uppercase);
+        });
+        return *this;
+    }
+
+    /// cms::fixed() 조작자를 결합합니다.
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(const FixedManip& m) {
+        appendWith([&](char* buffer, size_t maxLen, size_t& curLen) {
+            if (m.single) {
+                return cms::string::appendFloat(buffer, maxLen, curLen, (float)m.value, cms::string::FloatFormat::Fixed,
+                                                m.precision < 0 ? 0 : m.precision, false, m.width, m.padChar);
+            }
+            return cms::string::appendFloat(buffer, maxLen, curLen, m.value, cms::string::FloatFormat::Fixed,
+                                            m.precision < 0 ? 0 : m.precision, false, m.width, m.padChar);
+        });
+        return *this;
+    }
+
+    /// cms::pad() 조작자를 결합합니다.
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(const PadManip& m) {
+        appendWith([&](char* buffer, size_t maxLen, size_t& curLen) {
+            if (m.negative) {
+                // 절대값이 2^63인 경우도 long long 변환 없이 처리하기 위해 0에서 뺍니다.
+                return cms::string::appendInt(buffer, maxLen, curLen, (long long)(0 - m.magnitude), m.width, m.padChar);
+            }
+            return cms::string::appendUInt(buffer, maxLen, curLen, m.magnitude, m.width, m.padChar);
+        });
+        return *this;
+    }
+
+    /// cms::bytes() 조작자를 결합합니다.
+    template<typename SizeT>
+    BasicStringBase<SizeT>& BasicStringBase<SizeT>::operator<<(const BytesManip& m) {
+        appendHex(m.data, m.len, m.separator, true);
+        return *this;
+    }
+
     /// 특정 글자 위치에 문자열을 끼워 넣습니다.
     ///
     /// How: memmove를 사용하여 기존 데이터를 뒤로 밀어내고 제자리에서 수정합니다.
     /// @param charIdx 삽입할 논리적 글자 위치
     /// @param src 삽입할 문자열 포인터
-    void StringBase::insert(size_t charIdx, const char* src) {
-        if (!src || *src == '\0') return;
-        _len = cms::string::insert(_buf, _capacity, _len, charIdx, src);
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::insert(size_t charIdx, const char* src) {
+        if (!src) return;
+        insert(charIdx, StringView(src));
+    }
+
+    /// 특정 글자 위치에 StringView 내용을 끼워 넣습니다.
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::insert(size_t charIdx, StringView src) {
+        if (src.isEmpty()) return;
+        size_t dropped = 0;
+        _len = static_cast<SizeT>(cms::string::insert(_buf, _capacity, _len, charIdx, src.data(), src.length(), &dropped));
+        if (dropped) noteTruncation(dropped);
+        invalidateCount();
         updatePeak();
         // 삽입 후 버퍼가 가득 찼다면 끝부분의 UTF-8 문자가 잘렸을 가능성이 있으므로 정제 수행
         if (_len >= _capacity - 1) sanitize();
     }
 
     /// 특정 글자 위치에 문자를 끼워 넣습니다.
-    void StringBase::insert(size_t charIdx, char c) {
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::insert(size_t charIdx, char c) {
         if (c == '\0') return;
-        char tmp[2] = {c, '\0'};
-        insert(charIdx, tmp);
+        insert(charIdx, StringView(&c, 1));
     }
 
     /// 특정 구간의 글자들을 삭제합니다.
     /// @param charIdx 삭제 시작 위치
     /// @param charCount 삭제할 글자 수
-    void StringBase::remove(size_t charIdx, size_t charCount) {
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::remove(size_t charIdx, size_t charCount) {
         if (charCount == 0) return;
         _len = cms::string::remove(_buf, _len, charIdx, charCount);
+        invalidateCount();
     }
 
     /// 문자열을 정수로 변환합니다.
     /// @return 변환된 정수 값 (실패 시 0)
-    int StringBase::toInt() const { return cms::string::toInt(_buf, _len); }
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::toInt() const { return cms::string::toInt(_buf, _len); }
 
     /// 문자열을 실수로 변환합니다.
     /// @return 변환된 실수 값 (실패 시 0.0)
-    double StringBase::toFloat() const { return cms::string::toFloat(_buf, _len); }
+    template<typename SizeT>
+    double BasicStringBase<SizeT>::toFloat() const { return cms::string::toFloat(_buf, _len); }
 
     /// 문자열이 유효한 10진수 정수 형식인지 확인합니다.
-    bool StringBase::isDigit() const { return cms::string::isDigit(_buf, _len); }
+    template<typename SizeT>
+    bool BasicStringBase<SizeT>::isDigit() const { return cms::string::isDigit(_buf, _len); }
 
     /// 16진수 문자열을 정수로 변환합니다.
     /// @return 변환된 정수 값 (실패 시 0)
-    int StringBase::hexToInt() const { return cms::string::hexToInt(_buf, _len); }
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::hexToInt() const { return cms::string::hexToInt(_buf, _len); }
 
     /// 문자열이 유효한 16진수 형식인지 확인합니다.
-    bool StringBase::isHex() const { return cms::string::isHex(_buf, _len); }
+    template<typename SizeT>
+    bool BasicStringBase<SizeT>::isHex() const { return cms::string::isHex(_buf, _len); }
 
     /// 문자열이 유효한 실수 형식인지 확인합니다.
-    bool StringBase::isNumeric() const { return cms::string::isNumeric(_buf, _len); }
+    template<typename SizeT>
+    bool BasicStringBase<SizeT>::isNumeric() const { return cms::string::isNumeric(_buf, _len); }
 
     /// 구분자를 기준으로 문자열을 분리합니다.
     ///
@@ -466,54 +773,68 @@ namespace cms {
     /// @param maxTokens 최대 토큰 수
     ///
     /// @return 실제 분리된 토큰 개수
-    size_t StringBase::split(char delimiter, char** tokens, size_t maxTokens) {
-        return cms::string::split(_buf, delimiter, tokens, maxTokens);
+    template<typename SizeT>
+    size_t BasicStringBase<SizeT>::split(char delimiter, char** tokens, size_t maxTokens) {
+        invalidateHash();
+        return cms::string::split(_buf, _len, delimiter, tokens, maxTokens);
     }
 
     /// 비파괴적 분할 래퍼 함수
-    size_t StringBase::split(char delimiter, cms::string::Token* tokens, size_t maxTokens) const {
-        return cms::string::split(_buf, delimiter, tokens, maxTokens);
+    template<typename SizeT>
+    size_t BasicStringBase<SizeT>::split(char delimiter, cms::string::Token* tokens, size_t maxTokens) const {
+        return cms::string::split(_buf, _len, delimiter, tokens, maxTokens);
     }
 
     /// 모든 영문을 대문자로 변환합니다.
-    void StringBase::toUpperCase() { cms::string::toUpperCase(_buf); }
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::toUpperCase() { cms::string::toUpperCase(_buf, _len); invalidateHash(); }
     /// 모든 영문을 소문자로 변환합니다.
-    void StringBase::toLowerCase() { cms::string::toLowerCase(_buf); }
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::toLowerCase() { cms::string::toLowerCase(_buf, _len); invalidateHash(); }
+
+    /// 기본 알고리즘으로 해시를 계산합니다.
+    ///
+    /// How: 캐시가 켜져 있으면 대소문자 구분 결과를 보관하여 내용이 바뀌기 전까지 재계산하지 않습니다.
+    template<typename SizeT>
+    uint32_t BasicStringBase<SizeT>::hash(bool ignoreCase) const {
+#ifdef CMS_ENABLE_HASH_CACHE
+        if (ignoreCase) return cms::string::hash(_buf, _len, true);
+        if (!_hashValid) {
+            _hash = cms::string::hash(_buf, _len);
+            _hashValid = true;
+        }
+        return _hash;
+#else
+        return cms::string::hash(_buf, _len, ignoreCase);
+#endif
+    }
 
     /// 논리적 글자 수를 반환합니다. (UTF-8 인식)
-    size_t StringBase::count() const { return cms::string::utf8_strlen(_buf); }
-
-    /// 지정된 글자 범위를 추출하여 대상 객체에 저장합니다.
-    ///
-    /// How: 대상 객체(dest)의 버퍼에 결과를 직접 쓰고 상태를 업데이트합니다.
-    /// @param dest 결과를 담을 객체 참조
-    /// @param left 시작 글자 인덱스
-    /// @param right 종료 글자 인덱스
-    void StringBase::substring(StringBase& dest, size_t left, size_t right) const {
-        dest.clear();
-        dest._len = cms::string::substring(_buf, dest._buf, dest._capacity, left, right);
-        dest.updatePeak();
-    }
-    /// 물리적 바이트 오프셋 기준으로 부분 문자열을 추출합니다.
-    void StringBase::byteSubstring(StringBase& dest, size_t startByte, size_t endByte) const {
-        dest.clear();
-        if (startByte >= _len) return;
-
-        size_t actualEnd = (endByte == 0 || endByte > _len) ? _len : endByte;
-        if (actualEnd > startByte) {
-            dest.append(_buf + startByte, actualEnd - startByte);
+    ///
+    /// How: NUL 스캔 없이 _len 범위만 벡터화 카운터로 집계하고, 캐시가 켜져 있으면 결과를 보관합니다.
+    template<typename SizeT>
+    size_t BasicStringBase<SizeT>::count() const {
+#ifdef CMS_ENABLE_COUNT_CACHE
+        if (_charCount == COUNT_INVALID) {
+            _charCount = static_cast<SizeT>(cms::string::utf8_strlen(_buf, _len));
         }
-        dest.sanitize(); // 바이트 단위로 잘랐으므로 UTF-8 깨짐 방지를 위해 정제 수행
+        return _charCount;
+#else
+        return cms::string::utf8_strlen(_buf, _len);
+#endif
     }
 
     /// 유효한 UTF-8 인코딩인지 확인합니다.
-    bool StringBase::isValid() const { return cms::string::validateUtf8(_buf); }
+    template<typename SizeT>
+    bool BasicStringBase<SizeT>::isValid() const { return cms::string::validateUtf8(_buf, _len); }
 
     /// 버퍼 끝에서 잘린 멀티바이트 문자를 정제합니다.
     ///
     /// Why: 통신이나 치환 과정에서 한글 바이트가 잘려 깨진 기호가 출력되는 것을 방지합니다.
-    void StringBase::sanitize() {
-        _len = cms::string::sanitizeUtf8(_buf, _capacity);
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::sanitize() {
+        _len = cms::string::sanitizeUtf8(_buf, _capacity, _len);
+        invalidateCount();
         updatePeak();
     }
 
@@ -522,49 +843,99 @@ namespace cms {
     /// Why: 포인터 주소가 아닌 실제 데이터의 동등성을 비교하기 위함입니다.
     /// @param other 비교 대상 문자열
     /// @param ignoreCase 대소문자 무시 여부
-    bool StringBase::equals(const char* other, bool ignoreCase) const {
+    template<typename SizeT>
+    bool BasicStringBase<SizeT>::equals(const char* other, bool ignoreCase) const {
         if (!other) return isEmpty();
-        return cms::string::equals(_buf, _len, other, strlen(other), ignoreCase);
+        return equals(StringView(other), ignoreCase);
     }
 
     /// 문자열 비교 함수 구현
-    int StringBase::compare(const char* other) const {
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::compare(const char* other) const {
         if (!other) return isEmpty() ? 0 : 1;
-        return cms::string::compare(_buf, _len, other, strlen(other));
+        return compare(StringView(other));
     }
 
-    int StringBase::compare(const StringBase& other) const {
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::compare(const BasicStringBase& other) const {
         return cms::string::compare(_buf, _len, other._buf, other._len);
     }
 
     /// 대소문자 무시 비교 함수 구현
-    int StringBase::compareIgnoreCase(const char* other) const {
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::compareIgnoreCase(const char* other) const {
         if (!other) return isEmpty() ? 0 : 1;
-        return cms::string::compareIgnoreCase(_buf, _len, other, strlen(other));
+        return compareIgnoreCase(StringView(other));
     }
 
-    int StringBase::compareIgnoreCase(const StringBase& other) const {
+    template<typename SizeT>
+    int BasicStringBase<SizeT>::compareIgnoreCase(const BasicStringBase& other) const {
         return cms::string::compareIgnoreCase(_buf, _len, other._buf, other._len);
     }
 
-    void StringBase::updateLength() {
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::updateLength() {
         if (_buf) {
-            _len = static_cast<uint16_t>(strlen(_buf));
+            _len = static_cast<SizeT>(strlen(_buf));
             updatePeak();
         } else {
             _len = 0;
         }
+        invalidateCount();
     }
 
-    /// 외부 문자열과 객체의 비교 연산자입니다.
-    bool operator==(const char* lhs, const StringBase& rhs) {
-        if (!lhs) return rhs.isEmpty();
-        size_t lLen = strlen(lhs);
-        return cms::string::equals(lhs, lLen, rhs._buf, rhs._len, false);
+    /// 잘림 플래그를 세우고 전역 통계(및 레지스트리 횟수)에 더합니다.
+    ///
+    /// How: 잘림이 일어난 경로에서만 호출되므로 원자적 연산 비용은 정상 경로에 영향을 주지 않습니다.
+    template<typename SizeT>
+    void BasicStringBase<SizeT>::noteTruncation(size_t dropped) {
+        _truncated = true;
+#ifdef CMS_ENABLE_STRING_REGISTRY
+        _registryHook.truncations++;
+#endif
+        g_truncationEvents.fetch_add(1, std::memory_order_relaxed);
+        g_truncatedBytes.fetch_add(static_cast<uint32_t>(dropped), std::memory_order_relaxed);
+    }
+
+    TruncationStats truncationStats() noexcept {
+        return TruncationStats{g_truncationEvents.load(std::memory_order_relaxed), g_truncatedBytes.load(std::memory_order_relaxed)};
+    }
+
+    void resetTruncationStats() noexcept {
+        g_truncationEvents.store(0, std::memory_order_relaxed);
+        g_truncatedBytes.store(0, std::memory_order_relaxed);
     }
 
-    /// 외부 문자열과 객체의 불일치 연산자입니다.
-    bool operator!=(const char* lhs, const StringBase& rhs) {
-        return !(lhs == rhs);
+    // 길이 타입별 명시적 인스턴스화: 템플릿 본문은 이 번역 단위에서만 생성됩니다. (Thin Template)
+    template class BasicStringBase<uint16_t>;
+#if SIZE_MAX > UINT16_MAX
+    template class BasicStringBase<size_t>;
+#endif
+
+#ifdef CMS_ENABLE_STRING_REGISTRY
+namespace registry {
+namespace detail {
+    template<typename SizeT>
+    static void readFrom(const BasicStringBase<SizeT>& s, const StringRegistryHook& hook, StringStats& out) noexcept {
+        out.name = hook.name;
+        out.address = hook.owner;
+        out.capacity = s.capacity();
+        out.length = s.length();
+        out.peak = s.peakLength();
+        out.truncations = hook.truncations;
+    }
+
+    /// 훅의 길이 타입 표시(wide)로 주인 객체의 실제 타입을 골라 통계를 읽습니다.
+    void readStats(const StringRegistryHook& hook, StringStats& out) noexcept {
+#if SIZE_MAX > UINT16_MAX
+        if (hook.wide) {
+            readFrom(*static_cast<const BasicStringBase<size_t>*>(hook.owner), hook, out);
+            return;
+        }
+#endif
+        readFrom(*static_cast<const BasicStringBase<uint16_t>*>(hook.owner), hook, out);
     }
+} // namespace detail
+} // namespace registry
+#endif
 }
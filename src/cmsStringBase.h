@@ -10,7 +10,9 @@
 #include <stdarg.h> // va_list 정의
 #include <cstring>  // strlen, strcpy 등 표준 함수
 #include <cstdint>  // uint16_t 정의
+#include <type_traits> // std::make_unsigned (조작자 팩토리), std::is_void (appendWith)
 #include "cmsStringUtil.h"
+#include "cmsStringView.h"
 
 // 컴파일러별 printf 포맷 체크 속성
 #if defined(__GNUC__) || defined(__clang__)
@@ -25,27 +27,193 @@
  */
 // #define CMS_ENABLE_PROFILING
 
+/**
+ * @brief 논리적 글자 수(count) 캐시 활성화 여부
+ * 매 프레임 count()를 호출하는 화면 레이아웃 등에서 전체 재스캔을 피하기 위해 사용합니다.
+ * 객체당 2바이트가 추가되며, 내용이 변경되면 캐시는 자동으로 무효화됩니다.
+ */
+// #define CMS_ENABLE_COUNT_CACHE
+
+/**
+ * @brief 해시(hash) 캐시 활성화 여부
+ * 같은 키 문자열로 해시 테이블을 반복 조회하는 경우 재계산을 피하기 위해 사용합니다.
+ * 객체당 8바이트(정렬 포함)가 추가되며, 대소문자 구분 해시만 캐시합니다.
+ */
+// #define CMS_ENABLE_HASH_CACHE
+
+/**
+ * @brief 전역 문자열 레지스트리 활성화 여부 (CMS_ENABLE_PROFILING 포함)
+ * 살아 있는 모든 StringBase의 용량/길이/최대 길이/잘림 횟수를 cms::registry로 조회하여 N을 줄일 버퍼를 찾기 위해 사용합니다.
+ * 객체당 훅(포인터 4개 + 카운터)이 추가되고 생성/소멸 시 전역 잠금을 잡으므로, 진단 빌드에서만 켜세요.
+ */
+// #define CMS_ENABLE_STRING_REGISTRY
+
+#if defined(CMS_ENABLE_STRING_REGISTRY) && !defined(CMS_ENABLE_PROFILING)
+#define CMS_ENABLE_PROFILING
+#endif
+
+#ifdef CMS_ENABLE_STRING_REGISTRY
+#include "cmsStringRegistry.h"
+#endif
+
 namespace cms {
 
+// ==================================================================================================
+// [Stream Manipulators] 개요
+// - 왜 존재하는가: operator<<만으로는 너비/채움/16진수/정밀도를 지정할 수 없어 런타임 파싱되는 appendPrintf로 돌아가야 했습니다.
+// - 어떻게 동작하는가: 값과 서식을 담은 작은 구조체를 만들어 operator<<에 넘기면, 해당 커널(appendInt, appendHex, appendFloat)을 직접 호출합니다.
+// ==================================================================================================
+
+    /// cms::hex()가 만드는 16진수 출력 조작자입니다.
+    struct HexManip {
+        unsigned long long value; ///< 출력할 값 (같은 폭의 부호 없는 값으로 변환됨)
+        int width;                ///< 최소 자릿수 ('0'으로 채움)
+        bool uppercase;           ///< A-F 대문자 여부
+    };
+
+    /// cms::fixed()가 만드는 소수점 고정 표기 조작자입니다.
+    struct FixedManip {
+        double value;   ///< 출력할 값
+        int precision;  ///< 소수점 이하 자릿수
+        int width;      ///< 최소 출력 너비
+        char padChar;   ///< 채움 문자
+        bool single;    ///< float 정밀도 기준으로 자릿수를 계산할지 여부
+    };
+
+    /// cms::pad()가 만드는 정수 너비 지정 조작자입니다.
+    struct PadManip {
+        unsigned long long magnitude; ///< 절대값
+        int width;                    ///< 최소 출력 너비 (부호 포함)
+        char padChar;                 ///< 채움 문자
+        bool negative;                ///< 음수 여부
+    };
+
+    /// cms::bytes()가 만드는 16진수 덤프 조작자입니다.
+    struct BytesManip {
+        const void* data; ///< 원본 바이트
+        size_t len;       ///< 원본 바이트 수
+        char separator;   ///< 바이트 사이 구분 문자 ('\0'이면 없음)
+    };
+
+    /// [hex] 정수를 16진수로 출력합니다. (접두사 없음)
+    ///
+    /// 사용 예:
+    /// @code
+    /// s << "ID=" << cms::hex(0xBEEF, 8); // "ID=0000BEEF"
+    /// @endcode
+    ///
+    /// @param v 출력할 정수 (음수는 같은 폭의 2의 보수로 출력)
+    /// @param width 최소 자릿수
+    /// @param uppercase A-F 대문자 여부
+    template<typename T>
+    constexpr HexManip hex(T v, int width = 0, bool uppercase = true) {
+        static_assert(std::is_integral<T>::value, "cms::hex requires an integer value.");
+        return HexManip{(unsigned long long)(typename std::make_unsigned<T>::type)v, width, uppercase};
+    }
+
+    /// [fixed] 실수를 소수점 고정 표기로 출력합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// s << cms::fixed(temp, 3) << " / " << cms::fixed(rh, 1, 6); // "21.500 /   45.0"
+    /// @endcode
+    ///
+    /// @param v 출력할 수 (float는 단정밀도로 반올림, 정수는 double로 변환)
+    /// @param precision 소수점 이하 자릿수
+    /// @param width 최소 출력 너비
+    /// @param padChar 채움 문자 ('0'이면 부호 뒤에 채움)
+    template<typename T>
+    constexpr FixedManip fixed(T v, int precision = 2, int width = 0, char padChar = ' ') {
+        static_assert(std::is_arithmetic<T>::value, "cms::fixed requires an arithmetic value.");
+        return FixedManip{(double)v, precision, width, padChar, std::is_same<T, float>::value};
+    }
+
+    /// [pad] 정수를 지정한 너비에 맞춰 출력합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// s << cms::pad(7, 3, '0') << ':' << cms::pad(-5, 4); // "007:  -5"
+    /// @endcode
+    ///
+    /// @param v 출력할 정수
+    /// @param width 최소 출력 너비 (부호 포함)
+    /// @param padChar 채움 문자
+    template<typename T>
+    constexpr PadManip pad(T v, int width, char padChar = ' ') {
+        static_assert(std::is_integral<T>::value, "cms::pad requires an integer value.");
+        if constexpr (std::is_signed<T>::value) {
+            return PadManip{v < 0 ? (unsigned long long)0 - (unsigned long long)v : (unsigned long long)v, width, padChar, v < 0};
+        } else {
+            return PadManip{(unsigned long long)v, width, padChar, false};
+        }
+    }
+
+    /// [bytes] 바이트 배열을 대문자 16진수 덤프로 출력합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// s << "PKT: " << cms::bytes(packet, len, ' '); // "PKT: 01 A0 FF"
+    /// @endcode
+    ///
+    /// @param data 원본 바이트
+    /// @param len 원본 바이트 수
+    /// @param separator 바이트 사이 구분 문자 ('\0'이면 없음)
+    constexpr BytesManip bytes(const void* data, size_t len, char separator = '\0') {
+        return BytesManip{data, len, separator};
+    }
+
+    /// 모든 StringBase/StringRef의 잘림을 합산한 전역 통계입니다.
+    struct TruncationStats {
+        uint32_t events; ///< 내용이 잘린 쓰기 연산 수
+        uint32_t bytes;  ///< 공간이 부족해 버려진 바이트 합계
+    };
+
+    /// [truncationStats] 부팅(또는 마지막 초기화) 이후의 전역 잘림 통계를 반환합니다.
+    ///
+    /// Why: 현장 장비의 텔레메트리로 버퍼 부족을 집계하여, 깨진 로그나 크래시가 아닌 수치로 N을 정하기 위함입니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// const cms::TruncationStats t = cms::truncationStats();
+    /// telemetry << "trunc=" << t.events << "/" << t.bytes;
+    /// @endcode
+    TruncationStats truncationStats() noexcept;
+    /// 전역 잘림 통계를 0으로 초기화합니다.
+    void resetTruncationStats() noexcept;
+
 // ==================================================================================================
 // [StringBase] 개요
 // - 왜 존재하는가: 다양한 크기의 String 템플릿 객체들이 공통 로직을 공유하여 바이너리 크기를 줄이기 위해 존재합니다.
 // - 어떻게 동작하는가: 외부 버퍼 포인터와 용량 정보를 유지하며, 모든 가공은 cms::string 유틸리티를 통해 수행합니다.
+//                     길이 타입(SizeT)은 uint16_t(String<N>, 객체당 RAM 절약)와 size_t(StringRef, 대형 버퍼) 두 가지만 인스턴스화됩니다.
 // ==================================================================================================
 
     /// 모든 cms::String 객체의 공통 인터페이스와 로직을 정의하는 추상화 계층입니다.
     ///
     /// Why: 코드 중복을 제거하고 문자열 가공 로직을 중앙 집중화하기 위함입니다.
     /// How: 외부에서 주입된 버퍼 포인터를 기반으로 인플레이스(In-place) 가공을 수행합니다.
+    ///      본문은 cmsStringBase.cpp에서 두 길이 타입으로만 명시적 인스턴스화되므로 템플릿이어도 코드가 N별로 늘지 않습니다.
     ///
-    /// @note 직접 인스턴스화할 수 없으며, 반드시 String<N> 자식 클래스를 통해 사용해야 합니다.
-    class StringBase {
+    /// @tparam SizeT 길이/용량 저장 타입 (uint16_t: 최대 64KiB, size_t: 제한 없음)
+    /// @note 직접 인스턴스화할 수 없으며, 반드시 String<N> 또는 StringRef 자식 클래스를 통해 사용해야 합니다.
+    template<typename SizeT>
+    class BasicStringBase {
+        static_assert(std::is_unsigned<SizeT>::value, "cms::BasicStringBase length type must be unsigned.");
+
     public:
         /**
          * @brief 소멸자에서 virtual을 제거하여 vptr(4~8바이트) 오버헤드를 없앱니다.
          * Zero-Heap 정책상 부모 포인터로 객체를 delete할 일이 없으므로 안전합니다.
          */
-        ~StringBase() = default;
+#ifdef CMS_ENABLE_STRING_REGISTRY
+        ~BasicStringBase() { cms::registry::unlink(_registryHook); }
+#else
+        ~BasicStringBase() = default;
+#endif
+
+        /// 버퍼 포인터만 복사되어 두 객체가 같은 메모리를 가리키는 것을 막기 위해 복사 생성을 금지합니다.
+        /// (자식 클래스는 자신의 버퍼로 내용을 복사하는 복사 생성자를 직접 정의합니다)
+        BasicStringBase(const BasicStringBase&) = delete;
 
         /// 현재 버퍼의 사용량을 퍼센트(%) 단위로 계산합니다.
         ///
@@ -73,8 +241,48 @@ namespace cms {
         ///
         /// @return 0.0 ~ 100.0 사이의 최대 사용률 (High Water Mark)
         float peakUtilization() const noexcept;
+
+        /// 객체 생성 이후 도달했던 최대 바이트 길이를 반환합니다.
+        [[nodiscard]] size_t peakLength() const noexcept { return _maxLenSeen; }
 #endif
 
+        /// 레지스트리 보고서에 표시할 이름을 지정합니다. (CMS_ENABLE_STRING_REGISTRY 미정의 시 아무것도 하지 않음)
+        ///
+        /// 사용 예:
+        /// @code
+        /// static cms::String<256> cmdLine;
+        /// cmdLine.setRegistryName("cmdLine");
+        /// @endcode
+        ///
+        /// @param name 이름 (리터럴 권장, 객체보다 오래 살아야 함)
+        void setRegistryName(const char* name) noexcept {
+#ifdef CMS_ENABLE_STRING_REGISTRY
+            _registryHook.name = name;
+#else
+            (void)name;
+#endif
+        }
+
+#ifdef CMS_ENABLE_STRING_REGISTRY
+        /// 용량 부족으로 내용이 잘린 횟수를 반환합니다.
+        [[nodiscard]] uint32_t truncationCount() const noexcept { return _registryHook.truncations; }
+#endif
+
+        /// 용량 부족으로 내용이 잘린 적이 있는지 확인합니다.
+        ///
+        /// Why: 반환값을 확인하지 않는 << 체인에서도, 조립을 마친 뒤 한 번만 검사하면 되도록 하기 위함입니다.
+        /// How: 모든 쓰기 경로(추가, 숫자/실수 변환, 포맷, 삽입, 치환, 대입)가 버린 바이트가 있으면 설정하며,
+        ///      clear()나 대입으로는 지워지지 않고 clearTruncated()로만 해제됩니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// line << tag << ": " << payload;
+        /// if (line.isTruncated()) overflowCount++;
+        /// @endcode
+        [[nodiscard]] bool isTruncated() const noexcept { return _truncated; }
+        /// 잘림 플래그를 해제합니다.
+        void clearTruncated() noexcept { _truncated = false; }
+
         /// 버퍼의 전체 물리적 용량을 반환합니다.
         [[nodiscard]] size_t capacity() const noexcept { return _capacity; }
         /// 현재 저장된 문자열의 바이트 길이를 반환합니다.
@@ -85,6 +293,13 @@ namespace cms {
         [[nodiscard]] const char* c_str() const noexcept { return _buf; }
         /// const char* 타입으로의 암시적 형변환을 지원합니다.
         operator const char*() const noexcept { return _buf; }
+        /// 현재 내용을 가리키는 StringView를 반환합니다. (strlen 없이 _len 사용)
+        ///
+        /// 사용 예:
+        /// @code
+        /// if (rx.contains(cmd.view())) { ... } // const char* 오버로드의 strlen을 피함
+        /// @endcode
+        [[nodiscard]] StringView view() const noexcept { return StringView(_buf, _len); }
 
         /// 문자열을 즉시 비웁니다.
         ///
@@ -93,7 +308,8 @@ namespace cms {
         void clear();
 
         /// 특정 인덱스의 문자에 접근합니다.
-        char& operator[](size_t index) { return _buf[index]; }
+        /// @note 쓰기 가능한 참조를 반환하므로 글자 수 캐시를 무효화합니다. 참조를 보관한 채 수정하지 마세요.
+        char& operator[](size_t index) { invalidateCount(); return _buf[index]; }
         /// 특정 인덱스의 문자에 접근합니다 (읽기 전용).
         const char& operator[](size_t index) const { return _buf[index]; }
 
@@ -105,19 +321,29 @@ namespace cms {
         /// @param src 복사할 원본 문자열 포인터
         ///
         /// @return 자기 자신의 참조
-        StringBase& operator=(const char* src);
+        BasicStringBase& operator=(const char* src);
         /// 다른 StringBase 객체의 내용을 복사 대입합니다.
-        StringBase& operator=(const StringBase& other);
+        BasicStringBase& operator=(const BasicStringBase& other);
         /// Token 객체의 내용을 대입합니다.
-        StringBase& operator=(const cms::string::Token& token);
+        BasicStringBase& operator=(const cms::string::Token& token);
+        /// StringView의 내용을 대입합니다. (자기 자신의 부분 구간도 안전)
+        BasicStringBase& operator=(StringView view);
         /// 문자열을 뒤에 결합합니다.
-        StringBase& operator+=(const char* src);
+        BasicStringBase& operator+=(const char* src);
         /// 단일 문자를 뒤에 결합합니다.
-        StringBase& operator+=(char c);
+        BasicStringBase& operator+=(char c);
         /// 다른 객체의 문자열을 뒤에 결합합니다.
-        StringBase& operator+=(const StringBase& other);
+        BasicStringBase& operator+=(const BasicStringBase& other);
         /// Token 객체의 문자열을 뒤에 결합합니다.
-        StringBase& operator+=(const cms::string::Token& token);
+        BasicStringBase& operator+=(const cms::string::Token& token);
+        /// StringView의 내용을 뒤에 결합합니다.
+        BasicStringBase& operator+=(StringView view);
+        /// 길이 타입이 다른 객체의 문자열을 뒤에 결합합니다. (operator const char*의 strlen 경유 방지)
+        template<typename OtherSizeT>
+        BasicStringBase& operator+=(const BasicStringBase<OtherSizeT>& other) {
+            append(other.view());
+            return *this;
+        }
 
         /// 기존 문자열 뒤에 지정된 길이만큼 데이터를 고속으로 덧붙입니다.
         ///
@@ -131,6 +357,37 @@ namespace cms {
         void append(const char* s, size_t len);
         /// Token 객체의 데이터를 덧붙입니다.
         void append(const cms::string::Token& token);
+        /// StringView의 데이터를 덧붙입니다.
+        void append(StringView view);
+        /// 다른 객체(길이 타입 무관)의 데이터를 저장된 길이로 덧붙입니다.
+        template<typename OtherSizeT>
+        void append(const BasicStringBase<OtherSizeT>& other) { append(other.view()); }
+
+        /// cms::string의 버퍼 커널(buffer, maxLen, curLen)로 내용을 덧붙이고 길이와 통계를 한 번에 동기화합니다.
+        ///
+        /// Why: 여러 커널 호출을 이어 붙일 때 호출마다 _len 갱신과 캐시 무효화를 반복하지 않기 위함입니다.
+        /// How: 현재 길이를 복사해 fn에 넘기고, 반환 후 appendInt와 같은 방식으로 _len을 반영합니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// s.appendWith([&](char* b, size_t m, size_t& n) { cms::string::appendHex(b, m, n, id, 8, '0'); });
+        /// @endcode
+        ///
+        /// @param fn void(char* buffer, size_t maxLen, size_t& curLen) 형태의 호출 가능 객체
+        ///           (size_t를 반환하면 커널과 같이 버려진 바이트 수로 보고 잘림을 기록)
+        template<typename Fn>
+        void appendWith(Fn&& fn) {
+            size_t curLen = _len;
+            if constexpr (std::is_void<decltype(fn(_buf, (size_t)_capacity, curLen))>::value) {
+                fn(_buf, (size_t)_capacity, curLen);
+            } else {
+                const size_t dropped = static_cast<size_t>(fn(_buf, (size_t)_capacity, curLen));
+                if (dropped) noteTruncation(dropped);
+            }
+            _len = static_cast<SizeT>(curLen);
+            invalidateCount();
+            updatePeak();
+        }
 
         /// 문자열 양 끝의 공백 및 제어 문자를 제거합니다.
         ///
@@ -145,6 +402,8 @@ namespace cms {
         ///
         /// @return true: 접두사 일치, false: 불일치
         bool startsWith(const char* prefix, bool ignoreCase = false) const;
+        /// 길이를 알고 있는 접두사 확인 (NUL 종료 불필요, strlen 없음)
+        bool startsWith(StringView prefix, bool ignoreCase = false) const;
 
         /// 문자열 리터럴 전용 접두사 확인 (최적화)
         /// Why: 컴파일 타임에 길이를 알 수 있어 strlen 호출을 생략하고 조기 종료가 가능합니다.
@@ -165,11 +424,15 @@ namespace cms {
         ///
         /// @return 0부터 시작하는 글자 단위 인덱스 (찾지 못하면 -1)
         int find(const char* target, size_t startChar = 0, bool ignoreCase = false) const;
+        /// 길이를 알고 있는 문자열의 논리적 글자 위치를 찾습니다. (NUL 종료 불필요, strlen 없음)
+        int find(StringView target, size_t startChar = 0, bool ignoreCase = false) const;
 
         /// 특정 문자가 처음 나타나는 논리적 위치를 찾습니다.
         int indexOf(char c, size_t startChar = 0, bool ignoreCase = false) const;
         /// 특정 문자열이 처음 나타나는 논리적 위치를 찾습니다.
         int indexOf(const char* str, size_t startChar = 0, bool ignoreCase = false) const;
+        /// StringView가 처음 나타나는 논리적 위치를 찾습니다.
+        int indexOf(StringView str, size_t startChar = 0, bool ignoreCase = false) const { return find(str, startChar, ignoreCase); }
         /// 문자열 리터럴 전용 indexOf (최적화)
         template<size_t M>
         int indexOf(const char (&str)[M], size_t startChar = 0, bool ignoreCase = false) const {
@@ -178,6 +441,8 @@ namespace cms {
 
         /// 특정 문자열이 마지막으로 나타나는 위치를 찾습니다.
         int lastIndexOf(const char* target, bool ignoreCase = false) const;
+        /// StringView가 마지막으로 나타나는 위치를 찾습니다.
+        int lastIndexOf(StringView target, bool ignoreCase = false) const;
         /// 문자열 리터럴 전용 lastIndexOf (최적화)
         template<size_t M>
         int lastIndexOf(const char (&target)[M], bool ignoreCase = false) const {
@@ -188,6 +453,8 @@ namespace cms {
 
         /// 특정 문자열이 포함되어 있는지 확인합니다.
         bool contains(const char* target, bool ignoreCase = false) const;
+        /// StringView가 포함되어 있는지 확인합니다.
+        bool contains(StringView target, bool ignoreCase = false) const;
         /// 문자열 리터럴 전용 contains (최적화)
         template<size_t M>
         bool contains(const char (&target)[M], bool ignoreCase = false) const {
@@ -199,6 +466,8 @@ namespace cms {
 
         /// 문자열이 특정 접미사로 끝나는지 확인합니다.
         bool endsWith(const char* suffix, bool ignoreCase = false) const;
+        /// 길이를 알고 있는 접미사 확인 (NUL 종료 불필요, strlen 없음)
+        bool endsWith(StringView suffix, bool ignoreCase = false) const;
 
         /// 문자열 리터럴 전용 접미사 확인 (최적화)
         /// Why: 컴파일 타임에 길이를 알 수 있어 strlen 호출을 생략하고 조기 종료가 가능합니다.
@@ -213,6 +482,8 @@ namespace cms {
         /// Why: 텍스트 가공 및 템플릿 치환 기능을 제공하기 위함입니다.
         /// How: 치환 후 길이가 변할 경우 데이터를 재배치하며 버퍼 크기를 초과하면 중단됩니다.
         void replace(const char* from, const char* to, bool ignoreCase = false);
+        /// 길이를 알고 있는 패턴/치환 문자열로 모두 치환합니다. (NUL 종료 불필요)
+        void replace(StringView from, StringView to, bool ignoreCase = false);
 
         /// 정수 값을 문자열로 변환하여 기존 내용 뒤에 덧붙입니다.
         ///
@@ -221,9 +492,55 @@ namespace cms {
         /// @param val 추가할 숫자 값
         /// @param width 최소 출력 너비 (단위: chars)
         /// @param padChar 채움 문자 (예: '0', ' ')
-        void appendInt(long val, int width = 0, char padChar = ' ');
+        void appendInt(long long val, int width = 0, char padChar = ' ');
+        void appendInt(int val, int width = 0, char padChar = ' ') { appendInt((long long)val, width, padChar); }
+        void appendInt(long val, int width = 0, char padChar = ' ') { appendInt((long long)val, width, padChar); }
+        void appendInt(unsigned int val, int width = 0, char padChar = ' ') { appendUInt((unsigned long long)val, width, padChar); }
+        void appendInt(unsigned long val, int width = 0, char padChar = ' ') { appendUInt((unsigned long long)val, width, padChar); }
+        void appendInt(unsigned long long val, int width = 0, char padChar = ' ') { appendUInt(val, width, padChar); }
+        /// 부호 없는 정수 값(uint64_t 전체 범위)을 문자열로 변환하여 기존 내용 뒤에 덧붙입니다.
+        void appendUInt(unsigned long long val, int width = 0, char padChar = ' ');
+
+        /// 바이너리 데이터를 16진수 덤프로 덧붙입니다.
+        ///
+        /// Why: 바이트마다 appendPrintf("%02X")를 호출하면 포맷 파서가 바이트 수만큼 반복 실행되기 때문입니다.
+        /// How: 남은 용량에 들어가는 바이트 수를 먼저 계산하고 SIMD/테이블 커널로 버퍼에 직접 기록합니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// if (s.appendHex(packet, len, ' ') < len) s << "...";
+        /// @endcode
+        ///
+        /// @param data 원본 바이트
+        /// @param len 원본 바이트 수
+        /// @param separator 바이트 사이 구분 문자 ('\0'이면 없음)
+        /// @param uppercase A-F 대문자 여부
+        /// @return 기록한 원본 바이트 수 (len보다 작으면 용량 부족으로 잘림)
+        size_t appendHex(const void* data, size_t len, char separator = '\0', bool uppercase = true);
+
+        /// 바이너리 데이터를 Base64로 인코딩하여 덧붙입니다.
+        /// @param urlSafe true이면 URL-safe 문자('-', '_')를 쓰고 패딩을 생략합니다.
+        /// @return 인코딩한 원본 바이트 수 (len보다 작으면 잘림, 3바이트 단위)
+        size_t appendBase64(const void* data, size_t len, bool urlSafe = false);
+
+        /// 바이너리 데이터를 Base32로 인코딩하여 덧붙입니다.
+        /// @return 인코딩한 원본 바이트 수 (len보다 작으면 잘림, 5바이트 단위)
+        size_t appendBase32(const void* data, size_t len);
         /// 실수 값을 문자열로 변환하여 기존 내용 뒤에 덧붙입니다.
         void appendFloat(float val, int decimalPlaces = 2);
+        /// 실수 값을 지정한 형식(고정/지수/%g/왕복)으로 변환하여 기존 내용 뒤에 덧붙입니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// json << "{\"t\":";
+        /// json.appendFloat(temperature, cms::string::FloatFormat::Shortest);
+        /// @endcode
+        ///
+        /// @param val 추가할 실수 값 (Shortest에서 float은 float 정밀도 기준 자릿수 사용)
+        /// @param format 출력 형식
+        /// @param precision 정밀도 (-1이면 6, Shortest에서는 무시)
+        void appendFloat(float val, cms::string::FloatFormat format, int precision = -1);
+        void appendFloat(double val, cms::string::FloatFormat format, int precision = -1);
 
         /// 기존 내용을 모두 지우고 정수 값을 문자열로 설정합니다.
         void fromInt(long val);
@@ -237,12 +554,12 @@ namespace cms {
         /// @param format printf 스타일 포맷 문자열
         /// @param args 가변 인자 리스트
         ///
-        /// @return 포맷팅 후 최종 문자열의 전체 바이트 길이
+        /// @return 공간이 충분했다면 됐을 최종 문자열의 전체 바이트 길이 (snprintf와 같이, length()보다 크면 잘림)
         int appendPrintf(const char* format, va_list args);
 
         /// 가변 인자를 받아 포맷팅된 문자열을 기존 내용 뒤에 추가합니다.
         /// @param format printf 스타일 포맷 문자열
-        /// @return 추가된 문자열의 바이트 길이
+        /// @return 공간이 충분했다면 됐을 최종 문자열의 전체 바이트 길이
         int appendPrintf(const char* format, ...) CMS_PRINTF_CHECK(2, 3);
 
         /// 가변 인자 리스트를 사용하여 포맷팅된 문자열을 버퍼에 씁니다. (기존 내용 삭제)
@@ -259,43 +576,59 @@ namespace cms {
         ///
         /// @param format printf 스타일 포맷 문자열
         ///
-        /// @return 최종적으로 작성된 문자열의 바이트 길이
+        /// @return 공간이 충분했다면 됐을 문자열의 바이트 길이 (length()보다 크면 잘림)
         int printf(const char* format, ...) CMS_PRINTF_CHECK(2, 3);
 
         /// 스트림 스타일로 문자열을 결합합니다.
-        StringBase& operator<<(const char* s);
+        BasicStringBase& operator<<(const char* s);
 
         /// 문자열 리터럴 전용 스트림 연산자입니다. (최적화)
         /// Why: 컴파일 타임에 길이를 알 수 있는 리터럴은 strlen 호출을 생략합니다.
         template<size_t M>
-        StringBase& operator<<(const char (&s)[M]) {
+        BasicStringBase& operator<<(const char (&s)[M]) {
             append(s, M - 1);
             return *this;
         }
 
         /// 문자열 리터럴 전용 결합 연산자입니다. (최적화)
         template<size_t M>
-        StringBase& operator+=(const char (&s)[M]) {
+        BasicStringBase& operator+=(const char (&s)[M]) {
             append(s, M - 1);
             return *this;
         }
 
         /// 스트림 스타일로 문자를 결합합니다.
-        StringBase& operator<<(char c);
+        BasicStringBase& operator<<(char c);
         /// 스트림 스타일로 정수를 결합합니다.
-        StringBase& operator<<(int v);
+        BasicStringBase& operator<<(int v);
         /// 스트림 스타일로 long 정수를 결합합니다.
-        StringBase& operator<<(long v);
+        BasicStringBase& operator<<(long v);
+        /// 스트림 스타일로 unsigned int 정수를 결합합니다.
+        BasicStringBase& operator<<(unsigned int v);
         /// 스트림 스타일로 unsigned long 정수를 결합합니다.
-        StringBase& operator<<(unsigned long v);
+        BasicStringBase& operator<<(unsigned long v);
+        /// 스트림 스타일로 long long(int64_t) 정수를 결합합니다.
+        BasicStringBase& operator<<(long long v);
+        /// 스트림 스타일로 unsigned long long(uint64_t) 정수를 결합합니다.
+        BasicStringBase& operator<<(unsigned long long v);
         /// 스트림 스타일로 실수를 결합합니다.
-        StringBase& operator<<(float v);
+        BasicStringBase& operator<<(float v);
         /// 스트림 스타일로 double 실수를 결합합니다.
-        StringBase& operator<<(double v);
+        BasicStringBase& operator<<(double v);
         /// 스트림 스타일로 다른 객체의 내용을 결합합니다.
-        StringBase& operator<<(const StringBase& other);
+        BasicStringBase& operator<<(const BasicStringBase& other);
         /// 스트림 스타일로 Token 내용을 결합합니다.
-        StringBase& operator<<(const cms::string::Token& token);
+        BasicStringBase& operator<<(const cms::string::Token& token);
+        /// 스트림 스타일로 StringView 내용을 결합합니다.
+        BasicStringBase& operator<<(StringView view);
+        /// cms::hex() 조작자를 결합합니다.
+        BasicStringBase& operator<<(const HexManip& m);
+        /// cms::fixed() 조작자를 결합합니다.
+        BasicStringBase& operator<<(const FixedManip& m);
+        /// cms::pad() 조작자를 결합합니다.
+        BasicStringBase& operator<<(const PadManip& m);
+        /// cms::bytes() 조작자를 결합합니다.
+        BasicStringBase& operator<<(const BytesManip& m);
 
         /// 특정 글자 위치에 새로운 문자열을 끼워 넣습니다.
         ///
@@ -304,6 +637,8 @@ namespace cms {
         /// @param charIdx 삽입할 논리적 글자 위치 (범위: 0 ~ count())
         /// @param src 삽입할 문자열 포인터
         void insert(size_t charIdx, const char* src);
+        /// 특정 글자 위치에 StringView 내용을 끼워 넣습니다.
+        void insert(size_t charIdx, StringView src);
         /// 특정 글자 위치에 문자를 끼워 넣습니다.
         void insert(size_t charIdx, char c);
 
@@ -358,9 +693,27 @@ namespace cms {
         void toLowerCase();
 
         /// 문자열의 논리적 글자 수를 반환합니다.
+        ///
+        /// How: 알고 있는 _len을 사용해 벡터화된 카운터로 집계하며,
+        ///      CMS_ENABLE_COUNT_CACHE 활성 시 결과를 캐시하여 변경 전까지 O(1)로 반환합니다.
         /// @return 논리적 글자 수 (UTF-8 인식)
         size_t count() const;
 
+        /// 기본 알고리즘(CMS_HASH_DEFAULT)으로 해시를 계산합니다.
+        ///
+        /// How: _len 범위만 해시하며, CMS_ENABLE_HASH_CACHE 활성 시 대소문자 구분 결과를 변경 전까지 캐시합니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// using namespace cms::literals;
+        /// switch (cmd.hash()) {
+        ///     case "reboot"_hash: ...
+        /// }
+        /// @endcode
+        ///
+        /// @param ignoreCase true면 ASCII 대소문자를 무시합니다. (대문자로 접어서 계산)
+        uint32_t hash(bool ignoreCase = false) const;
+
         /// 현재 문자열이 표준 UTF-8 인코딩 규칙을 준수하는지 검증합니다.
         /// @return true: 유효한 UTF-8, false: 깨진 바이트 포함
         bool isValid() const;
@@ -373,20 +726,42 @@ namespace cms {
 
         /// 지정된 글자 범위를 추출하여 대상 객체에 저장합니다.
         ///
-        /// @param dest 결과를 담을 StringBase 객체 참조
+        /// Why: StringRef(size_t)에서 String<N>(uint16_t)으로처럼 길이 타입이 다른 대상에도 바로 추출하기 위함입니다.
+        ///
+        /// @param dest 결과를 담을 StringBase 객체 참조 (길이 타입 무관)
         /// @param left 시작 글자 인덱스 (범위: 0 ~ count())
         /// @param right 종료 글자 인덱스 (0일 경우 끝까지)
-        void substring(StringBase& dest, size_t left, size_t right = 0) const;
+        template<typename DestSizeT>
+        void substring(BasicStringBase<DestSizeT>& dest, size_t left, size_t right = 0) const {
+            dest.clear();
+            dest._len = static_cast<DestSizeT>(cms::string::substring(_buf, _len, dest._buf, dest._capacity, left, right));
+            dest.invalidateCount();
+            dest.updatePeak();
+        }
 
         /// 물리적 바이트 오프셋을 기준으로 부분 문자열을 추출합니다.
         ///
-        /// @param dest 결과를 담을 StringBase 객체 참조
+        /// @param dest 결과를 담을 StringBase 객체 참조 (길이 타입 무관)
         /// @param startByte 시작 바이트 위치 (범위: 0 ~ length())
         /// @param endByte 종료 바이트 위치 (0일 경우 끝까지)
-        void byteSubstring(StringBase& dest, size_t startByte, size_t endByte = 0) const;
+        template<typename DestSizeT>
+        void byteSubstring(BasicStringBase<DestSizeT>& dest, size_t startByte, size_t endByte = 0) const {
+            dest.clear();
+            if (startByte >= _len) return;
+
+            size_t actualEnd = (endByte == 0 || endByte > _len) ? _len : endByte;
+            if (actualEnd > startByte) {
+                dest.append(_buf + startByte, actualEnd - startByte);
+            }
+            dest.sanitize(); // 바이트 단위로 잘랐으므로 UTF-8 깨짐 방지를 위해 정제 수행
+        }
 
         /// 문자열 내용의 일치 여부를 확인합니다.
         bool equals(const char* other, bool ignoreCase = false) const;
+        /// StringView와 내용 일치 여부를 확인합니다. (길이가 다르면 즉시 false)
+        bool equals(StringView other, bool ignoreCase = false) const {
+            return cms::string::equals(_buf, _len, other.data(), other.length(), ignoreCase);
+        }
         /// 문자열 리터럴 전용 비교 최적화
         /// Why: 컴파일 타임에 길이를 알 수 있어 strlen 호출을 생략합니다.
         template<size_t M>
@@ -411,13 +786,22 @@ namespace cms {
             return !equals(other, false);
         }
         /// 객체 간 비교 연산자입니다.
-        bool operator==(const StringBase& other) const {
+        bool operator==(const BasicStringBase& other) const {
             return cms::string::equals(_buf, _len, other._buf, other._len, false);
         }
         /// 객체 간 불일치 연산자입니다.
-        bool operator!=(const StringBase& other) const {
-            return (_len != other._len) || !equals(other.c_str());
+        bool operator!=(const BasicStringBase& other) const {
+            return !(*this == other);
         }
+        /// StringView 비교 연산자입니다.
+        bool operator==(StringView other) const { return equals(other); }
+        bool operator!=(StringView other) const { return !equals(other); }
+        /// 길이 타입이 다른 객체(String<N> ↔ StringRef) 간 비교 연산자입니다.
+        /// Why: 없으면 operator const char* 경유 후보끼리 모호해지므로 view()로 명시적으로 비교합니다.
+        template<typename OtherSizeT>
+        bool operator==(const BasicStringBase<OtherSizeT>& other) const { return equals(other.view()); }
+        template<typename OtherSizeT>
+        bool operator!=(const BasicStringBase<OtherSizeT>& other) const { return !equals(other.view()); }
 
         /// 대소 비교 연산자들 (사전식 비교)
         bool operator<(const char* other) const { return compare(other) < 0; }
@@ -425,8 +809,13 @@ namespace cms {
         bool operator<=(const char* other) const { return compare(other) <= 0; }
         bool operator>=(const char* other) const { return compare(other) >= 0; }
 
-        bool operator<(const StringBase& other) const { return compare(other) < 0; }
-        bool operator>(const StringBase& other) const { return compare(other) > 0; }
+        bool operator<(const BasicStringBase& other) const { return compare(other) < 0; }
+        bool operator>(const BasicStringBase& other) const { return compare(other) > 0; }
+
+        bool operator<(StringView other) const { return compare(other) < 0; }
+        bool operator>(StringView other) const { return compare(other) > 0; }
+        bool operator<=(StringView other) const { return compare(other) <= 0; }
+        bool operator>=(StringView other) const { return compare(other) >= 0; }
 
         /// 리터럴 최적화 대소 비교
         template<size_t M>
@@ -440,59 +829,121 @@ namespace cms {
 
         /// 문자열 비교 함수
         int compare(const char* other) const;
-        int compare(const StringBase& other) const;
+        int compare(const BasicStringBase& other) const;
+        int compare(StringView other) const {
+            return cms::string::compare(_buf, _len, other.data(), other.length());
+        }
 
         /// 대소문자를 무시한 문자열 비교 함수
         int compareIgnoreCase(const char* other) const;
-        int compareIgnoreCase(const StringBase& other) const;
+        int compareIgnoreCase(const BasicStringBase& other) const;
+        int compareIgnoreCase(StringView other) const {
+            return cms::string::compareIgnoreCase(_buf, _len, other.data(), other.length());
+        }
         template<size_t M>
         int compareIgnoreCase(const char (&other)[M]) const {
             return cms::string::compareIgnoreCase(_buf, _len, other, M - 1);
         }
 
         /// 외부 문자열과의 비교를 위한 프렌드 연산자입니다.
-        friend bool operator==(const char* lhs, const StringBase& rhs);
+        friend bool operator==(const char* lhs, const BasicStringBase& rhs) {
+            if (!lhs) return rhs.isEmpty();
+            return cms::string::equals(lhs, strlen(lhs), rhs._buf, rhs._len, false);
+        }
         /// 외부 문자열 리터럴과의 비교 최적화
         template<size_t M>
-        friend bool operator==(const char (&lhs)[M], const StringBase& rhs) {
+        friend bool operator==(const char (&lhs)[M], const BasicStringBase& rhs) {
             return cms::string::equals(lhs, M - 1, rhs._buf, rhs._len, false);
         }
         /// 외부 문자열과의 불일치를 위한 프렌드 연산자입니다.
-        friend bool operator!=(const char* lhs, const StringBase& rhs);
+        friend bool operator!=(const char* lhs, const BasicStringBase& rhs) { return !(lhs == rhs); }
         /// 외부 문자열 리터럴과의 불일치 최적화
         template<size_t M>
-        friend bool operator!=(const char (&lhs)[M], const StringBase& rhs) {
+        friend bool operator!=(const char (&lhs)[M], const BasicStringBase& rhs) {
             return !(lhs == rhs);
         }
+        /// StringView가 왼쪽에 오는 비교 연산자입니다.
+        friend bool operator==(StringView lhs, const BasicStringBase& rhs) { return rhs.equals(lhs); }
+        friend bool operator!=(StringView lhs, const BasicStringBase& rhs) { return !rhs.equals(lhs); }
+
+        /// 길이 타입이 다른 인스턴스가 substring 대상의 버퍼/길이를 직접 갱신할 수 있도록 허용합니다.
+        template<typename> friend class BasicStringBase;
 
     protected:
         /// 실제 문자열 데이터가 저장되는 외부 주입 메모리 버퍼의 시작 주소.
         char* const _buf;
         /// 버퍼의 물리적 최대 크기 (널 종료 문자 포함).
-        const uint16_t _capacity; // size_t 대신 uint16_t 사용 시 RAM 절약 가능
+        const SizeT _capacity; // uint16_t 인스턴스는 size_t 대비 객체당 RAM 절약
         /// 현재 버퍼에 저장된 문자열의 바이트 길이 (널 종료 문자 제외).
-        uint16_t _len;
+        SizeT _len;
+        /// 용량 부족으로 내용이 잘린 적이 있는지 여부 (clearTruncated() 전까지 유지).
+        bool _truncated;
 #ifdef CMS_ENABLE_PROFILING
         /// 객체 생성 이후 도달했던 최대 바이트 길이 (프로파일링용).
-        uint16_t _maxLenSeen;
+        SizeT _maxLenSeen;
+#endif
+#ifdef CMS_ENABLE_HASH_CACHE
+        /// 마지막으로 계산된 대소문자 구분 해시.
+        mutable uint32_t _hash;
+        /// _hash가 현재 내용과 일치하는지 여부.
+        mutable bool _hashValid;
+#endif
+#ifdef CMS_ENABLE_COUNT_CACHE
+        /// 캐시 무효 상태를 나타내는 값 (SizeT 최대값: 버퍼 용량보다 작은 글자 수가 도달할 수 없는 값).
+        static constexpr SizeT COUNT_INVALID = (SizeT)~(SizeT)0;
+        /// 마지막으로 계산된 논리적 글자 수 (COUNT_INVALID면 재계산 필요).
+        mutable SizeT _charCount;
+#endif
+#ifdef CMS_ENABLE_STRING_REGISTRY
+        /// 전역 레지스트리 연결 정보 (생성 시 연결, 소멸 시 분리).
+        StringRegistryHook _registryHook;
 #endif
 
         /// 내부 생성자입니다. 자식 클래스에서 버퍼 정보를 주입받습니다.
-        StringBase(char* b, size_t c);
+        /// @note 버퍼의 기존 내용을 strlen으로 측정하므로 이미 NUL 종료된 버퍼에만 사용합니다. (새 버퍼는 길이를 받는 생성자 사용)
+        BasicStringBase(char* b, size_t c);
         /// 길이를 명시적으로 지정하는 내부 생성자입니다. (최적화)
-        StringBase(char* b, size_t c, size_t l);
+        BasicStringBase(char* b, size_t c, size_t l);
         /// 현재 버퍼의 실제 문자열 길이를 측정하여 _len과 최대 사용량을 동기화합니다.
         void updateLength();
         /// 최대 사용량 지표를 갱신합니다.
         inline void updatePeak() {
 #ifdef CMS_ENABLE_PROFILING
             if (_len > _maxLenSeen) _maxLenSeen = _len;
+#endif
+        }
+        /// 내용 변경 시 글자 수/해시 캐시를 무효화합니다.
+        inline void invalidateCount() const {
+#ifdef CMS_ENABLE_COUNT_CACHE
+            _charCount = COUNT_INVALID;
+#endif
+            invalidateHash();
+        }
+        /// 용량 부족으로 dropped 바이트가 버려졌음을 기록합니다. (잘림 플래그, 전역 통계, 레지스트리 잘림 횟수)
+        void noteTruncation(size_t dropped);
+        /// 레지스트리에 자신을 연결합니다. (모든 생성자가 호출)
+        inline void registerSelf() {
+#ifdef CMS_ENABLE_STRING_REGISTRY
+            _registryHook = StringRegistryHook{nullptr, nullptr, this, nullptr, 0, !std::is_same<SizeT, uint16_t>::value};
+            cms::registry::link(_registryHook);
+#endif
+        }
+        /// 글자 수는 그대로이지만 바이트가 바뀌는 경우(대소문자 변환, 추가 등) 해시 캐시만 무효화합니다.
+        inline void invalidateHash() const {
+#ifdef CMS_ENABLE_HASH_CACHE
+            _hashValid = false;
 #endif
         }
     };
 
-    /// 외부 문자열과 객체의 비교 연산자입니다.
-    bool operator==(const char* lhs, const StringBase& rhs);
-    /// 외부 문자열과 객체의 불일치 연산자입니다.
-    bool operator!=(const char* lhs, const StringBase& rhs);
+    /// 고정 크기 String<N>이 사용하는 기본 베이스입니다. (uint16_t 길이, 최대 64KiB)
+    using StringBase = BasicStringBase<uint16_t>;
+    /// StringRef가 사용하는 대형 버퍼용 베이스입니다. (size_t 길이)
+    using LargeStringBase = BasicStringBase<size_t>;
+
+    // 본문은 cmsStringBase.cpp에서만 인스턴스화합니다.
+    extern template class BasicStringBase<uint16_t>;
+#if SIZE_MAX > UINT16_MAX
+    extern template class BasicStringBase<size_t>;
+#endif
 }
@@ -0,0 +1,85 @@
+/// @author comser.dev
+///
+/// 호출자가 제공한 외부 메모리(정적 배열, 아레나 등)를 감싸는 문자열 정의서입니다.
+/// 버퍼를 소유하지 않으므로 MAX_SAFE_SIZE(스택 보호 한계) 제약 없이 수 KiB 이상의
+/// HTTP 본문이나 JSON 문서에도 StringBase API 전체를 복사 없이 사용할 수 있습니다.
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <cstdint>  // uint16_t
+#include "cmsStringBase.h"
+
+namespace cms {
+
+// ==================================================================================================
+// [StringRef] 개요
+// - 왜 존재하는가: String<N>은 버퍼를 객체 안에 두므로 스택 보호를 위해 N이 1024로 제한되고, 길이도 uint16_t로 저장됩니다.
+//                  정적 영역이나 아레나에 잡아 둔 대형 버퍼를 다루려면 작은 String으로 나눠 복사해야 했습니다.
+// - 어떻게 동작하는가: 외부 버퍼 포인터와 용량을 BasicStringBase<SizeT>에 그대로 주입하며, 기본 길이 타입은 size_t입니다.
+// ==================================================================================================
+
+    /// 외부 버퍼를 감싸는 문자열입니다. (버퍼를 소유하지 않음)
+    ///
+    /// Why: 대형 버퍼를 힙 없이 선언해 두고, 필요한 곳에서 StringBase API로 가공하기 위함입니다.
+    /// How: 생성자에서 받은 버퍼/용량을 베이스에 주입하는 것 외에 추가 상태가 없습니다. (객체 크기 = 포인터 + 길이 2개)
+    ///
+    /// 사용 예:
+    /// @code
+    /// static char body[8192];
+    /// cms::StringRef json(body);                 // 빈 문자열로 시작
+    /// json << "{\"items\":[";
+    ///
+    /// cms::StringRef rx(rxBuf, sizeof(rxBuf), rxLen); // 이미 채워진 내용을 그대로 사용
+    /// if (rx.startsWith("HTTP/1.1 200")) { ... }
+    /// @endcode
+    ///
+    /// @tparam SizeT 길이 저장 타입 (기본 size_t, 64KiB 미만 버퍼는 uint16_t로 StringBase&를 받는 API와 호환)
+    /// @note 버퍼는 StringRef보다 오래 살아 있어야 하며, 같은 버퍼를 가리키는 사본이 생기지 않도록 복사 생성은 금지됩니다.
+    template<typename SizeT = size_t>
+    class BasicStringRef : public BasicStringBase<SizeT> {
+        using Base = BasicStringBase<SizeT>;
+
+    public:
+        /// 외부 버퍼를 빈 문자열로 초기화하여 감쌉니다.
+        ///
+        /// @param buffer 문자열을 저장할 외부 버퍼 (nullptr 불가)
+        /// @param capacity 버퍼의 전체 크기 (널 종료 문자 포함, 1 이상)
+        BasicStringRef(char* buffer, size_t capacity) : Base(buffer, clampCapacity(capacity), 0) {
+            buffer[0] = '\0';
+        }
+
+        /// 이미 내용이 들어 있는 외부 버퍼를 감쌉니다. (strlen 없음)
+        ///
+        /// @param buffer 외부 버퍼 (nullptr 불가)
+        /// @param capacity 버퍼의 전체 크기 (널 종료 문자 포함, 1 이상)
+        /// @param length 현재 내용의 바이트 길이 (capacity - 1을 넘으면 잘림)
+        /// @note buffer[length] 위치에 널 종료 문자를 기록합니다.
+        BasicStringRef(char* buffer, size_t capacity, size_t length)
+            : Base(buffer, clampCapacity(capacity), clampLength(capacity, length)) {
+            buffer[this->_len] = '\0';
+        }
+
+        /// 정적 배열을 빈 문자열로 초기화하여 감쌉니다. (크기 자동 추론)
+        template<size_t M>
+        explicit BasicStringRef(char (&buffer)[M]) : BasicStringRef(buffer, M) {}
+
+        using Base::operator=;
+
+    private:
+        /// SizeT로 표현할 수 있는 최대 용량으로 제한합니다. (uint16_t 인스턴스에서 65535바이트 초과 시)
+        static constexpr size_t clampCapacity(size_t capacity) {
+            return capacity > (size_t)(SizeT)~(SizeT)0 ? (size_t)(SizeT)~(SizeT)0 : capacity;
+        }
+        /// 초기 길이를 널 종료 문자 자리를 뺀 용량 안으로 제한합니다.
+        static constexpr size_t clampLength(size_t capacity, size_t length) {
+            return length < clampCapacity(capacity) ? length : clampCapacity(capacity) - 1;
+        }
+    };
+
+    /// size_t 길이를 사용하는 기본 StringRef입니다. (버퍼 크기 제한 없음)
+    using StringRef = BasicStringRef<size_t>;
+    /// uint16_t 길이를 사용하는 StringRef입니다. (64KiB 미만 버퍼, StringBase&를 받는 API에 그대로 전달 가능)
+    using SmallStringRef = BasicStringRef<uint16_t>;
+
+} // namespace cms
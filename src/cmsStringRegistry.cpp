@@ -0,0 +1,152 @@
+/// @author comser.dev
+///
+/// StringBase 전역 레지스트리의 연결 리스트, 잠금, 과다 할당 보고서 구현부입니다.
+/// CMS_ENABLE_STRING_REGISTRY가 정의된 빌드에서만 컴파일됩니다.
+
+#include "cmsStringBase.h"
+
+#ifdef CMS_ENABLE_STRING_REGISTRY
+
+#include "cmsString.h"
+#include "cmsStringRegistry.h"
+#ifdef ARDUINO
+#include <freertos/FreeRTOS.h> // portMUX_TYPE, portENTER_CRITICAL
+#else
+#include <mutex>
+#endif
+
+namespace {
+    // 두 객체 모두 상수 초기화되므로, 다른 번역 단위의 정적 String 생성자가 먼저 실행되어도 안전합니다.
+    cms::StringRegistryHook* g_head = nullptr;
+    size_t g_count = 0;
+#ifdef ARDUINO
+    portMUX_TYPE g_lock = portMUX_INITIALIZER_UNLOCKED;
+#else
+    std::mutex g_lock;
+#endif
+
+    /// 리스트 잠금 범위입니다. ESP32에서는 스핀락(인터럽트 차단)이므로 잠금 안에서는 포인터 조작과 복사만 합니다.
+    struct Guard {
+#ifdef ARDUINO
+        Guard() { portENTER_CRITICAL(&g_lock); }
+        ~Guard() { portEXIT_CRITICAL(&g_lock); }
+#else
+        Guard() { g_lock.lock(); }
+        ~Guard() { g_lock.unlock(); }
+#endif
+    };
+
+    size_t reclaimable(const cms::StringStats& s) {
+        const size_t suggested = cms::registry::suggestedCapacity(s.peak);
+        return s.capacity > suggested ? s.capacity - suggested : 0;
+    }
+
+    /// 과다 할당 여부: 잘린 적이 없고, 최대 사용률이 기준 이하이며, 권장 크기로 줄였을 때 4바이트 이상 회수됩니다.
+    bool isOverProvisioned(const cms::StringStats& s, uint8_t peakPercent) {
+        if (s.truncations || s.capacity <= 1) return false;
+        return s.peak * 100 <= (s.capacity - 1) * peakPercent && reclaimable(s) >= 4;
+    }
+
+    /// 이름(없으면 주소)을 width 칸에 맞춰 덧붙입니다. (appendPrintf는 왼쪽 정렬 플래그를 지원하지 않음)
+    void appendLabel(cms::StringBase& line, const cms::StringStats& s, size_t width) {
+        const size_t start = line.length();
+        if (s.name) line << s.name;
+        else line.appendPrintf("%p", s.address);
+        while (line.length() < start + width) line << ' ';
+    }
+}
+
+namespace cms {
+namespace registry {
+
+    void link(StringRegistryHook& hook) noexcept {
+        Guard guard;
+        hook.prev = nullptr;
+        hook.next = g_head;
+        if (g_head) g_head->prev = &hook;
+        g_head = &hook;
+        g_count++;
+    }
+
+    void unlink(StringRegistryHook& hook) noexcept {
+        Guard guard;
+        if (hook.prev) hook.prev->next = hook.next;
+        else if (g_head == &hook) g_head = hook.next;
+        else return; // 연결되지 않은 훅
+        if (hook.next) hook.next->prev = hook.prev;
+        hook.prev = hook.next = nullptr;
+        g_count--;
+    }
+
+    size_t count() noexcept {
+        Guard guard;
+        return g_count;
+    }
+
+    size_t snapshot(StringStats* out, size_t maxEntries) noexcept {
+        Guard guard;
+        size_t i = 0;
+        for (const StringRegistryHook* h = g_head; h && i < maxEntries; h = h->next) detail::readStats(*h, out[i++]);
+        return g_count;
+    }
+
+    size_t suggestedCapacity(size_t peak) noexcept {
+        const size_t needed = peak + peak / 4 + 1;
+        return (needed + 3) & ~(size_t)3;
+    }
+
+    size_t writeReport(StringStats* stats, size_t count, size_t total, WriteFn write, void* ctx,
+                       uint8_t peakPercent) noexcept {
+        if (!write) return 0;
+
+        // 과다 할당 → 잘림 → 나머지 순으로 앞쪽에 모읍니다.
+        size_t over = 0, truncated = 0, bytes = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (!isOverProvisioned(stats[i], peakPercent)) continue;
+            const StringStats s = stats[i];
+            stats[i] = stats[over];
+            stats[over++] = s;
+            bytes += reclaimable(s);
+        }
+        for (size_t i = over; i < count; ++i) {
+            if (!stats[i].truncations) continue;
+            const StringStats s = stats[i];
+            stats[i] = stats[over + truncated];
+            stats[over + truncated++] = s;
+        }
+        // 과다 할당 구간은 회수 가능 바이트가 큰 순으로 정렬합니다. (항목 수가 적어 삽입 정렬)
+        for (size_t i = 1; i < over; ++i) {
+            const StringStats s = stats[i];
+            size_t j = i;
+            while (j > 0 && reclaimable(stats[j - 1]) < reclaimable(s)) {
+                stats[j] = stats[j - 1];
+                --j;
+            }
+            stats[j] = s;
+        }
+
+        cms::String<160> line;
+        line.appendPrintf("[StringRegistry] %u live, %u over-provisioned (peak <= %u%%), %u B reclaimable, %u truncated",
+                          (unsigned)total, (unsigned)over, (unsigned)peakPercent, (unsigned)bytes, (unsigned)truncated);
+        if (total > count) line.appendPrintf(" (%u not sampled)", (unsigned)(total - count));
+        line << '\n';
+        write(line.c_str(), line.length(), ctx);
+
+        for (size_t i = 0; i < over + truncated; ++i) {
+            const StringStats& s = stats[i];
+            const unsigned pct = s.capacity > 1 ? (unsigned)(s.peak * 100 / (s.capacity - 1)) : 0;
+            line = "  ";
+            appendLabel(line, s, 16);
+            line.appendPrintf(" cap %5u  len %5u  peak %5u (%3u%%)  trunc %u", (unsigned)s.capacity, (unsigned)s.length,
+                              (unsigned)s.peak, pct, (unsigned)s.truncations);
+            if (i < over) line.appendPrintf("  -> String<%u>\n", (unsigned)suggestedCapacity(s.peak));
+            else line << "  !! grow\n";
+            write(line.c_str(), line.length(), ctx);
+        }
+        return over + truncated;
+    }
+
+} // namespace registry
+} // namespace cms
+
+#endif // CMS_ENABLE_STRING_REGISTRY
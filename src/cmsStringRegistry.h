@@ -0,0 +1,98 @@
+/// @author comser.dev
+///
+/// 살아 있는 모든 StringBase 버퍼를 추적하는 전역 레지스트리(CMS_ENABLE_STRING_REGISTRY) 정의서입니다.
+/// 버퍼별 용량, 현재 길이, 최대 길이, 잘림 횟수를 조회하고 과다 할당된 버퍼를 보고합니다.
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <cstdint>  // uint8_t, uint32_t
+
+namespace cms {
+
+// ==================================================================================================
+// [StringRegistry] 개요
+// - 왜 존재하는가: peakUtilization()은 객체 하나씩만 볼 수 있어, 펌웨어 전체에서 어떤 String<N>의 N을 줄일 수 있는지
+//                  (또는 늘려야 하는지) 한 번에 파악할 방법이 없었습니다.
+// - 어떻게 동작하는가: 각 StringBase가 작은 훅(이전/다음 포인터)을 내장하고 생성 시 전역 이중 연결 리스트에 스스로
+//                      연결, 소멸 시 분리됩니다(침습형이라 힙을 쓰지 않음). 조회는 잠금 아래 통계를 호출자 배열로
+//                      복사한 뒤, 보고서 작성과 출력은 잠금 밖에서 수행합니다.
+// ==================================================================================================
+
+    /// 버퍼 하나의 통계 스냅샷입니다.
+    struct StringStats {
+        const char* name;     ///< setRegistryName()으로 지정한 이름 (없으면 nullptr)
+        const void* address;  ///< 객체 주소 (이름이 없을 때 식별용)
+        size_t capacity;      ///< 버퍼 크기 (널 종료 문자 포함)
+        size_t length;        ///< 현재 바이트 길이
+        size_t peak;          ///< 생성 이후 최대 바이트 길이
+        uint32_t truncations; ///< 용량 부족으로 내용이 잘린 횟수
+    };
+
+    /// StringBase에 내장되는 레지스트리 연결 정보입니다. (CMS_ENABLE_STRING_REGISTRY 활성 시에만 멤버로 존재)
+    struct StringRegistryHook {
+        StringRegistryHook* prev; ///< 리스트의 이전 훅
+        StringRegistryHook* next; ///< 리스트의 다음 훅
+        const void* owner;        ///< 훅을 가진 StringBase 객체
+        const char* name;         ///< 보고서에 표시할 이름
+        uint32_t truncations;     ///< 잘림 횟수
+        bool wide;                ///< owner가 size_t 길이 베이스(StringRef)이면 true
+    };
+
+namespace registry {
+
+    /// 훅을 리스트에 연결합니다. (StringBase 생성자가 호출)
+    void link(StringRegistryHook& hook) noexcept;
+    /// 훅을 리스트에서 분리합니다. (StringBase 소멸자가 호출)
+    void unlink(StringRegistryHook& hook) noexcept;
+
+    /// 현재 살아 있는 버퍼 수를 반환합니다.
+    size_t count() noexcept;
+
+    /// [snapshot] 살아 있는 버퍼의 통계를 out에 최대 maxEntries개 복사합니다.
+    ///
+    /// @return 살아 있는 전체 버퍼 수 (maxEntries보다 크면 나머지는 복사되지 않음)
+    size_t snapshot(StringStats* out, size_t maxEntries) noexcept;
+
+    /// 보고서 출력 콜백: data부터 len바이트를 내보냅니다.
+    using WriteFn = void (*)(const char* data, size_t len, void* ctx);
+
+    /// [suggestedCapacity] 최대 길이에 25% 여유와 널 종료 문자를 더해 4바이트 단위로 올린 권장 크기를 반환합니다.
+    size_t suggestedCapacity(size_t peak) noexcept;
+
+    /// [writeReport] 스냅샷에서 과다 할당(최대 사용률 peakPercent% 이하)과 잘림이 발생한 버퍼를 보고합니다.
+    ///
+    /// How: 과다 할당 버퍼는 회수 가능 바이트(capacity - 권장 크기)가 큰 순으로, 잘린 버퍼는 그 뒤에 나열합니다.
+    ///
+    /// @param stats snapshot() 결과 (순서가 바뀜)
+    /// @param count stats의 항목 수
+    /// @param total 살아 있는 전체 버퍼 수 (snapshot() 반환값, 생략된 항목 수 표시용)
+    /// @return 보고한 버퍼 수
+    size_t writeReport(StringStats* stats, size_t count, size_t total, WriteFn write, void* ctx,
+                       uint8_t peakPercent = 50) noexcept;
+
+    /// [dumpOverProvisioned] 스택에 스냅샷을 만들어 과다 할당/잘림 보고서를 출력합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// cms::registry::dumpOverProvisioned([](const char* d, size_t n, void*) { Serial.write(d, n); }, nullptr);
+    /// // [StringRegistry] 37 live, 5 over-provisioned (peak <= 50%), 612 B reclaimable, 1 truncated
+    /// //   cmdLine      cap 256  len   0  peak  41 ( 16%)  trunc 0  -> String<56>
+    /// @endcode
+    ///
+    /// @tparam MaxEntries 스냅샷 배열 크기 (항목당 약 40바이트의 스택 사용)
+    /// @return 보고한 버퍼 수
+    template<size_t MaxEntries = 32>
+    size_t dumpOverProvisioned(WriteFn write, void* ctx, uint8_t peakPercent = 50) noexcept {
+        StringStats stats[MaxEntries];
+        const size_t total = snapshot(stats, MaxEntries);
+        return writeReport(stats, total < MaxEntries ? total : MaxEntries, total, write, ctx, peakPercent);
+    }
+
+namespace detail {
+    /// 훅 주인의 현재 통계를 읽습니다. (두 길이 타입을 모두 아는 cmsStringBase.cpp에서 정의)
+    void readStats(const StringRegistryHook& hook, StringStats& out) noexcept;
+} // namespace detail
+
+} // namespace registry
+} // namespace cms
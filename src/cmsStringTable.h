@@ -0,0 +1,390 @@
+/// @author comser.dev
+///
+/// 컴파일 타임에 정렬/배치되는 정적 문자열 테이블(StringTable, PerfectStringTable) 정의서입니다.
+/// 명령 디스패치처럼 키 집합이 빌드 시점에 고정된 경우, 테이블 전체를 constexpr로 만들어 플래시에 둡니다.
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <cstdint>  // uint8_t, uint16_t, uint32_t
+#include <type_traits>
+#include "cmsStringBase.h"
+#include "cmsStringView.h"
+
+namespace cms {
+
+// ==================================================================================================
+// [StringTable] 개요
+// - 왜 존재하는가: 콘솔/프로토콜 명령 디스패치가 if-equals 사슬이나 배열 순차 비교로 구현되어 명령 수에 비례해
+//                  느려졌고, 접두사 검색(자동 완성, 축약 명령)은 매번 전체를 훑어야 했습니다.
+// - 어떻게 동작하는가: constexpr 생성자에서 항목을 정렬(StringTable)하거나 충돌 없는 슬롯에 배치(PerfectStringTable)하므로
+//                      런타임에는 정렬/해시 구성 비용이 없습니다. StringTable은 이진 탐색과 접두사 구간 탐색을,
+//                      PerfectStringTable은 해시 한 번 + 비교 한 번의 정확 일치 조회를 제공합니다.
+// ==================================================================================================
+
+    /// 정적 테이블의 항목 하나 (키와 값)
+    ///
+    /// @tparam Value 값 타입 (함수 포인터, 정수, enum 등 리터럴 타입)
+    template<typename Value>
+    struct StringEntry {
+        StringView key; ///< 키 (리터럴 권장, 테이블보다 오래 살아야 함)
+        Value value;    ///< 값
+    };
+
+    namespace detail {
+        /// compareIgnoreCase와 같은 규칙(소문자로 접음)의 상수 식용 바이트 변환입니다.
+        constexpr uint8_t tableFold(char c, bool ignoreCase) noexcept {
+            return (ignoreCase && c >= 'A' && c <= 'Z') ? (uint8_t)(c - 'A' + 'a') : (uint8_t)c;
+        }
+
+        /// 상수 식용 사전식 비교입니다. (런타임 compare/compareIgnoreCase와 같은 순서: 부호 없는 바이트, 짧은 쪽이 앞)
+        constexpr int tableCompare(StringView a, StringView b, bool ignoreCase) noexcept {
+            const size_t n = a.length() < b.length() ? a.length() : b.length();
+            for (size_t i = 0; i < n; ++i) {
+                const uint8_t ca = tableFold(a[i], ignoreCase), cb = tableFold(b[i], ignoreCase);
+                if (ca != cb) return ca < cb ? -1 : 1;
+            }
+            return a.length() < b.length() ? -1 : (a.length() > b.length() ? 1 : 0);
+        }
+    } // namespace detail
+
+    /// 컴파일 타임에 정렬되는 정적 문자열 테이블입니다.
+    ///
+    /// Why: 명령 이름 → 핸들러 조회를 O(log n)으로 만들고, 정렬 순서를 이용해 접두사 검색(자동 완성, 축약 명령)을 제공하기 위함입니다.
+    /// How: 생성자가 constexpr 삽입 정렬로 항목을 정렬하며, 조회는 StringView::compare(IgnoreCase)로 이진 탐색합니다.
+    ///      정렬 비교는 런타임 비교와 같은 규칙을 사용하므로 대소문자 무시 모드에서도 순서가 어긋나지 않습니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// using Handler = void (*)(cms::StringView args);
+    /// static constexpr cms::StringEntry<Handler> kEntries[] = {
+    ///     {"status", cmdStatus}, {"reboot", cmdReboot}, {"reset", cmdReset},
+    /// };
+    /// static constexpr auto kCommands = cms::makeStringTable<true>(kEntries);   // 대소문자 무시
+    /// static_assert(kCommands.isValid(), "duplicate command");
+    ///
+    /// if (const Handler* h = kCommands.find(cmd)) (*h)(args);
+    /// else if (auto* e = kCommands.findUnique(cmd)) e->value(args);            // "stat" → status
+    /// @endcode
+    ///
+    /// @tparam Value 값 타입 (리터럴 타입이어야 constexpr로 만들 수 있음)
+    /// @tparam N 항목 수
+    /// @tparam IgnoreCase true면 대소문자를 무시하고 정렬/조회
+    /// @note 키는 StringView이므로 가리키는 문자열(보통 리터럴)이 테이블보다 오래 살아야 합니다.
+    template<typename Value, size_t N, bool IgnoreCase = false>
+    class StringTable {
+        static_assert(N > 0, "StringTable must hold at least one entry");
+
+    public:
+        using Entry = StringEntry<Value>;
+
+        /// 정렬된 항목의 연속 구간입니다. (prefixRange 결과)
+        struct Range {
+            const Entry* first; ///< 첫 항목
+            size_t count;       ///< 항목 수
+
+            constexpr const Entry* begin() const noexcept { return first; }
+            constexpr const Entry* end() const noexcept { return first + count; }
+            constexpr bool isEmpty() const noexcept { return count == 0; }
+        };
+
+        /// 항목 배열을 복사하여 정렬합니다. (상수 식에서 평가하면 정렬 결과가 그대로 플래시에 놓임)
+        constexpr StringTable(const Entry (&entries)[N]) noexcept : _entries{} {
+            for (size_t i = 0; i < N; ++i) _entries[i] = entries[i];
+            for (size_t i = 1; i < N; ++i) {
+                const Entry e = _entries[i];
+                size_t j = i;
+                while (j > 0 && detail::tableCompare(e.key, _entries[j - 1].key, IgnoreCase) < 0) {
+                    _entries[j] = _entries[j - 1];
+                    --j;
+                }
+                _entries[j] = e;
+            }
+        }
+
+        /// 항목 수를 반환합니다.
+        constexpr size_t size() const noexcept { return N; }
+        /// 대소문자를 무시하는 테이블인지 확인합니다.
+        constexpr bool ignoresCase() const noexcept { return IgnoreCase; }
+        /// 정렬 순서의 index번째 항목을 반환합니다.
+        constexpr const Entry& operator[](size_t index) const noexcept { return _entries[index]; }
+        constexpr const Entry* begin() const noexcept { return _entries; }
+        constexpr const Entry* end() const noexcept { return _entries + N; }
+
+        /// 중복 키가 없는지 확인합니다. (static_assert용, 중복 키는 어느 쪽이 조회될지 정해지지 않음)
+        constexpr bool isValid() const noexcept {
+            for (size_t i = 1; i < N; ++i) {
+                if (detail::tableCompare(_entries[i - 1].key, _entries[i].key, IgnoreCase) == 0) return false;
+            }
+            return true;
+        }
+
+        /// [indexOf] 이진 탐색으로 키의 정렬 순서 위치를 찾습니다.
+        /// @return 위치 (없으면 StringView::npos)
+        size_t indexOf(StringView key) const noexcept {
+            const size_t i = lowerBound(key);
+            return (i < N && compareKey(_entries[i].key, key) == 0) ? i : StringView::npos;
+        }
+
+        /// [find] 키에 해당하는 값을 찾습니다.
+        /// @return 값 포인터 (없으면 nullptr)
+        const Value* find(StringView key) const noexcept {
+            const size_t i = indexOf(key);
+            return i == StringView::npos ? nullptr : &_entries[i].value;
+        }
+
+        /// 키 존재 여부를 확인합니다.
+        bool contains(StringView key) const noexcept { return indexOf(key) != StringView::npos; }
+
+        /// [prefixRange] prefix로 시작하는 항목 구간을 찾습니다. (빈 prefix는 전체)
+        ///
+        /// How: 정렬 순서에서 같은 접두사를 가진 항목은 연속하므로, 시작/끝 경계를 각각 이진 탐색합니다.
+        Range prefixRange(StringView prefix) const noexcept {
+            size_t lo = 0, hi = N;
+            while (lo < hi) {
+                const size_t mid = lo + (hi - lo) / 2;
+                if (comparePrefix(_entries[mid].key, prefix) < 0) lo = mid + 1;
+                else hi = mid;
+            }
+            const size_t first = lo;
+            hi = N;
+            while (lo < hi) {
+                const size_t mid = lo + (hi - lo) / 2;
+                if (comparePrefix(_entries[mid].key, prefix) <= 0) lo = mid + 1;
+                else hi = mid;
+            }
+            return Range{_entries + first, lo - first};
+        }
+
+        /// [findUnique] 정확히 일치하거나, prefix로 시작하는 항목이 하나뿐이면 그 항목을 반환합니다. (축약 명령)
+        /// @return 항목 포인터 (없거나 모호하면 nullptr)
+        const Entry* findUnique(StringView prefix) const noexcept {
+            const Range r = prefixRange(prefix);
+            if (r.count == 1) return r.first;
+            // 정확히 일치하는 키는 구간의 맨 앞에 옵니다. ("reset"과 "resetAll" 중 "reset")
+            if (r.count > 1 && r.first->key.length() == prefix.length()) return r.first;
+            return nullptr;
+        }
+
+        /// [complete] prefix로 시작하는 모든 항목의 공통 접두사를 out에 덧붙입니다. (탭 자동 완성)
+        ///
+        /// 사용 예:
+        /// @code
+        /// cms::String<32> line;
+        /// // 키: "reboot", "reset", "resetAll"
+        /// size_t n = kCommands.complete("res", line);  // n == 2, line == "reset"
+        /// @endcode
+        ///
+        /// @param out 결과를 덧붙일 문자열 (표기는 테이블 키를 따름)
+        /// @return 일치한 항목 수 (0이면 out은 변경되지 않음)
+        template<typename SizeT>
+        size_t complete(StringView prefix, BasicStringBase<SizeT>& out) const {
+            const Range r = prefixRange(prefix);
+            if (r.isEmpty()) return 0;
+            StringView common = r.first->key;
+            for (const Entry& e : r) {
+                size_t i = prefix.length();
+                while (i < common.length() && i < e.key.length() &&
+                       detail::tableFold(common[i], IgnoreCase) == detail::tableFold(e.key[i], IgnoreCase)) {
+                    ++i;
+                }
+                common = common.substr(0, i);
+            }
+            out.append(common.data(), common.length());
+            return r.count;
+        }
+
+    private:
+        static int compareKey(StringView a, StringView b) noexcept {
+            return IgnoreCase ? a.compareIgnoreCase(b) : a.compare(b);
+        }
+        /// 키의 앞 prefix 길이만큼만 비교합니다. (0이면 prefix로 시작)
+        static int comparePrefix(StringView key, StringView prefix) noexcept {
+            return compareKey(key.substr(0, prefix.length()), prefix);
+        }
+
+        size_t lowerBound(StringView key) const noexcept {
+            size_t lo = 0, hi = N;
+            while (lo < hi) {
+                const size_t mid = lo + (hi - lo) / 2;
+                if (compareKey(_entries[mid].key, key) < 0) lo = mid + 1;
+                else hi = mid;
+            }
+            return lo;
+        }
+
+        Entry _entries[N]; ///< 정렬된 항목
+    };
+
+    /// 컴파일 타임에 충돌 없는 배치를 찾는 정적 해시 테이블입니다. (정확 일치 전용)
+    ///
+    /// Why: 수신 패킷마다 명령을 찾는 경로에서 이진 탐색의 log n번 문자열 비교조차 줄이기 위함입니다.
+    /// How: 해시-변위(hash and displace) 방식입니다. 해시로 버킷을 고르고, 버킷마다 변위값 d를 찾아
+    ///      mix(hash, d)가 가리키는 슬롯이 다른 키와 겹치지 않게 합니다. 조회는 해시 1회 + 슬롯 1개 + 문자열 비교 1회입니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// static constexpr cms::PerfectStringTable<Handler, 3> kFast(kEntries);
+    /// static_assert(kFast.isValid(), "no perfect layout (duplicate key?)");
+    /// if (const Handler* h = kFast.find(cmd)) (*h)(args);
+    /// @endcode
+    ///
+    /// @tparam Value 값 타입 (리터럴 타입)
+    /// @tparam N 항목 수 (65535 미만)
+    /// @tparam IgnoreCase true면 대소문자를 무시하고 조회 (해시도 접어서 계산)
+    /// @note 슬롯은 N * 2 이상, 버킷은 N / 2 이상인 2의 거듭제곱이며, 슬롯당 1~2바이트와 버킷당 2바이트를 추가로 사용합니다.
+    ///       접두사 검색은 지원하지 않으므로 필요하면 같은 항목으로 StringTable을 함께 둡니다.
+    template<typename Value, size_t N, bool IgnoreCase = false>
+    class PerfectStringTable {
+        static_assert(N > 0 && N < 0xFFFF, "PerfectStringTable must hold 1..65534 entries");
+
+        static constexpr size_t pow2AtLeast(size_t n) {
+            size_t s = 1;
+            while (s < n) s <<= 1;
+            return s;
+        }
+        static constexpr size_t SLOTS = pow2AtLeast(N * 2);
+        static constexpr size_t BUCKETS = pow2AtLeast((N + 1) / 2);
+        /// 버킷 하나에서 시도할 최대 변위값 (넘으면 isValid() == false)
+        /// Why: 서로 다른 해시의 버킷은 보통 수십 번 안에 배치되므로, 작은 상한으로 실패 시에도 상수 식 연산 한도를 넘지 않게 합니다.
+        static constexpr uint32_t MAX_DISPLACEMENT = 0x3FF;
+        /// 슬롯에는 항목 번호 + 1을 저장합니다. (0은 빈 슬롯)
+        using SlotIndex = typename std::conditional<(N < 0xFF), uint8_t, uint16_t>::type;
+
+    public:
+        using Entry = StringEntry<Value>;
+
+        /// 항목을 복사하고 충돌 없는 배치를 찾습니다. (상수 식에서 평가해야 런타임 구성 비용이 없음)
+        constexpr PerfectStringTable(const Entry (&entries)[N]) noexcept
+            : _entries{}, _slots{}, _displacement{}, _valid(true) {
+            for (size_t i = 0; i < N; ++i) _entries[i] = entries[i];
+            build();
+        }
+
+        /// 항목 수를 반환합니다.
+        constexpr size_t size() const noexcept { return N; }
+        /// 내부 슬롯 수를 반환합니다.
+        constexpr size_t slotCount() const noexcept { return SLOTS; }
+        /// 모든 키가 서로 다른 슬롯에 배치되었는지 확인합니다. (중복 키가 있으면 false, static_assert용)
+        constexpr bool isValid() const noexcept { return _valid; }
+        /// 등록 순서의 index번째 항목을 반환합니다.
+        constexpr const Entry& operator[](size_t index) const noexcept { return _entries[index]; }
+        constexpr const Entry* begin() const noexcept { return _entries; }
+        constexpr const Entry* end() const noexcept { return _entries + N; }
+
+        /// [indexOf] 키의 등록 순서 위치를 찾습니다.
+        /// @return 위치 (없으면 StringView::npos)
+        constexpr size_t indexOf(StringView key) const noexcept {
+            const uint32_t h = key.hash(IgnoreCase);
+            const SlotIndex s = _slots[slotOf(h, _displacement[bucketOf(h)])];
+            if (s == 0) return StringView::npos;
+            const StringView k = _entries[s - 1].key;
+            if (k.length() != key.length()) return StringView::npos;
+            for (size_t i = 0; i < k.length(); ++i) {
+                if (detail::tableFold(k[i], IgnoreCase) != detail::tableFold(key[i], IgnoreCase)) return StringView::npos;
+            }
+            return (size_t)(s - 1);
+        }
+
+        /// [find] 키에 해당하는 값을 찾습니다.
+        /// @return 값 포인터 (없으면 nullptr)
+        constexpr const Value* find(StringView key) const noexcept {
+            const size_t i = indexOf(key);
+            return i == StringView::npos ? nullptr : &_entries[i].value;
+        }
+
+        /// 키 존재 여부를 확인합니다.
+        constexpr bool contains(StringView key) const noexcept { return indexOf(key) != StringView::npos; }
+
+    private:
+        static constexpr size_t bucketOf(uint32_t h) noexcept { return (size_t)(h >> 16) & (BUCKETS - 1); }
+        /// 해시와 변위값을 섞어 슬롯을 고릅니다. (murmur3 finalizer)
+        static constexpr size_t slotOf(uint32_t h, uint16_t d) noexcept {
+            uint32_t x = h ^ ((uint32_t)d * 0x9E3779B9u);
+            x ^= x >> 16;
+            x *= 0x85EBCA6Bu;
+            x ^= x >> 13;
+            return (size_t)x & (SLOTS - 1);
+        }
+
+        /// [build] 해시-변위 배치
+        ///
+        /// 0) 해시가 같은 항목 쌍이 있으면(중복 키 또는 32비트 해시 충돌) 어떤 d로도 분리할 수 없으므로 즉시 _valid = false
+        /// 1) 항목이 많은 버킷부터 처리 (빈 슬롯이 많을 때 어려운 버킷을 먼저 배치)
+        /// 2) 버킷의 모든 키가 빈 슬롯에 서로 겹치지 않고 들어가는 첫 변위값 d를 찾음
+        /// 3) MAX_DISPLACEMENT까지 안 되면 _valid = false
+        constexpr void build() noexcept {
+            uint32_t hashes[N] = {};
+            size_t load[BUCKETS] = {};
+            bool done[BUCKETS] = {};
+            for (size_t i = 0; i < N; ++i) {
+                hashes[i] = _entries[i].key.hash(IgnoreCase);
+                for (size_t j = 0; j < i; ++j) {
+                    // slotOf는 해시에만 의존하므로 같은 해시의 두 키는 항상 같은 슬롯을 원합니다.
+                    if (hashes[j] == hashes[i]) {
+                        _valid = false;
+                        return;
+                    }
+                }
+                load[bucketOf(hashes[i])]++;
+            }
+
+            for (size_t round = 0; round < BUCKETS; ++round) {
+                size_t b = 0, most = 0;
+                for (size_t j = 0; j < BUCKETS; ++j) {
+                    if (!done[j] && load[j] > most) { most = load[j]; b = j; }
+                }
+                if (most == 0) return;
+                done[b] = true;
+
+                bool placed = false;
+                for (uint32_t d = 0; d <= MAX_DISPLACEMENT && !placed; ++d) {
+                    placed = true;
+                    size_t i = 0;
+                    for (; i < N; ++i) {
+                        if (bucketOf(hashes[i]) != b) continue;
+                        const size_t s = slotOf(hashes[i], (uint16_t)d);
+                        if (_slots[s] != 0) { placed = false; break; }
+                        _slots[s] = (SlotIndex)(i + 1);
+                    }
+                    if (placed) {
+                        _displacement[b] = (uint16_t)d;
+                    } else {
+                        // 이번 시도에서 차지한 슬롯을 되돌립니다.
+                        for (size_t k = 0; k < i; ++k) {
+                            if (bucketOf(hashes[k]) == b) _slots[slotOf(hashes[k], (uint16_t)d)] = 0;
+                        }
+                    }
+                }
+                if (!placed) {
+                    _valid = false;
+                    return;
+                }
+            }
+        }
+
+        Entry _entries[N];                 ///< 등록 순서의 항목
+        SlotIndex _slots[SLOTS];           ///< 항목 번호 + 1 (0은 빈 슬롯)
+        uint16_t _displacement[BUCKETS];   ///< 버킷별 변위값
+        bool _valid;                       ///< 배치 성공 여부
+    };
+
+    /// [makeStringTable] 항목 배열에서 N을 추론하여 StringTable을 만듭니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// static constexpr auto kTable = cms::makeStringTable(kEntries);          // 대소문자 구분
+    /// static constexpr auto kTableIc = cms::makeStringTable<true>(kEntries);  // 대소문자 무시
+    /// @endcode
+    template<bool IgnoreCase = false, typename Value, size_t N>
+    constexpr StringTable<Value, N, IgnoreCase> makeStringTable(const StringEntry<Value> (&entries)[N]) noexcept {
+        return StringTable<Value, N, IgnoreCase>(entries);
+    }
+
+    /// [makePerfectStringTable] 항목 배열에서 N을 추론하여 PerfectStringTable을 만듭니다.
+    template<bool IgnoreCase = false, typename Value, size_t N>
+    constexpr PerfectStringTable<Value, N, IgnoreCase> makePerfectStringTable(const StringEntry<Value> (&entries)[N]) noexcept {
+        return PerfectStringTable<Value, N, IgnoreCase>(entries);
+    }
+
+} // namespace cms
@@ -7,9 +7,31 @@
 // ==================================================================================================
 
 #include <cstring>     // strlen, strstr, memcpy, memmove
-#include <cstdlib>     // strtol
+#include <cstdlib>     // strtol, strtod, strtof
+#include <limits>      // numeric_limits (inf, nan)
+#include <cfloat>      // FLT_EVAL_METHOD
+#include <climits>     // INT_MIN, INT_MAX
 #include <sys/types.h> // regex_t 타입
-#include <cstdint>     // uint64_t
+#include <cstdint>     // uint64_t, uintptr_t, intmax_t
+#include <cstddef>     // ptrdiff_t
+
+// 호스트/고성능 코어에서만 SIMD 커널을 활성화합니다. (MCU는 SWAR 경로 사용)
+#if defined(__SSE2__)
+#include <emmintrin.h> // _mm_cmpgt_epi8, _mm_sad_epu8
+#define CMS_SIMD_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>  // vcgtq_s8, vpaddlq_u8
+#define CMS_SIMD_NEON 1
+#endif
+
+// SWAR 숫자 파싱은 바이트 순서에 의존하므로 리틀 엔디언에서만 활성화합니다. (ESP32, x86, ARM 모두 해당)
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define CMS_LITTLE_ENDIAN 1
+#elif defined(_M_X64) || defined(_M_IX86) || defined(_M_ARM64)
+#define CMS_LITTLE_ENDIAN 1
+#else
+#define CMS_LITTLE_ENDIAN 0
+#endif
 
 #ifdef ARDUINO
 // Arduino는 기본 환경에 정규식이 없으므로 POSIX regex를 명시적으로 포함합니다.
@@ -18,6 +40,7 @@
 
 
 #include "cmsStringUtil.h"   // cms::string 선언
+#include "cmsTrace.h"        // CMS_TRACE
 
 // ==================================================================================================
 // [cms::string] 개요
@@ -26,80 +49,116 @@
 // ==================================================================================================
 
 namespace {
-    // 소수점 처리를 위한 10의 거듭제곱 테이블 (최대 9자리)
-    static const double powersOf10[] = {
-        1.0, 10.0, 100.0, 1000.0, 10000.0, 100000.0, 1000000.0, 10000000.0, 100000000.0, 1000000000.0
+    // 2글자 단위 룩업 테이블 (나눗셈 횟수 50% 절감)
+    static const char kDigitPairs[] =
+        "0001020304050607080910111213141516171819"
+        "2021222324252627282930313233343536373839"
+        "4041424344454647484950515253545556575859"
+        "6061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    // 자릿수 판정용 10의 거듭제곱 (10^0 ~ 10^19)
+    static const uint64_t kPow10u64[] = {
+        1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+        1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull,
+        100000000000000ull, 1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+        1000000000000000000ull, 10000000000000000000ull
     };
 
-    // 반올림 보정을 위한 테이블 (0.5 / 10^n)
-    static const double roundingOffsets[] = {
-        0.5, 0.05, 0.005, 0.0005, 0.00005, 0.000005, 0.0000005, 0.00000005, 0.000000005, 0.0000000005
-    };
+    /// [bitWidth] 값을 표현하는 데 필요한 비트 수 (0은 1)
+    inline int bitWidth(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+        return 64 - __builtin_clzll(v | 1);
+#else
+        int n = 1;
+        while (v >>= 1) n++;
+        return n;
+#endif
+    }
+
+    /// [countDigits] 10진 자릿수 계산 (분기 1회)
+    ///
+    /// 비트 수 * log10(2) (≈ 1233 / 4096) 로 자릿수를 추정한 뒤 테이블 비교 한 번으로 보정합니다.
+    inline int countDigits(uint64_t v) {
+        v |= 1; // 0도 1자리 (10^t는 짝수이므로 최하위 비트는 결과에 영향 없음)
+        const int t = (bitWidth(v) * 1233) >> 12;
+        return t + 1 - (v < kPow10u64[t] ? 1 : 0);
+    }
+
+    /// [writeDigitsBackward] end 위치부터 거꾸로 10진 자릿수를 기록
+    ///
+    /// 32비트를 넘는 값은 10^8 단위로 한 번만 64비트 나눗셈을 하고, 나머지는 32비트 연산으로 처리합니다.
+    /// (ESP32 같은 32비트 코어에서 64비트 나눗셈은 라이브러리 호출이므로 최소화합니다.)
+    inline void writeDigitsBackward(char* end, uint64_t v) {
+        while (v > 0xFFFFFFFFull) {
+            uint32_t low = (uint32_t)(v % 100000000u);
+            v /= 100000000u;
+            for (int i = 0; i < 4; ++i) {
+                const unsigned idx = (low % 100) << 1;
+                low /= 100;
+                *--end = kDigitPairs[idx + 1];
+                *--end = kDigitPairs[idx];
+            }
+        }
+        uint32_t v32 = (uint32_t)v;
+        // 2자리씩 처리
+        while (v32 >= 100) {
+            const unsigned idx = (v32 % 100) << 1;
+            v32 /= 100;
+            *--end = kDigitPairs[idx + 1];
+            *--end = kDigitPairs[idx];
+        }
+        // 남은 1~2자리 처리
+        if (v32 >= 10) {
+            const unsigned idx = v32 << 1;
+            *--end = kDigitPairs[idx + 1];
+            *--end = kDigitPairs[idx];
+        } else {
+            *--end = (char)('0' + v32);
+        }
+    }
 
     /// [appendUIntInternal] 부호 없는 정수를 문자열로 변환하여 추가
     ///
     /// printf의 무거운 로직 없이 정수를 텍스트로 고속 직렬화하기 위해 사용합니다.
     /// 2글자 단위 룩업 테이블을 사용하여 나눗셈 연산을 절반으로 줄이고 성능을 최적화합니다.
+    /// 부호는 printf와 같이 '0' 채움이면 채움 앞에, ' ' 채움이면 숫자 바로 앞에 둡니다.
     ///
     /// @param buffer 결과 저장 버퍼
     /// @param maxLen 버퍼 최대 크기
     /// @param curLen [IN/OUT] 현재 길이
-    /// @param uval 변환할 값
-    /// @param width 최소 출력 너비
+    /// @param uval 변환할 값 (64비트 전체 범위)
+    /// @param width 최소 출력 너비 (부호 포함)
     /// @param padChar 채움 문자
-    void appendUIntInternal(char* buffer, size_t maxLen, size_t& curLen, unsigned long uval, int width, char padChar) {
-        // 1. 숫자 자릿수 계산 (분기 예측 최적화)
-        int digitsCount;
-        if (uval < 10) digitsCount = 1;
-        else if (uval < 100) digitsCount = 2;
-        else if (uval < 1000) digitsCount = 3;
-        else if (uval < 10000) digitsCount = 4;
-        else if (uval < 100000) digitsCount = 5;
-        else if (uval < 1000000) digitsCount = 6;
-        else if (uval < 10000000) digitsCount = 7;
-        else if (uval < 100000000) digitsCount = 8;
-        else if (uval < 1000000000) digitsCount = 9;
-        else digitsCount = 10;
+    /// @param negative true이면 '-' 부호를 붙입니다.
+    /// @return 버려진 바이트 수 (공간이 부족하면 출력 전체 길이, 기록했으면 0)
+    size_t appendUIntInternal(char* buffer, size_t maxLen, size_t& curLen, uint64_t uval, int width, char padChar,
+                              bool negative = false) {
+        // 1. 숫자 자릿수 계산 (clz 기반, 분기 최소화)
+        const int digitsCount = countDigits(uval);
+        const int bodyLen = digitsCount + (negative ? 1 : 0);
 
         // 2. 전체 출력 길이 결정 (Padding 포함)
-        int totalLen = (digitsCount > width) ? digitsCount : width;
+        const int totalLen = (bodyLen > width) ? bodyLen : width;
 
-        // 3. 버퍼 공간 확인
-        if (curLen + totalLen >= maxLen) return;
+        // 3. 버퍼 공간 확인 (부호만 남는 등의 부분 기록 없이 전부 또는 전무)
+        if (!buffer || curLen + (size_t)totalLen >= maxLen) return (size_t)totalLen;
 
-        // 4. 끝 지점부터 역순으로 채우기 (Reverse 과정 생략)
-        size_t startIdx = curLen;
-        size_t writeIdx = curLen + totalLen;
-        curLen = writeIdx;
-        buffer[writeIdx] = '\0';
-
-        unsigned long v = uval;
-        // 2글자 단위 룩업 테이블 (나눗셈 횟수 50% 절감)
-        static const char digitsTable[] =
-            "0001020304050607080910111213141516171819"
-            "2021222324252627282930313233343536373839"
-            "4041424344454647484950515253545556575859"
-            "6061626364656667686970717273747576777879"
-            "8081828384858687888990919293949596979899";
-
-        // 2자리씩 처리
-        while (v >= 100) {
-            unsigned int i = (v % 100) << 1;
-            v /= 100;
-            buffer[--writeIdx] = digitsTable[i + 1];
-            buffer[--writeIdx] = digitsTable[i];
-        }
-        // 남은 1~2자리 처리
-        if (v >= 10) {
-            unsigned int i = v << 1;
-            buffer[--writeIdx] = digitsTable[i + 1];
-            buffer[--writeIdx] = digitsTable[i];
+        // 4. 채움 → 부호 → 숫자 순서로 배치
+        char* out = buffer + curLen;
+        int pad = totalLen - bodyLen;
+        if (padChar == '0') {
+            if (negative) *out++ = '-';
+            while (pad-- > 0) *out++ = '0';
         } else {
-            buffer[--writeIdx] = (char)(v + '0');
-        }
-        while (writeIdx > startIdx) {
-            buffer[--writeIdx] = padChar;
+            while (pad-- > 0) *out++ = padChar;
+            if (negative) *out++ = '-';
         }
+        writeDigitsBackward(out + digitsCount, uval);
+
+        curLen += (size_t)totalLen;
+        buffer[curLen] = '\0';
+        return 0;
         }
 
         /// [computeLPS] KMP 알고리즘용 부분 일치 테이블(LPS) 생성
@@ -133,21 +192,14 @@ namespace {
     /// 메모리 주소나 바이너리 데이터를 사람이 읽기 쉬운 16진수 형태로 표현하기 위해 사용합니다.
     /// 비트 시프트(>> 4)와 마스킹(& 0xF)을 사용하여 나눗셈 없이 고속으로 변환합니다.
     /// @param uppercase true: 대문자(ABC), false: 소문자(abc)
-    void appendHexInternal(char* buffer, size_t maxLen, size_t& curLen, unsigned long uval, int width, char padChar, bool uppercase) {
-        // 1. 16진수 자릿수 계산 (비트 연산 활용)
-        int digitsCount = 0;
-        unsigned long temp = uval;
-        if (temp == 0) digitsCount = 1;
-        else {
-            while (temp > 0) {
-                temp >>= 4; // 16으로 나누기
-                digitsCount++;
-            }
-        }
+    /// @return 버려진 바이트 수 (공간이 부족하면 출력 전체 길이, 기록했으면 0)
+    size_t appendHexInternal(char* buffer, size_t maxLen, size_t& curLen, uint64_t uval, int width, char padChar, bool uppercase) {
+        // 1. 16진수 자릿수 계산 (비트 폭 / 4 올림)
+        const int digitsCount = (bitWidth(uval) + 3) >> 2;
 
         // 2. 전체 출력 길이 결정
         int totalLen = (digitsCount > width) ? digitsCount : width;
-        if (curLen + totalLen >= maxLen) return;
+        if (!buffer || curLen + (size_t)totalLen >= maxLen) return (size_t)totalLen;
 
         // 3. 버퍼 공간 확보 및 NUL 종료
         size_t startIdx = curLen;
@@ -157,7 +209,7 @@ namespace {
 
         // 4. 역순으로 16진수 문자 채우기
         const char* hexChars = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
-        unsigned long v = uval;
+        uint64_t v = uval;
         for (int i = 0; i < digitsCount; ++i) {
             buffer[--writeIdx] = hexChars[v & 0xF];
             v >>= 4;
@@ -165,33 +217,1776 @@ namespace {
         while (writeIdx > startIdx) {
             buffer[--writeIdx] = padChar;
         }
+        return 0;
+    }
+
+    /// [LengthModifier] printf 길이 수정자 (hh, h, l, ll, z, j, t)
+    enum class LengthModifier : uint8_t { None, Char, Short, Long, LongLong, Size, Max, Ptrdiff };
+
+    /// [fetchSigned] 길이 수정자에 맞는 타입으로 부호 있는 인자를 꺼냅니다.
+    long long fetchSigned(va_list* ap, LengthModifier mod) {
+        switch (mod) {
+            case LengthModifier::Char:     return (signed char)va_arg(*ap, int);
+            case LengthModifier::Short:    return (short)va_arg(*ap, int);
+            case LengthModifier::Long:     return va_arg(*ap, long);
+            case LengthModifier::LongLong: return va_arg(*ap, long long);
+            case LengthModifier::Size:     return (long long)va_arg(*ap, size_t);
+            case LengthModifier::Max:      return (long long)va_arg(*ap, intmax_t);
+            case LengthModifier::Ptrdiff:  return (long long)va_arg(*ap, ptrdiff_t);
+            default:                       return va_arg(*ap, int);
+        }
+    }
+
+    /// [fetchUnsigned] 길이 수정자에 맞는 타입으로 부호 없는 인자를 꺼냅니다.
+    uint64_t fetchUnsigned(va_list* ap, LengthModifier mod) {
+        switch (mod) {
+            case LengthModifier::Char:     return (unsigned char)va_arg(*ap, unsigned int);
+            case LengthModifier::Short:    return (unsigned short)va_arg(*ap, unsigned int);
+            case LengthModifier::Long:     return va_arg(*ap, unsigned long);
+            case LengthModifier::LongLong: return va_arg(*ap, unsigned long long);
+            case LengthModifier::Size:     return va_arg(*ap, size_t);
+            case LengthModifier::Max:      return (uint64_t)va_arg(*ap, uintmax_t);
+            case LengthModifier::Ptrdiff:  return (uint64_t)va_arg(*ap, ptrdiff_t);
+            default:                       return va_arg(*ap, unsigned int);
+        }
+    }
+
+    /// [countUtf8Leads] UTF-8 선두 바이트(글자 시작 바이트) 개수 집계
+    ///
+    /// 글자 수 = 전체 바이트 - 후속 바이트(10xxxxxx) 이므로, 선두 바이트만 세면 디코딩 없이 글자 수를 얻습니다.
+    /// SSE2/NEON 환경에서는 16바이트 비교 결과를 바이트 카운터에 누적하고 255회마다 합산하며,
+    /// 그 외 환경에서는 워드 단위 SWAR 연산으로 후속 바이트 비트를 뽑아 popcount 합니다.
+    ///
+    /// @param p 검사할 바이트 시작 주소
+    /// @param len 검사할 바이트 길이
+    /// @return 선두 바이트(= 논리적 글자) 개수
+    size_t countUtf8Leads(const unsigned char* p, size_t len) {
+        size_t count = 0;
+        size_t i = 0;
+
+#if defined(CMS_SIMD_SSE2)
+        // 부호 있는 비교에서 0xC0~0xFF, 0x00~0x7F는 -65보다 크고, 후속 바이트(0x80~0xBF)만 작거나 같습니다.
+        const __m128i threshold = _mm_set1_epi8(-65);
+        const __m128i zero = _mm_setzero_si128();
+        while (i + 16 <= len) {
+            __m128i acc = _mm_setzero_si128();
+            size_t blocks = (len - i) / 16;
+            if (blocks > 255) blocks = 255; // 바이트 카운터 오버플로우 방지
+            for (size_t b = 0; b < blocks; ++b, i += 16) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+                // 비교 결과(0xFF = -1)를 빼서 레인별로 +1 누적
+                acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(v, threshold));
+            }
+            __m128i sums = _mm_sad_epu8(acc, zero);
+            count += (size_t)_mm_cvtsi128_si32(sums) + (size_t)_mm_cvtsi128_si32(_mm_srli_si128(sums, 8));
+        }
+#elif defined(CMS_SIMD_NEON)
+        const int8x16_t threshold = vdupq_n_s8(-65);
+        while (i + 16 <= len) {
+            uint8x16_t acc = vdupq_n_u8(0);
+            size_t blocks = (len - i) / 16;
+            if (blocks > 255) blocks = 255;
+            for (size_t b = 0; b < blocks; ++b, i += 16) {
+                int8x16_t v = vreinterpretq_s8_u8(vld1q_u8(p + i));
+                acc = vsubq_u8(acc, vcgtq_s8(v, threshold));
+            }
+            uint64x2_t sums = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(acc)));
+            count += (size_t)(vgetq_lane_u64(sums, 0) + vgetq_lane_u64(sums, 1));
+        }
+#else
+        // SWAR: 후속 바이트는 bit7=1, bit6=0 이므로 (x & ~(x << 1)) & 0x80.. 으로 추출됩니다.
+        const size_t highBits = (size_t)~(size_t)0 / 0xFF * 0x80;
+        while (i + sizeof(size_t) <= len) {
+            size_t w;
+            memcpy(&w, p + i, sizeof(size_t));
+            size_t cont = (w & ~(w << 1)) & highBits;
+#if defined(__GNUC__) || defined(__clang__)
+            // LLP64(Windows)에서는 unsigned long이 32비트이므로 64비트 버전으로 셉니다.
+            count += sizeof(size_t) - (size_t)__builtin_popcountll((unsigned long long)cont);
+#else
+            size_t n = 0;
+            while (cont) { cont &= cont - 1; n++; }
+            count += sizeof(size_t) - n;
+#endif
+            i += sizeof(size_t);
+        }
+#endif
+
+        // 남은 꼬리 바이트 처리
+        for (; i < len; ++i) {
+            if ((p[i] & 0xC0) != 0x80) count++;
+        }
+        return count;
+    }
+
+    /// [lowestSetBit] 비트 마스크에서 가장 낮은 1비트의 위치 반환
+    inline unsigned lowestSetBit(uint64_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+        return (unsigned)__builtin_ctzll(mask);
+#else
+        unsigned n = 0;
+        while (!(mask & 1)) { mask >>= 1; n++; }
+        return n;
+#endif
+    }
+
+    /// [findAnyOfVector] 문자 집합 검색의 벡터 본체
+    ///
+    /// 집합의 각 문자를 레지스터에 브로드캐스트한 뒤 16바이트 블록과 비교하여 OR로 합칩니다.
+    /// 일치 마스크가 생기면 가장 낮은 비트로 첫 위치를 바로 계산합니다.
+    ///
+    /// @param p 검색 시작 주소
+    /// @param len 검색할 바이트 길이
+    /// @param set 찾을 문자 집합 (최대 8개)
+    /// @param setLen 집합 크기
+    /// @param pos [IN/OUT] 검사를 시작할 오프셋 (발견하지 못하면 처리한 위치까지 전진)
+    /// @return true: 발견 (pos가 발견 위치), false: 벡터 구간에서 미발견
+    bool findAnyOfVector(const unsigned char* p, size_t len, const char* set, size_t setLen, size_t& pos) {
+#if defined(CMS_SIMD_SSE2)
+        __m128i needles[8];
+        for (size_t k = 0; k < setLen; ++k) needles[k] = _mm_set1_epi8(set[k]);
+        size_t i = pos;
+        for (; i + 16 <= len; i += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            __m128i m = _mm_cmpeq_epi8(v, needles[0]);
+            for (size_t k = 1; k < setLen; ++k) m = _mm_or_si128(m, _mm_cmpeq_epi8(v, needles[k]));
+            unsigned mask = (unsigned)_mm_movemask_epi8(m);
+            if (mask) { pos = i + lowestSetBit(mask); return true; }
+        }
+        pos = i;
+        return false;
+#elif defined(CMS_SIMD_NEON)
+        uint8x16_t needles[8];
+        for (size_t k = 0; k < setLen; ++k) needles[k] = vdupq_n_u8((uint8_t)set[k]);
+        size_t i = pos;
+        for (; i + 16 <= len; i += 16) {
+            uint8x16_t v = vld1q_u8(p + i);
+            uint8x16_t m = vceqq_u8(v, needles[0]);
+            for (size_t k = 1; k < setLen; ++k) m = vorrq_u8(m, vceqq_u8(v, needles[k]));
+            // NEON에는 movemask가 없으므로 16비트 레인을 4비트씩 좁혀 64비트 니블 마스크를 만듭니다.
+            uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+            if (mask) { pos = i + (lowestSetBit(mask) >> 2); return true; }
+        }
+        pos = i;
+        return false;
+#else
+        // SWAR: 워드 내에 0 바이트가 있는지 (x - 0x01..) & ~x & 0x80.. 으로 검사합니다.
+        // 후보가 발견된 워드는 정확한 위치를 위해 스칼라 꼬리 루프에 넘깁니다.
+        const size_t ones = (size_t)~(size_t)0 / 0xFF;
+        const size_t highBits = ones * 0x80;
+        size_t i = pos;
+        for (; i + sizeof(size_t) <= len; i += sizeof(size_t)) {
+            size_t w;
+            memcpy(&w, p + i, sizeof(size_t));
+            size_t hit = 0;
+            for (size_t k = 0; k < setLen; ++k) {
+                size_t x = w ^ (ones * (unsigned char)set[k]);
+                hit |= (x - ones) & ~x & highBits;
+            }
+            if (hit) break;
+        }
+        pos = i;
+        return false;
+#endif
+    }
+
+    /// [findUtf8CharStart] UTF-8 논리적 인덱스의 물리적 주소 탐색
+    ///
+    /// 멀티바이트 환경에서 'n번째 글자'가 실제 메모리의 어디에 위치하는지 정확히 찾기 위해 필요합니다.
+    /// UTF-8의 후속 바이트 비트 패턴(10xxxxxx)을 건너뛰며 논리적 글자 수를 카운트합니다.
+    ///
+    /// @param str 검색할 UTF-8 문자열
+    /// @param charIdx 찾고자 하는 글자의 논리적 위치 (0부터 시작)
+    /// @return 해당 글자가 시작되는 메모리 주소
+    const char* findUtf8CharStart(const char* str, size_t charIdx) {
+        // 1. 입력 문자열이 유효하지 않으면 즉시 종료합니다.
+        if (!str) return nullptr;
+
+        const char* p = str;
+        size_t count = 0;
+
+        // 2. 문자열의 끝을 만나거나, 원하는 문자 인덱스(charIdx)에 도달할 때까지 바이트를 훑습니다.
+        while (*p && count < charIdx) {
+            // UTF-8 규칙: 바이트의 상위 2비트가 '10'이면 이전 문자에 딸린 '후속 바이트'입니다.
+            // 따라서 '10'이 아닌 경우에만 새로운 문자가 시작된 것으로 보고 카운트를 올립니다.
+            if ((*p & 0xC0) != 0x80) count++;
+            p++;
+        }
+        // 3. 만약 루프가 끝났는데 p가 후속 바이트 중간을 가리키고 있다면, 다음 문자의 시작점까지 전진합니다.
+        while (*p && (*p & 0xC0) == 0x80) p++;
+        return p;
+    }
+
+    /// [findUtf8CharStart] 길이 제한 버전 (NUL 대신 end에서 멈춤, 범위를 넘으면 end 반환)
+    const char* findUtf8CharStart(const char* str, const char* end, size_t charIdx) {
+        const char* p = str;
+        size_t count = 0;
+        while (p < end && count < charIdx) {
+            if ((*p & 0xC0) != 0x80) count++;
+            p++;
+        }
+        while (p < end && (*p & 0xC0) == 0x80) p++;
+        return p;
+    }
+
+    // ==============================================================================================
+    // [Float Engine] Grisu2 왕복(Round-Trip) 실수 → 10진수 변환 (Shortest 형식)
+    // - 왜 존재하는가: unsigned long 캐스팅 기반 변환은 4.3e9 이상에서 오버플로우하고, 지수 표기가 불가능했습니다.
+    // - 어떻게 동작하는가: 64비트 정수 연산(DiyFp)과 10^k 캐시 테이블만으로 "다시 읽었을 때 같은 값이 되는"
+    //   짧은 자릿수를 생성합니다. (Grisu2는 대부분 최단이지만 항상 최단을 보장하지는 않습니다.) 루프 안에서 double 연산을 하지 않으므로 FPU가 없는 MCU에서도 빠릅니다.
+    //   (Florian Loitsch, "Printing Floating-Point Numbers Quickly and Accurately with Integers", 2010)
+    // ==============================================================================================
+
+    /// [DiyFp] 가수(f) * 2^e 형태의 64비트 정수 부동소수점
+    struct DiyFp {
+        uint64_t f;
+        int e;
+    };
+
+    /// [CachedPower] 정규화된 10^k 근사값 (f * 2^e ≈ 10^k)
+    struct CachedPower {
+        uint64_t f;
+        int16_t e;
+        int16_t k;
+    };
+
+    // Grisu2가 요구하는 곱셈 결과 지수 범위 [kAlpha, kGamma]
+    constexpr int kGrisuAlpha = -60;
+    constexpr int kGrisuGamma = -32;
+    constexpr int kCachedPowersMinDecExp = -300;
+    constexpr int kCachedPowersDecStep = 8;
+
+    /// 10^-300 ~ 10^324 를 8 단위로 저장한 테이블 (79개, 약 950바이트)
+    /// 정확한 큰 정수 연산으로 생성하였으며, 가수는 최근접 반올림입니다.
+    static const CachedPower kCachedPowers[] = {
+        { 0xAB70FE17C79AC6CAULL, -1060, -300 },
+        { 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+        { 0xBE5691EF416BD60CULL, -1007, -284 },
+        { 0x8DD01FAD907FFC3CULL,  -980, -276 },
+        { 0xD3515C2831559A83ULL,  -954, -268 },
+        { 0x9D71AC8FADA6C9B5ULL,  -927, -260 },
+        { 0xEA9C227723EE8BCBULL,  -901, -252 },
+        { 0xAECC49914078536DULL,  -874, -244 },
+        { 0x823C12795DB6CE57ULL,  -847, -236 },
+        { 0xC21094364DFB5637ULL,  -821, -228 },
+        { 0x9096EA6F3848984FULL,  -794, -220 },
+        { 0xD77485CB25823AC7ULL,  -768, -212 },
+        { 0xA086CFCD97BF97F4ULL,  -741, -204 },
+        { 0xEF340A98172AACE5ULL,  -715, -196 },
+        { 0xB23867FB2A35B28EULL,  -688, -188 },
+        { 0x84C8D4DFD2C63F3BULL,  -661, -180 },
+        { 0xC5DD44271AD3CDBAULL,  -635, -172 },
+        { 0x936B9FCEBB25C996ULL,  -608, -164 },
+        { 0xDBAC6C247D62A584ULL,  -582, -156 },
+        { 0xA3AB66580D5FDAF6ULL,  -555, -148 },
+        { 0xF3E2F893DEC3F126ULL,  -529, -140 },
+        { 0xB5B5ADA8AAFF80B8ULL,  -502, -132 },
+        { 0x87625F056C7C4A8BULL,  -475, -124 },
+        { 0xC9BCFF6034C13053ULL,  -449, -116 },
+        { 0x964E858C91BA2655ULL,  -422, -108 },
+        { 0xDFF9772470297EBDULL,  -396, -100 },
+        { 0xA6DFBD9FB8E5B88FULL,  -369,  -92 },
+        { 0xF8A95FCF88747D94ULL,  -343,  -84 },
+        { 0xB94470938FA89BCFULL,  -316,  -76 },
+        { 0x8A08F0F8BF0F156BULL,  -289,  -68 },
+        { 0xCDB02555653131B6ULL,  -263,  -60 },
+        { 0x993FE2C6D07B7FACULL,  -236,  -52 },
+        { 0xE45C10C42A2B3B06ULL,  -210,  -44 },
+        { 0xAA242499697392D3ULL,  -183,  -36 },
+        { 0xFD87B5F28300CA0EULL,  -157,  -28 },
+        { 0xBCE5086492111AEBULL,  -130,  -20 },
+        { 0x8CBCCC096F5088CCULL,  -103,  -12 },
+        { 0xD1B71758E219652CULL,   -77,   -4 },
+        { 0x9C40000000000000ULL,   -50,    4 },
+        { 0xE8D4A51000000000ULL,   -24,   12 },
+        { 0xAD78EBC5AC620000ULL,     3,   20 },
+        { 0x813F3978F8940984ULL,    30,   28 },
+        { 0xC097CE7BC90715B3ULL,    56,   36 },
+        { 0x8F7E32CE7BEA5C70ULL,    83,   44 },
+        { 0xD5D238A4ABE98068ULL,   109,   52 },
+        { 0x9F4F2726179A2245ULL,   136,   60 },
+        { 0xED63A231D4C4FB27ULL,   162,   68 },
+        { 0xB0DE65388CC8ADA8ULL,   189,   76 },
+        { 0x83C7088E1AAB65DBULL,   216,   84 },
+        { 0xC45D1DF942711D9AULL,   242,   92 },
+        { 0x924D692CA61BE758ULL,   269,  100 },
+        { 0xDA01EE641A708DEAULL,   295,  108 },
+        { 0xA26DA3999AEF774AULL,   322,  116 },
+        { 0xF209787BB47D6B85ULL,   348,  124 },
+        { 0xB454E4A179DD1877ULL,   375,  132 },
+        { 0x865B86925B9BC5C2ULL,   402,  140 },
+        { 0xC83553C5C8965D3DULL,   428,  148 },
+        { 0x952AB45CFA97A0B3ULL,   455,  156 },
+        { 0xDE469FBD99A05FE3ULL,   481,  164 },
+        { 0xA59BC234DB398C25ULL,   508,  172 },
+        { 0xF6C69A72A3989F5CULL,   534,  180 },
+        { 0xB7DCBF5354E9BECEULL,   561,  188 },
+        { 0x88FCF317F22241E2ULL,   588,  196 },
+        { 0xCC20CE9BD35C78A5ULL,   614,  204 },
+        { 0x98165AF37B2153DFULL,   641,  212 },
+        { 0xE2A0B5DC971F303AULL,   667,  220 },
+        { 0xA8D9D1535CE3B396ULL,   694,  228 },
+        { 0xFB9B7CD9A4A7443CULL,   720,  236 },
+        { 0xBB764C4CA7A44410ULL,   747,  244 },
+        { 0x8BAB8EEFB6409C1AULL,   774,  252 },
+        { 0xD01FEF10A657842CULL,   800,  260 },
+        { 0x9B10A4E5E9913129ULL,   827,  268 },
+        { 0xE7109BFBA19C0C9DULL,   853,  276 },
+        { 0xAC2820D9623BF429ULL,   880,  284 },
+        { 0x80444B5E7AA7CF85ULL,   907,  292 },
+        { 0xBF21E44003ACDD2DULL,   933,  300 },
+        { 0x8E679C2F5E44FF8FULL,   960,  308 },
+        { 0xD433179D9C8CB841ULL,   986,  316 },
+        { 0x9E19DB92B4E31BA9ULL,  1013,  324 },
+    };
+
+    /// [diyMul] 두 DiyFp의 곱 (128비트 곱의 상위 64비트, 반올림)
+    inline DiyFp diyMul(const DiyFp& x, const DiyFp& y) {
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 p = (unsigned __int128)x.f * y.f;
+        uint64_t h = (uint64_t)(p >> 64) + (((uint64_t)p >> 63) & 1);
+        return DiyFp{h, x.e + y.e + 64};
+#else
+        const uint64_t uLo = x.f & 0xFFFFFFFFu, uHi = x.f >> 32;
+        const uint64_t vLo = y.f & 0xFFFFFFFFu, vHi = y.f >> 32;
+        const uint64_t p0 = uLo * vLo, p1 = uLo * vHi, p2 = uHi * vLo, p3 = uHi * vHi;
+        uint64_t q = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+        q += (uint64_t)1 << 31; // 반올림
+        const uint64_t h = p3 + (p2 >> 32) + (p1 >> 32) + (q >> 32);
+        return DiyFp{h, x.e + y.e + 64};
+#endif
+    }
+
+    /// [diyNormalize] 최상위 비트가 1이 되도록 정규화
+    inline DiyFp diyNormalize(DiyFp x) {
+#if defined(__GNUC__) || defined(__clang__)
+        const int shift = __builtin_clzll(x.f);
+        x.f <<= shift;
+        x.e -= shift;
+#else
+        while (!(x.f >> 63)) { x.f <<= 1; x.e--; }
+#endif
+        return x;
+    }
+
+    /// [computeBoundaries] 값 v와 반올림 경계(m-, m+)를 계산
+    ///
+    /// 경계 사이의 어떤 10진수를 출력해도 다시 읽으면 v가 되므로, 그 중 짧은 것을 찾습니다.
+    /// single=true이면 float의 정밀도(24비트)로 경계를 계산하여 3.14f가 "3.14"로 출력되도록 합니다.
+    ///
+    /// @param value 변환할 값 (양수, 유한값)
+    /// @param single float 정밀도 사용 여부
+    /// @param w [OUT] 정규화된 값
+    /// @param mMinus [OUT] 하한 경계
+    /// @param mPlus [OUT] 상한 경계
+    void computeBoundaries(double value, bool single, DiyFp& w, DiyFp& mMinus, DiyFp& mPlus) {
+        uint64_t F;
+        int E;
+        uint64_t hidden;
+        int bias;
+        if (single) {
+            const float fv = (float)value;
+            uint32_t bits;
+            memcpy(&bits, &fv, sizeof(bits));
+            E = (int)((bits >> 23) & 0xFF);
+            F = bits & 0x7FFFFFu;
+            hidden = (uint64_t)1 << 23;
+            bias = 127 + 23;
+        } else {
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            E = (int)((bits >> 52) & 0x7FF);
+            F = bits & (((uint64_t)1 << 52) - 1);
+            hidden = (uint64_t)1 << 52;
+            bias = 1023 + 52;
+        }
+
+        const DiyFp x = (E == 0) ? DiyFp{F, 1 - bias} : DiyFp{F + hidden, E - bias};
+        // 가수가 2의 거듭제곱이면 아래쪽 간격이 절반입니다.
+        const bool lowerCloser = (F == 0 && E > 1);
+
+        mPlus = diyNormalize(DiyFp{2 * x.f + 1, x.e - 1});
+        const DiyFp m = lowerCloser ? DiyFp{4 * x.f - 1, x.e - 2} : DiyFp{2 * x.f - 1, x.e - 1};
+        mMinus = DiyFp{m.f << (m.e - mPlus.e), mPlus.e};
+        w = diyNormalize(x);
+    }
+
+    /// [grisuRound] 마지막 자릿수를 실제 값에 더 가깝게 보정
+    inline void grisuRound(char* buf, int len, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t tenK) {
+        while (rest < dist && delta - rest >= tenK &&
+               (rest + tenK < dist || dist - rest > rest + tenK - dist)) {
+            buf[len - 1]--;
+            rest += tenK;
+        }
+    }
+
+    /// [grisu2] 양의 유한값을 왕복 가능한 짧은 10진 자릿수로 변환
+    ///
+    /// @param value 변환할 값 (0 초과, 유한값)
+    /// @param single float 정밀도 사용 여부
+    /// @param buf [OUT] 자릿수 문자 ('0'~'9', 최대 17개, NUL 없음)
+    /// @param exp10 [OUT] value = buf * 10^exp10
+    /// @return 생성된 자릿수 개수
+    int grisu2(double value, bool single, char* buf, int& exp10) {
+        DiyFp v, mMinus, mPlus;
+        computeBoundaries(value, single, v, mMinus, mPlus);
+
+        // 1. 곱셈 결과의 지수가 [alpha, gamma]에 들도록 10^-k를 선택합니다.
+        const int f = kGrisuAlpha - mPlus.e - 1;
+        const int k = (f * 78913) / (1 << 18) + (f > 0 ? 1 : 0); // ceil(f * log10(2))
+        const int index = (-kCachedPowersMinDecExp + k + (kCachedPowersDecStep - 1)) / kCachedPowersDecStep;
+        const CachedPower& cached = kCachedPowers[index];
+        const DiyFp c{cached.f, cached.e};
+
+        const DiyFp w = diyMul(v, c);
+        const DiyFp wMinus = diyMul(mMinus, c);
+        const DiyFp wPlus = diyMul(mPlus, c);
+        // 곱셈 오차(각 1ulp)를 고려해 안전 구간을 양쪽에서 1씩 좁힙니다.
+        const DiyFp lo{wMinus.f + 1, wMinus.e};
+        const DiyFp hi{wPlus.f - 1, wPlus.e};
+        exp10 = -cached.k;
+
+        // 2. 자릿수 생성: hi를 정수부(p1)와 소수부(p2)로 나눠 구간 안에 들 때까지 한 자리씩 뽑습니다.
+        uint64_t delta = hi.f - lo.f;
+        uint64_t dist = hi.f - w.f;
+        const int shift = -hi.e;
+        const uint64_t one = (uint64_t)1 << shift;
+        uint32_t p1 = (uint32_t)(hi.f >> shift);
+        uint64_t p2 = hi.f & (one - 1);
+
+        static const uint32_t pow10Table[] = {
+            1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u
+        };
+        int n = 10;
+        while (n > 1 && p1 < pow10Table[n - 1]) n--; // p1의 자릿수
+        int len = 0;
+
+        while (n > 0) {
+            const uint32_t pow10 = pow10Table[n - 1];
+            buf[len++] = (char)('0' + p1 / pow10);
+            p1 %= pow10;
+            n--;
+            const uint64_t rest = ((uint64_t)p1 << shift) + p2;
+            if (rest <= delta) {
+                exp10 += n;
+                grisuRound(buf, len, dist, delta, rest, (uint64_t)pow10 << shift);
+                return len;
+            }
+        }
+
+        int m = 0;
+        for (;;) {
+            p2 *= 10;
+            buf[len++] = (char)('0' + (p2 >> shift));
+            p2 &= one - 1;
+            m++;
+            delta *= 10;
+            dist *= 10;
+            if (p2 <= delta) break;
+        }
+        exp10 -= m;
+        grisuRound(buf, len, dist, delta, p2, one);
+        return len;
+    }
+
+    // printf 계열과 동일한 기본 정밀도
+    constexpr int kDefaultFloatPrecision = 6;
+    // 소수점 이하 최대 출력 자릿수 (스택 없이 직접 기록하지만 비정상 입력으로 인한 과도한 출력 방지)
+    constexpr int kMaxFloatPrecision = 40;
+    // 고정 표기에서 필요한 최대 자릿수 (DBL_MAX의 정수부 309자리 + 소수부)
+    constexpr int kMaxDecimalDigits = 309 + kMaxFloatPrecision + 1;
+
+    /// [DecimalDigits] 0.d1d2d3... * 10^point 형태의 10진 표현
+    struct DecimalDigits {
+        char d[kMaxDecimalDigits]; ///< 자릿수 문자 (NUL 없음)
+        int n;                     ///< 유효 자릿수 개수
+        int point;                 ///< 소수점 위치 (첫 자릿수의 가중치는 10^(point-1))
+    };
+
+    /// [toDecimal] 양의 유한값을 왕복 가능한 짧은 10진 표현으로 변환 (Shortest 전용, 0은 "0")
+    inline void toDecimal(double value, bool single, DecimalDigits& dec) {
+        if (value == 0.0) {
+            dec.d[0] = '0';
+            dec.n = 1;
+            dec.point = 1;
+            return;
+        }
+        int exp10;
+        dec.n = grisu2(value, single, dec.d, exp10);
+        dec.point = dec.n + exp10;
+    }
+
+    // ==============================================================================================
+    // [Float Engine] 정밀도 지정 형식(%f/%e/%g)의 정확한 자릿수 생성
+    // - 왜 존재하는가: Grisu2의 짧은 자릿수를 다시 반올림하면 두 번 반올림하게 되어 printf와 결과가 달라집니다.
+    //   (2.675는 실제로 2.67499999...이므로 %.2f는 "2.67"이어야 합니다.)
+    // - 어떻게 동작하는가: 값을 m * 2^e로 분해한 뒤, 정수부는 큰 정수를 10^9로 나눠 10진수로 바꾸고,
+    //   소수부는 2^k 분모의 분자에 10을 곱해 한 자리씩 정확히 뽑습니다. 필요한 자리까지만 만든 뒤
+    //   남은 값을 절반(2^(k-1))과 비교해 Half-Even으로 반올림합니다. 보통 값은 분자가 1~2워드라 빠르며,
+    //   1e-300처럼 극단적인 값만 최대 35워드(140바이트)를 사용합니다.
+    // ==============================================================================================
+
+    /// [BigUInt] 고정 크기 부호 없는 큰 정수 (32비트 워드, 리틀 엔디언)
+    struct BigUInt {
+        static constexpr int kWords = 35; ///< 2^1078 미만 (가장 작은 비정규 수의 소수부 * 10)
+        uint32_t w[kWords];
+        int n; ///< 사용 중인 워드 수 (최상위 워드는 0이 아님, 0이면 n == 0)
+
+        void set(uint64_t v) {
+            w[0] = (uint32_t)v;
+            w[1] = (uint32_t)(v >> 32);
+            n = w[1] ? 2 : (w[0] ? 1 : 0);
+        }
+        bool isZero() const { return n == 0; }
+        void trim() { while (n > 0 && w[n - 1] == 0) n--; }
+
+        void shiftLeft(int bits) {
+            if (n == 0 || bits == 0) return;
+            const int words = bits / 32;
+            const int rem = bits % 32;
+            int top = n + words;
+            w[top] = 0;
+            for (int i = n - 1; i >= 0; --i) {
+                const uint64_t v = (uint64_t)w[i] << rem;
+                w[i + words + 1] |= (uint32_t)(v >> 32);
+                w[i + words] = (uint32_t)v;
+            }
+            for (int i = 0; i < words; ++i) w[i] = 0;
+            n = top + 1;
+            trim();
+        }
+
+        void mulSmall(uint32_t m) {
+            uint64_t carry = 0;
+            for (int i = 0; i < n; ++i) {
+                const uint64_t v = (uint64_t)w[i] * m + carry;
+                w[i] = (uint32_t)v;
+                carry = v >> 32;
+            }
+            if (carry) w[n++] = (uint32_t)carry;
+        }
+
+        /// 자신을 d로 나누고 나머지를 반환합니다.
+        uint32_t divSmall(uint32_t d) {
+            uint64_t rem = 0;
+            for (int i = n - 1; i >= 0; --i) {
+                const uint64_t cur = (rem << 32) | w[i];
+                w[i] = (uint32_t)(cur / d);
+                rem = cur % d;
+            }
+            trim();
+            return (uint32_t)rem;
+        }
+
+        /// bit번째 비트부터 위쪽 값을 반환합니다. (결과가 32비트에 들어가는 경우만 사용)
+        uint32_t bitsFrom(int bit) const {
+            const int i = bit / 32;
+            const int r = bit % 32;
+            if (i >= n) return 0;
+            uint64_t v = w[i];
+            if (i + 1 < n) v |= (uint64_t)w[i + 1] << 32;
+            return (uint32_t)(v >> r);
+        }
+
+        /// bit번째 이상의 비트를 지웁니다.
+        void keepBelow(int bit) {
+            const int i = bit / 32;
+            if (i >= n) return;
+            w[i] &= (bit % 32) ? ((1u << (bit % 32)) - 1) : 0u;
+            n = i + 1;
+            trim();
+        }
+
+        /// 2^(bit - 1)(절반)과 비교합니다. (자신은 2^bit 미만, 작으면 -1, 같으면 0, 크면 1)
+        int compareHalf(int bit) const {
+            if (bit == 0) return isZero() ? -1 : 1;
+            const int h = bit - 1;
+            const int i = h / 32;
+            if (i >= n) return -1;
+            const uint32_t hb = 1u << (h % 32);
+            if (!(w[i] & hb)) return -1;
+            if (w[i] & (hb - 1)) return 1;
+            for (int j = 0; j < i; ++j) if (w[j]) return 1;
+            return 0;
+        }
+    };
+
+    /// [exactDigits] 양의 유한값을 정확히 전개하여 요청한 자릿수에서 Half-Even 반올림
+    ///
+    /// @param fixed true: count는 소수점 이하 자릿수(%f), false: count는 유효 자릿수(%e/%g, 1 이상)
+    /// @param dec [OUT] 반올림된 자릿수 (첫 자리는 0이 아님, 값이 0으로 반올림되면 "0")
+    void exactDigits(double value, bool fixed, int count, DecimalDigits& dec) {
+        dec.n = 0;
+        dec.point = 1;
+        if (value == 0.0) {
+            dec.d[0] = '0';
+            dec.n = 1;
+            return;
+        }
+
+        // 1. value = m * 2^e (m은 홀수로 줄여 분모를 최소화)
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        const int be = (int)((bits >> 52) & 0x7FF);
+        uint64_t m = bits & (((uint64_t)1 << 52) - 1);
+        int e;
+        if (be == 0) {
+            e = -1074;
+        } else {
+            m |= (uint64_t)1 << 52;
+            e = be - 1075;
+        }
+        while ((m & 1) == 0) { m >>= 1; e++; }
+
+        // 2. 정수부 자릿수를 dec.d 앞쪽에 기록하고, 소수부는 frac / 2^k로 남깁니다.
+        BigUInt frac;
+        int k = 0;
+        int intLen = 0;
+        {
+            BigUInt whole;
+            if (e >= 0) {
+                whole.set(m);
+                whole.shiftLeft(e);
+                frac.set(0);
+            } else {
+                k = -e;
+                whole.set(k < 64 ? (m >> k) : 0);
+                frac.set(k < 64 ? (m & (((uint64_t)1 << k) - 1)) : m);
+            }
+            // 10^9 단위로 나눠 아래 자리부터 모은 뒤 뒤집습니다.
+            uint32_t chunks[BigUInt::kWords + 1];
+            int c = 0;
+            while (!whole.isZero()) chunks[c++] = whole.divSmall(1000000000u);
+            for (int i = c - 1; i >= 0; --i) {
+                char tmp[9];
+                uint32_t v = chunks[i];
+                for (int j = 8; j >= 0; --j) { tmp[j] = (char)('0' + v % 10); v /= 10; }
+                int j = 0;
+                if (i == c - 1) while (j < 8 && tmp[j] == '0') j++; // 최상위 청크의 앞자리 0 제거
+                for (; j < 9; ++j) dec.d[intLen++] = tmp[j];
+            }
+        }
+        dec.point = intLen;
+
+        // 소수부 다음 자리 하나를 뽑습니다. (frac < 2^k 유지)
+        auto nextFracDigit = [&]() -> char {
+            if (k == 0) return '0';
+            frac.mulSmall(10);
+            const char digit = (char)('0' + frac.bitsFrom(k));
+            frac.keepBelow(k);
+            return digit;
+        };
+
+        // 3. 남길 자릿수까지 채우고, 버리는 부분을 절반과 비교합니다.
+        int cmp; // 버리는 부분 vs 마지막 자리의 절반 (-1, 0, 1)
+        int target = fixed ? intLen + count : count;
+        if (target > kMaxDecimalDigits) target = kMaxDecimalDigits;
+        if (!fixed && intLen == 0) {
+            // 첫 유효 자리가 나올 때까지 소수점 뒤 0을 건너뜁니다.
+            char digit;
+            while ((digit = nextFracDigit()) == '0') dec.point--;
+            dec.d[dec.n++] = digit;
+        }
+        if (target < intLen) {
+            // 정수부 중간에서 자름 (%e): 다음 자리와 그 뒤의 0이 아닌 값으로 판단
+            dec.n = target;
+            const char next = dec.d[target];
+            bool rest = !frac.isZero();
+            for (int i = target + 1; i < intLen && !rest; ++i) rest = dec.d[i] != '0';
+            cmp = next > '5' ? 1 : (next < '5' ? -1 : (rest ? 1 : 0));
+        } else {
+            if (dec.n < intLen) dec.n = intLen;
+            while (dec.n < target) dec.d[dec.n++] = nextFracDigit();
+            cmp = frac.compareHalf(k);
+        }
+
+        // 4. Half-Even 반올림 (정확히 절반이면 마지막 자리가 홀수일 때만 올림)
+        const bool lastOdd = dec.n > 0 && ((dec.d[dec.n - 1] - '0') & 1);
+        if (cmp > 0 || (cmp == 0 && lastOdd)) {
+            int i = dec.n - 1;
+            while (i >= 0 && dec.d[i] == '9') dec.d[i--] = '0';
+            if (i >= 0) {
+                dec.d[i]++;
+            } else {
+                // 전부 9였거나 남긴 자리가 없음: 1 뒤에 0이 붙는 값이 되므로 자리 하나를 올립니다.
+                dec.d[0] = '1';
+                dec.n = 1;
+                dec.point++;
+            }
+        }
+
+        // 5. 앞자리 0(고정 표기의 0.00x)을 point로 옮기고 끝자리 0을 정리합니다.
+        int lead = 0;
+        while (lead < dec.n && dec.d[lead] == '0') lead++;
+        if (lead == dec.n) {
+            dec.d[0] = '0';
+            dec.n = 1;
+            dec.point = 1;
+            return;
+        }
+        if (lead > 0) {
+            memmove(dec.d, dec.d + lead, (size_t)(dec.n - lead));
+            dec.n -= lead;
+            dec.point -= lead;
+        }
+        while (dec.n > 1 && dec.d[dec.n - 1] == '0') dec.n--;
+    }
+
+    /// [FloatWriter] 출력 길이 계산(dst == nullptr)과 실제 기록을 같은 코드로 수행하는 작성기
+    struct FloatWriter {
+        char* dst;
+        size_t n;
+        inline void put(char c) { if (dst) dst[n] = c; n++; }
+        inline void repeat(char c, int count) { for (int i = 0; i < count; ++i) put(c); }
+    };
+
+    /// 소수점 고정 표기로 기록합니다. (decimals: 소수점 이하 자리수)
+    void writeFixed(FloatWriter& w, const DecimalDigits& dec, int decimals) {
+        if (dec.point <= 0) {
+            w.put('0');
+        } else {
+            for (int i = 0; i < dec.point; ++i) w.put(i < dec.n ? dec.d[i] : '0');
+        }
+        if (decimals <= 0) return;
+        w.put('.');
+        for (int k = 0; k < decimals; ++k) {
+            const int idx = dec.point + k;
+            w.put((idx >= 0 && idx < dec.n) ? dec.d[idx] : '0');
+        }
+    }
+
+    /// 지수 표기(d.ddde+XX)로 기록합니다.
+    void writeExponent(FloatWriter& w, const DecimalDigits& dec, int decimals, bool uppercase, int minExpDigits) {
+        w.put(dec.d[0]);
+        if (decimals > 0) {
+            w.put('.');
+            for (int k = 1; k <= decimals; ++k) w.put(k < dec.n ? dec.d[k] : '0');
+        }
+        int x = (dec.d[0] == '0') ? 0 : dec.point - 1;
+        w.put(uppercase ? 'E' : 'e');
+        w.put(x < 0 ? '-' : '+');
+        if (x < 0) x = -x;
+        char tmp[4];
+        int t = 0;
+        do { tmp[t++] = (char)('0' + x % 10); x /= 10; } while (x > 0);
+        while (t < minExpDigits) tmp[t++] = '0';
+        while (t > 0) w.put(tmp[--t]);
+    }
+
+    /// 끝자리 0을 제거합니다. (%g / Shortest 용)
+    inline void trimTrailingZeros(DecimalDigits& dec) {
+        while (dec.n > 1 && dec.d[dec.n - 1] == '0') dec.n--;
+    }
+
+    /// [renderFloat] 부호/특수값/형식을 처리하여 작성기에 기록
+    void renderFloat(FloatWriter& w, double val, bool single, cms::string::FloatFormat format,
+                     int precision, bool uppercase, int width, char padChar) {
+        using cms::string::FloatFormat;
+
+        uint64_t bits;
+        memcpy(&bits, &val, sizeof(bits));
+        const bool negative = (bits >> 63) != 0;
+        const bool special = ((bits >> 52) & 0x7FF) == 0x7FF;
+        double mag = negative ? -val : val;
+
+        // 1. 본문을 먼저 길이 계산 모드로 그려 너비(Padding)를 결정합니다.
+        DecimalDigits dec;
+        int decimals = 0;
+        bool expForm = false;
+        int minExpDigits = 2;
+
+        if (!special) {
+            if (precision > kMaxFloatPrecision) precision = kMaxFloatPrecision;
+
+            // 정밀도 지정 형식은 값 자체를 정확히 전개해 한 번만 반올림합니다. (printf와 동일, float도 그 값 그대로)
+            switch (format) {
+                case FloatFormat::Fixed:
+                    decimals = (precision < 0) ? kDefaultFloatPrecision : precision;
+                    exactDigits(mag, true, decimals, dec);
+                    break;
+                case FloatFormat::Exponent:
+                    decimals = (precision < 0) ? kDefaultFloatPrecision : precision;
+                    exactDigits(mag, false, decimals + 1, dec);
+                    expForm = true;
+                    break;
+                case FloatFormat::General: {
+                    // C 표준 %g 규칙: 유효숫자 P로 반올림 후 지수 X가 -4 <= X < P 이면 고정 표기
+                    int p = (precision < 0) ? kDefaultFloatPrecision : (precision == 0 ? 1 : precision);
+                    exactDigits(mag, false, p, dec);
+                    trimTrailingZeros(dec);
+                    const int x = (dec.d[0] == '0') ? 0 : dec.point - 1;
+                    expForm = !(x >= -4 && x < p);
+                    decimals = expForm ? dec.n - 1 : (dec.n - dec.point > 0 ? dec.n - dec.point : 0);
+                    break;
+                }
+                case FloatFormat::Shortest: {
+                    // ECMAScript Number.toString과 같은 규칙: 1e-7 <= |v| < 1e21 이면 고정 표기
+                    toDecimal(mag, single, dec);
+                    trimTrailingZeros(dec);
+                    const int x = (dec.d[0] == '0') ? 0 : dec.point - 1;
+                    expForm = !(x >= -7 && x < 21);
+                    decimals = expForm ? dec.n - 1 : (dec.n - dec.point > 0 ? dec.n - dec.point : 0);
+                    minExpDigits = 1;
+                    break;
+                }
+            }
+        }
+
+        FloatWriter body{nullptr, 0};
+        if (special) {
+            body.n = 3; // "nan" / "inf"
+        } else if (expForm) {
+            writeExponent(body, dec, decimals, uppercase, minExpDigits);
+        } else {
+            writeFixed(body, dec, decimals);
+        }
+
+        const size_t signLen = negative ? 1 : 0;
+        const size_t pad = ((size_t)width > body.n + signLen) ? (size_t)width - body.n - signLen : 0;
+        // 특수값은 0으로 채우지 않습니다. (printf 동작과 동일)
+        if (special && padChar == '0') padChar = ' ';
+
+        // 2. 실제 기록: 공백 패딩은 부호 앞, 0 패딩은 부호 뒤에 둡니다.
+        if (padChar != '0') w.repeat(padChar, (int)pad);
+        if (negative) w.put('-');
+        if (padChar == '0') w.repeat('0', (int)pad);
+        if (special) {
+            const bool nan = (bits & (((uint64_t)1 << 52) - 1)) != 0;
+            const char* s = nan ? (uppercase ? "NAN" : "nan") : (uppercase ? "INF" : "inf");
+            for (int i = 0; i < 3; ++i) w.put(s[i]);
+        } else if (expForm) {
+            writeExponent(w, dec, decimals, uppercase, minExpDigits);
+        } else {
+            writeFixed(w, dec, decimals);
+        }
+    }
+
+    /// [appendFloatInternal] 실수를 지정 형식으로 버퍼 끝에 추가 (전부 기록하거나 아무것도 기록하지 않음)
+    ///
+    /// @param single Shortest 자릿수를 float 정밀도로 계산할지 여부
+    /// @param precision 정밀도 (-1이면 형식별 기본값)
+    /// @param width 최소 출력 너비
+    /// @param padChar 채움 문자 (' ' 또는 '0')
+    /// @return 버려진 바이트 수 (공간이 부족하면 출력 전체 길이, 기록했으면 0)
+    size_t appendFloatInternal(char* buffer, size_t maxLen, size_t& curLen, double val, bool single,
+                               cms::string::FloatFormat format, int precision, bool uppercase,
+                               int width, char padChar) {
+        // 1. 필요한 길이를 먼저 계산하여 공간이 부족하면 반쯤 잘린 숫자를 남기지 않습니다.
+        FloatWriter counter{nullptr, 0};
+        renderFloat(counter, val, single, format, precision, uppercase, width, padChar);
+        if (!buffer || curLen + counter.n >= maxLen) return counter.n;
+
+        // 2. 같은 경로로 실제 기록합니다.
+        FloatWriter writer{buffer + curLen, 0};
+        renderFloat(writer, val, single, format, precision, uppercase, width, padChar);
+        curLen += writer.n;
+        buffer[curLen] = '\0';
+        return 0;
+    }
+
+    // ==============================================================================================
+    // [Float Parser] Clinger 고속 경로 + Eisel-Lemire 정확 반올림 실수 파서
+    // - 왜 존재하는가: 자리마다 double 나눗셈을 하던 기존 toFloat는 느리고 부정확했으며 지수(1e-3)를 무시했습니다.
+    // - 어떻게 동작하는가: 최대 19자리 가수를 정수로 모은 뒤(8자리 SWAR),
+    //   1) 가수와 10^q가 모두 정확히 표현되면 곱셈/나눗셈 한 번(Clinger),
+    //   2) 아니면 5^q의 128비트 근사값과 64x64 곱셈 한 번으로 정확히 반올림된 비트를 계산(Eisel-Lemire),
+    //   3) 테이블 범위를 벗어나거나 20자리 이상에서 반올림이 모호한 드문 경우만 strtod로 넘깁니다.
+    // ==============================================================================================
+
+    static_assert(sizeof(double) == 8 && sizeof(float) == 4, "cms float engine requires IEEE-754 binary64/binary32.");
+
+    /// [read8] 8바이트를 워드로 읽기 (정렬 무관)
+    inline uint64_t read8(const char* p) {
+        uint64_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    /// [isEightDigits] 워드의 8바이트가 모두 '0'~'9'인지 검사 (SWAR, 리틀 엔디언)
+    inline bool isEightDigits(uint64_t v) {
+        return (((v & 0xF0F0F0F0F0F0F0F0ull) | (((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4))
+                == 0x3333333333333333ull);
+    }
+
+    /// [parseEightDigits] 8자리 ASCII 숫자를 곱셈 3번으로 정수 변환 (SWAR, 리틀 엔디언)
+    ///
+    /// 인접 바이트 쌍 → 2자리, 2자리 쌍 → 4자리, 4자리 쌍 → 8자리 순으로 한 번에 합칩니다.
+    inline uint32_t parseEightDigits(uint64_t v) {
+        const uint64_t mask = 0x000000FF000000FFull;
+        const uint64_t mul1 = 0x000F424000000064ull; // 100 + (1000000 << 32)
+        const uint64_t mul2 = 0x0000271000000001ull; // 1 + (10000 << 32)
+        v -= 0x3030303030303030ull;
+        v = (v * 10) + (v >> 8);
+        v = (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+        return (uint32_t)v;
+    }
+
+    /// [DecimalScan] 10진 실수 문자열의 구문 분석 결과
+    struct DecimalScan {
+        uint64_t w;          ///< 유효숫자 (최대 19자리)
+        int64_t exp10;       ///< value = w * 10^exp10
+        bool negative;       ///< 음수 여부
+        bool truncated;      ///< 19자리를 넘는 숫자가 잘렸는지 여부
+        const char* intBegin;
+        const char* intEnd;
+        const char* fracBegin;
+        const char* fracEnd;
+        int64_t explicitExp; ///< 'e' 뒤에 명시된 지수
+        const char* end;     ///< 파싱이 끝난 위치
+    };
+
+    /// [scanDigits] 연속된 10진 숫자를 가수에 누적 (오버플로우는 호출자가 자릿수로 판단)
+    inline const char* scanDigits(const char* p, const char* last, uint64_t& w) {
+#if CMS_LITTLE_ENDIAN
+        while (last - p >= 8) {
+            const uint64_t v = read8(p);
+            if (!isEightDigits(v)) break;
+            w = w * 100000000u + parseEightDigits(v);
+            p += 8;
+        }
+#endif
+        while (p < last && (unsigned char)(*p - '0') < 10) {
+            w = w * 10 + (uint64_t)(*p - '0');
+            p++;
+        }
+        return p;
+    }
+
+    /// [scanDecimal] 부호, 정수부, 소수부, 지수부를 분석
+    ///
+    /// @return false: 숫자가 하나도 없음 (Invalid)
+    bool scanDecimal(const char* p, const char* last, DecimalScan& out) {
+        out.negative = false;
+        out.truncated = false;
+        if (p < last && (*p == '-' || *p == '+')) {
+            out.negative = (*p == '-');
+            p++;
+        }
+
+        uint64_t w = 0;
+        out.intBegin = p;
+        p = scanDigits(p, last, w);
+        out.intEnd = p;
+        out.fracBegin = out.fracEnd = p;
+        if (p < last && *p == '.') {
+            p++;
+            out.fracBegin = p;
+            p = scanDigits(p, last, w);
+            out.fracEnd = p;
+        }
+
+        const int64_t intDigits = out.intEnd - out.intBegin;
+        const int64_t fracDigits = out.fracEnd - out.fracBegin;
+        if (intDigits + fracDigits == 0) return false;
+
+        // 지수부: 'e' 뒤에 숫자가 없으면 'e'는 숫자의 일부가 아닙니다. (예: "5e" → 5, 끝 위치는 'e')
+        out.explicitExp = 0;
+        if (p < last && (*p == 'e' || *p == 'E')) {
+            const char* e = p + 1;
+            bool expNeg = false;
+            if (e < last && (*e == '-' || *e == '+')) {
+                expNeg = (*e == '-');
+                e++;
+            }
+            if (e < last && (unsigned char)(*e - '0') < 10) {
+                int64_t ev = 0;
+                while (e < last && (unsigned char)(*e - '0') < 10) {
+                    if (ev < 100000) ev = ev * 10 + (*e - '0'); // 과도한 지수는 포화
+                    e++;
+                }
+                out.explicitExp = expNeg ? -ev : ev;
+                p = e;
+            }
+        }
+        out.end = p;
+        out.exp10 = out.explicitExp - fracDigits;
+
+        // 19자리를 넘으면 가수가 넘쳤으므로 앞쪽 유효숫자 19자리만 다시 모읍니다.
+        int64_t digitCount = intDigits + fracDigits;
+        if (digitCount > 19) {
+            const char* s = out.intBegin;
+            while (s < out.fracEnd && (*s == '0' || *s == '.')) {
+                if (*s == '0') digitCount--;
+                s++;
+            }
+            if (digitCount > 19) {
+                const uint64_t minNineteen = 1000000000000000000ull;
+                out.truncated = true;
+                w = 0;
+                const char* q = out.intBegin;
+                while (w < minNineteen && q < out.intEnd) w = w * 10 + (uint64_t)(*q++ - '0');
+                if (w >= minNineteen) {
+                    out.exp10 = out.explicitExp + (out.intEnd - q);
+                } else {
+                    q = out.fracBegin;
+                    while (w < minNineteen && q < out.fracEnd) w = w * 10 + (uint64_t)(*q++ - '0');
+                    out.exp10 = out.explicitExp - (q - out.fracBegin);
+                }
+            }
+        }
+        out.w = w;
+        return true;
+    }
+
+    /// [BinaryFormat] IEEE-754 형식별 상수 (binary64 / binary32)
+    struct BinaryFormat {
+        int mantissaBits;     ///< 명시적 가수 비트 수
+        int minExponent;      ///< -bias
+        int infinitePower;    ///< 무한대의 지수 필드 값
+        int minRoundToEven;   ///< 짝수 반올림 모호성 검사 구간 (q 하한)
+        int maxRoundToEven;   ///< 짝수 반올림 모호성 검사 구간 (q 상한)
+        int smallestPow10;    ///< 이보다 작은 10^q는 0으로 수렴
+        int largestPow10;     ///< 이보다 큰 10^q는 무한대
+        int maxExactPow10;    ///< Clinger 경로에서 정확히 표현되는 최대 10^q
+    };
+
+    constexpr BinaryFormat kBinary64 = { 52, -1023, 0x7FF, -4, 23, -342, 308, 22 };
+    constexpr BinaryFormat kBinary32 = { 23, -127, 0xFF, -17, 10, -65, 38, 10 };
+
+    // 5^q 의 정규화된 128비트 근사값 테이블 범위 (binary32 전체와 일반적인 센서/JSON 값을 포함)
+    constexpr int kPow5MinQ = -128;
+    constexpr int kPow5MaxQ = 128;
+
+    /// 5^q (q = -128..128) 를 최상위 비트가 1이 되도록 정규화한 128비트 값 (상위, 하위)
+    /// 정확한 큰 정수 연산으로 생성했으며 음수 q는 올림(+1) 후 절삭한 값입니다. (fast_float와 동일 규칙)
+    static const uint64_t kPow5Table[] = {
+        0xDDD0467C64BCE4A0ULL, 0xAC7CB3F6D05DDBDEULL, // 5^-128
+        0x8AA22C0DBEF60EE4ULL, 0x6BCDF07A423AA96BULL, // 5^-127
+        0xAD4AB7112EB3929DULL, 0x86C16C98D2C953C6ULL, // 5^-126
+        0xD89D64D57A607744ULL, 0xE871C7BF077BA8B7ULL, // 5^-125
+        0x87625F056C7C4A8BULL, 0x11471CD764AD4972ULL, // 5^-124
+        0xA93AF6C6C79B5D2DULL, 0xD598E40D3DD89BCFULL, // 5^-123
+        0xD389B47879823479ULL, 0x4AFF1D108D4EC2C3ULL, // 5^-122
+        0x843610CB4BF160CBULL, 0xCEDF722A585139BAULL, // 5^-121
+        0xA54394FE1EEDB8FEULL, 0xC2974EB4EE658828ULL, // 5^-120
+        0xCE947A3DA6A9273EULL, 0x733D226229FEEA32ULL, // 5^-119
+        0x811CCC668829B887ULL, 0x0806357D5A3F525FULL, // 5^-118
+        0xA163FF802A3426A8ULL, 0xCA07C2DCB0CF26F7ULL, // 5^-117
+        0xC9BCFF6034C13052ULL, 0xFC89B393DD02F0B5ULL, // 5^-116
+        0xFC2C3F3841F17C67ULL, 0xBBAC2078D443ACE2ULL, // 5^-115
+        0x9D9BA7832936EDC0ULL, 0xD54B944B84AA4C0DULL, // 5^-114
+        0xC5029163F384A931ULL, 0x0A9E795E65D4DF11ULL, // 5^-113
+        0xF64335BCF065D37DULL, 0x4D4617B5FF4A16D5ULL, // 5^-112
+        0x99EA0196163FA42EULL, 0x504BCED1BF8E4E45ULL, // 5^-111
+        0xC06481FB9BCF8D39ULL, 0xE45EC2862F71E1D6ULL, // 5^-110
+        0xF07DA27A82C37088ULL, 0x5D767327BB4E5A4CULL, // 5^-109
+        0x964E858C91BA2655ULL, 0x3A6A07F8D510F86FULL, // 5^-108
+        0xBBE226EFB628AFEAULL, 0x890489F70A55368BULL, // 5^-107
+        0xEADAB0ABA3B2DBE5ULL, 0x2B45AC74CCEA842EULL, // 5^-106
+        0x92C8AE6B464FC96FULL, 0x3B0B8BC90012929DULL, // 5^-105
+        0xB77ADA0617E3BBCBULL, 0x09CE6EBB40173744ULL, // 5^-104
+        0xE55990879DDCAABDULL, 0xCC420A6A101D0515ULL, // 5^-103
+        0x8F57FA54C2A9EAB6ULL, 0x9FA946824A12232DULL, // 5^-102
+        0xB32DF8E9F3546564ULL, 0x47939822DC96ABF9ULL, // 5^-101
+        0xDFF9772470297EBDULL, 0x59787E2B93BC56F7ULL, // 5^-100
+        0x8BFBEA76C619EF36ULL, 0x57EB4EDB3C55B65AULL, // 5^-99
+        0xAEFAE51477A06B03ULL, 0xEDE622920B6B23F1ULL, // 5^-98
+        0xDAB99E59958885C4ULL, 0xE95FAB368E45ECEDULL, // 5^-97
+        0x88B402F7FD75539BULL, 0x11DBCB0218EBB414ULL, // 5^-96
+        0xAAE103B5FCD2A881ULL, 0xD652BDC29F26A119ULL, // 5^-95
+        0xD59944A37C0752A2ULL, 0x4BE76D3346F0495FULL, // 5^-94
+        0x857FCAE62D8493A5ULL, 0x6F70A4400C562DDBULL, // 5^-93
+        0xA6DFBD9FB8E5B88EULL, 0xCB4CCD500F6BB952ULL, // 5^-92
+        0xD097AD07A71F26B2ULL, 0x7E2000A41346A7A7ULL, // 5^-91
+        0x825ECC24C873782FULL, 0x8ED400668C0C28C8ULL, // 5^-90
+        0xA2F67F2DFA90563BULL, 0x728900802F0F32FAULL, // 5^-89
+        0xCBB41EF979346BCAULL, 0x4F2B40A03AD2FFB9ULL, // 5^-88
+        0xFEA126B7D78186BCULL, 0xE2F610C84987BFA8ULL, // 5^-87
+        0x9F24B832E6B0F436ULL, 0x0DD9CA7D2DF4D7C9ULL, // 5^-86
+        0xC6EDE63FA05D3143ULL, 0x91503D1C79720DBBULL, // 5^-85
+        0xF8A95FCF88747D94ULL, 0x75A44C6397CE912AULL, // 5^-84
+        0x9B69DBE1B548CE7CULL, 0xC986AFBE3EE11ABAULL, // 5^-83
+        0xC24452DA229B021BULL, 0xFBE85BADCE996168ULL, // 5^-82
+        0xF2D56790AB41C2A2ULL, 0xFAE27299423FB9C3ULL, // 5^-81
+        0x97C560BA6B0919A5ULL, 0xDCCD879FC967D41AULL, // 5^-80
+        0xBDB6B8E905CB600FULL, 0x5400E987BBC1C920ULL, // 5^-79
+        0xED246723473E3813ULL, 0x290123E9AAB23B68ULL, // 5^-78
+        0x9436C0760C86E30BULL, 0xF9A0B6720AAF6521ULL, // 5^-77
+        0xB94470938FA89BCEULL, 0xF808E40E8D5B3E69ULL, // 5^-76
+        0xE7958CB87392C2C2ULL, 0xB60B1D1230B20E04ULL, // 5^-75
+        0x90BD77F3483BB9B9ULL, 0xB1C6F22B5E6F48C2ULL, // 5^-74
+        0xB4ECD5F01A4AA828ULL, 0x1E38AEB6360B1AF3ULL, // 5^-73
+        0xE2280B6C20DD5232ULL, 0x25C6DA63C38DE1B0ULL, // 5^-72
+        0x8D590723948A535FULL, 0x579C487E5A38AD0EULL, // 5^-71
+        0xB0AF48EC79ACE837ULL, 0x2D835A9DF0C6D851ULL, // 5^-70
+        0xDCDB1B2798182244ULL, 0xF8E431456CF88E65ULL, // 5^-69
+        0x8A08F0F8BF0F156BULL, 0x1B8E9ECB641B58FFULL, // 5^-68
+        0xAC8B2D36EED2DAC5ULL, 0xE272467E3D222F3FULL, // 5^-67
+        0xD7ADF884AA879177ULL, 0x5B0ED81DCC6ABB0FULL, // 5^-66
+        0x86CCBB52EA94BAEAULL, 0x98E947129FC2B4E9ULL, // 5^-65
+        0xA87FEA27A539E9A5ULL, 0x3F2398D747B36224ULL, // 5^-64
+        0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AADULL, // 5^-63
+        0x83A3EEEEF9153E89ULL, 0x1953CF68300424ACULL, // 5^-62
+        0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD7ULL, // 5^-61
+        0xCDB02555653131B6ULL, 0x3792F412CB06794DULL, // 5^-60
+        0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD0ULL, // 5^-59
+        0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC4ULL, // 5^-58
+        0xC8DE047564D20A8BULL, 0xF245825A5A445275ULL, // 5^-57
+        0xFB158592BE068D2EULL, 0xEED6E2F0F0D56712ULL, // 5^-56
+        0x9CED737BB6C4183DULL, 0x55464DD69685606BULL, // 5^-55
+        0xC428D05AA4751E4CULL, 0xAA97E14C3C26B886ULL, // 5^-54
+        0xF53304714D9265DFULL, 0xD53DD99F4B3066A8ULL, // 5^-53
+        0x993FE2C6D07B7FABULL, 0xE546A8038EFE4029ULL, // 5^-52
+        0xBF8FDB78849A5F96ULL, 0xDE98520472BDD033ULL, // 5^-51
+        0xEF73D256A5C0F77CULL, 0x963E66858F6D4440ULL, // 5^-50
+        0x95A8637627989AADULL, 0xDDE7001379A44AA8ULL, // 5^-49
+        0xBB127C53B17EC159ULL, 0x5560C018580D5D52ULL, // 5^-48
+        0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A6ULL, // 5^-47
+        0x9226712162AB070DULL, 0xCAB3961304CA70E8ULL, // 5^-46
+        0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D22ULL, // 5^-45
+        0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506AULL, // 5^-44
+        0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB242ULL, // 5^-43
+        0xB267ED1940F1C61CULL, 0x55F038B237591ED3ULL, // 5^-42
+        0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6688ULL, // 5^-41
+        0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA015ULL, // 5^-40
+        0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081AULL, // 5^-39
+        0xD9C7DCED53C72255ULL, 0x96E7BD358C904A21ULL, // 5^-38
+        0x881CEA14545C7575ULL, 0x7E50D64177DA2E54ULL, // 5^-37
+        0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9E9ULL, // 5^-36
+        0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E864ULL, // 5^-35
+        0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113EULL, // 5^-34
+        0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58EULL, // 5^-33
+        0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF2ULL, // 5^-32
+        0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED7ULL, // 5^-31
+        0xA2425FF75E14FC31ULL, 0xA1258379A94D028DULL, // 5^-30
+        0xCAD2F7F5359A3B3EULL, 0x096EE45813A04330ULL, // 5^-29
+        0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FCULL, // 5^-28
+        0x9E74D1B791E07E48ULL, 0x775EA264CF55347EULL, // 5^-27
+        0xC612062576589DDAULL, 0x95364AFE032A819EULL, // 5^-26
+        0xF79687AED3EEC551ULL, 0x3A83DDBD83F52205ULL, // 5^-25
+        0x9ABE14CD44753B52ULL, 0xC4926A9672793543ULL, // 5^-24
+        0xC16D9A0095928A27ULL, 0x75B7053C0F178294ULL, // 5^-23
+        0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6339ULL, // 5^-22
+        0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E04ULL, // 5^-21
+        0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF585ULL, // 5^-20
+        0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E6ULL, // 5^-19
+        0x9392EE8E921D5D07ULL, 0x3AFF322E62439FD0ULL, // 5^-18
+        0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C3ULL, // 5^-17
+        0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B4ULL, // 5^-16
+        0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A11ULL, // 5^-15
+        0xB424DC35095CD80FULL, 0x538484C19EF38C95ULL, // 5^-14
+        0xE12E13424BB40E13ULL, 0x2865A5F206B06FBAULL, // 5^-13
+        0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D4ULL, // 5^-12
+        0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D749ULL, // 5^-11
+        0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1CULL, // 5^-10
+        0x89705F4136B4A597ULL, 0x31680A88F8953031ULL, // 5^-9
+        0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3EULL, // 5^-8
+        0xD6BF94D5E57A42BCULL, 0x3D32907604691B4DULL, // 5^-7
+        0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B110ULL, // 5^-6
+        0xA7C5AC471B478423ULL, 0x0FCF80DC33721D54ULL, // 5^-5
+        0xD1B71758E219652BULL, 0xD3C36113404EA4A9ULL, // 5^-4
+        0x83126E978D4FDF3BULL, 0x645A1CAC083126EAULL, // 5^-3
+        0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A4ULL, // 5^-2
+        0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCDULL, // 5^-1
+        0x8000000000000000ULL, 0x0000000000000000ULL, // 5^0
+        0xA000000000000000ULL, 0x0000000000000000ULL, // 5^1
+        0xC800000000000000ULL, 0x0000000000000000ULL, // 5^2
+        0xFA00000000000000ULL, 0x0000000000000000ULL, // 5^3
+        0x9C40000000000000ULL, 0x0000000000000000ULL, // 5^4
+        0xC350000000000000ULL, 0x0000000000000000ULL, // 5^5
+        0xF424000000000000ULL, 0x0000000000000000ULL, // 5^6
+        0x9896800000000000ULL, 0x0000000000000000ULL, // 5^7
+        0xBEBC200000000000ULL, 0x0000000000000000ULL, // 5^8
+        0xEE6B280000000000ULL, 0x0000000000000000ULL, // 5^9
+        0x9502F90000000000ULL, 0x0000000000000000ULL, // 5^10
+        0xBA43B74000000000ULL, 0x0000000000000000ULL, // 5^11
+        0xE8D4A51000000000ULL, 0x0000000000000000ULL, // 5^12
+        0x9184E72A00000000ULL, 0x0000000000000000ULL, // 5^13
+        0xB5E620F480000000ULL, 0x0000000000000000ULL, // 5^14
+        0xE35FA931A0000000ULL, 0x0000000000000000ULL, // 5^15
+        0x8E1BC9BF04000000ULL, 0x0000000000000000ULL, // 5^16
+        0xB1A2BC2EC5000000ULL, 0x0000000000000000ULL, // 5^17
+        0xDE0B6B3A76400000ULL, 0x0000000000000000ULL, // 5^18
+        0x8AC7230489E80000ULL, 0x0000000000000000ULL, // 5^19
+        0xAD78EBC5AC620000ULL, 0x0000000000000000ULL, // 5^20
+        0xD8D726B7177A8000ULL, 0x0000000000000000ULL, // 5^21
+        0x878678326EAC9000ULL, 0x0000000000000000ULL, // 5^22
+        0xA968163F0A57B400ULL, 0x0000000000000000ULL, // 5^23
+        0xD3C21BCECCEDA100ULL, 0x0000000000000000ULL, // 5^24
+        0x84595161401484A0ULL, 0x0000000000000000ULL, // 5^25
+        0xA56FA5B99019A5C8ULL, 0x0000000000000000ULL, // 5^26
+        0xCECB8F27F4200F3AULL, 0x0000000000000000ULL, // 5^27
+        0x813F3978F8940984ULL, 0x4000000000000000ULL, // 5^28
+        0xA18F07D736B90BE5ULL, 0x5000000000000000ULL, // 5^29
+        0xC9F2C9CD04674EDEULL, 0xA400000000000000ULL, // 5^30
+        0xFC6F7C4045812296ULL, 0x4D00000000000000ULL, // 5^31
+        0x9DC5ADA82B70B59DULL, 0xF020000000000000ULL, // 5^32
+        0xC5371912364CE305ULL, 0x6C28000000000000ULL, // 5^33
+        0xF684DF56C3E01BC6ULL, 0xC732000000000000ULL, // 5^34
+        0x9A130B963A6C115CULL, 0x3C7F400000000000ULL, // 5^35
+        0xC097CE7BC90715B3ULL, 0x4B9F100000000000ULL, // 5^36
+        0xF0BDC21ABB48DB20ULL, 0x1E86D40000000000ULL, // 5^37
+        0x96769950B50D88F4ULL, 0x1314448000000000ULL, // 5^38
+        0xBC143FA4E250EB31ULL, 0x17D955A000000000ULL, // 5^39
+        0xEB194F8E1AE525FDULL, 0x5DCFAB0800000000ULL, // 5^40
+        0x92EFD1B8D0CF37BEULL, 0x5AA1CAE500000000ULL, // 5^41
+        0xB7ABC627050305ADULL, 0xF14A3D9E40000000ULL, // 5^42
+        0xE596B7B0C643C719ULL, 0x6D9CCD05D0000000ULL, // 5^43
+        0x8F7E32CE7BEA5C6FULL, 0xE4820023A2000000ULL, // 5^44
+        0xB35DBF821AE4F38BULL, 0xDDA2802C8A800000ULL, // 5^45
+        0xE0352F62A19E306EULL, 0xD50B2037AD200000ULL, // 5^46
+        0x8C213D9DA502DE45ULL, 0x4526F422CC340000ULL, // 5^47
+        0xAF298D050E4395D6ULL, 0x9670B12B7F410000ULL, // 5^48
+        0xDAF3F04651D47B4CULL, 0x3C0CDD765F114000ULL, // 5^49
+        0x88D8762BF324CD0FULL, 0xA5880A69FB6AC800ULL, // 5^50
+        0xAB0E93B6EFEE0053ULL, 0x8EEA0D047A457A00ULL, // 5^51
+        0xD5D238A4ABE98068ULL, 0x72A4904598D6D880ULL, // 5^52
+        0x85A36366EB71F041ULL, 0x47A6DA2B7F864750ULL, // 5^53
+        0xA70C3C40A64E6C51ULL, 0x999090B65F67D924ULL, // 5^54
+        0xD0CF4B50CFE20765ULL, 0xFFF4B4E3F741CF6DULL, // 5^55
+        0x82818F1281ED449FULL, 0xBFF8F10E7A8921A4ULL, // 5^56
+        0xA321F2D7226895C7ULL, 0xAFF72D52192B6A0DULL, // 5^57
+        0xCBEA6F8CEB02BB39ULL, 0x9BF4F8A69F764490ULL, // 5^58
+        0xFEE50B7025C36A08ULL, 0x02F236D04753D5B4ULL, // 5^59
+        0x9F4F2726179A2245ULL, 0x01D762422C946590ULL, // 5^60
+        0xC722F0EF9D80AAD6ULL, 0x424D3AD2B7B97EF5ULL, // 5^61
+        0xF8EBAD2B84E0D58BULL, 0xD2E0898765A7DEB2ULL, // 5^62
+        0x9B934C3B330C8577ULL, 0x63CC55F49F88EB2FULL, // 5^63
+        0xC2781F49FFCFA6D5ULL, 0x3CBF6B71C76B25FBULL, // 5^64
+        0xF316271C7FC3908AULL, 0x8BEF464E3945EF7AULL, // 5^65
+        0x97EDD871CFDA3A56ULL, 0x97758BF0E3CBB5ACULL, // 5^66
+        0xBDE94E8E43D0C8ECULL, 0x3D52EEED1CBEA317ULL, // 5^67
+        0xED63A231D4C4FB27ULL, 0x4CA7AAA863EE4BDDULL, // 5^68
+        0x945E455F24FB1CF8ULL, 0x8FE8CAA93E74EF6AULL, // 5^69
+        0xB975D6B6EE39E436ULL, 0xB3E2FD538E122B44ULL, // 5^70
+        0xE7D34C64A9C85D44ULL, 0x60DBBCA87196B616ULL, // 5^71
+        0x90E40FBEEA1D3A4AULL, 0xBC8955E946FE31CDULL, // 5^72
+        0xB51D13AEA4A488DDULL, 0x6BABAB6398BDBE41ULL, // 5^73
+        0xE264589A4DCDAB14ULL, 0xC696963C7EED2DD1ULL, // 5^74
+        0x8D7EB76070A08AECULL, 0xFC1E1DE5CF543CA2ULL, // 5^75
+        0xB0DE65388CC8ADA8ULL, 0x3B25A55F43294BCBULL, // 5^76
+        0xDD15FE86AFFAD912ULL, 0x49EF0EB713F39EBEULL, // 5^77
+        0x8A2DBF142DFCC7ABULL, 0x6E3569326C784337ULL, // 5^78
+        0xACB92ED9397BF996ULL, 0x49C2C37F07965404ULL, // 5^79
+        0xD7E77A8F87DAF7FBULL, 0xDC33745EC97BE906ULL, // 5^80
+        0x86F0AC99B4E8DAFDULL, 0x69A028BB3DED71A3ULL, // 5^81
+        0xA8ACD7C0222311BCULL, 0xC40832EA0D68CE0CULL, // 5^82
+        0xD2D80DB02AABD62BULL, 0xF50A3FA490C30190ULL, // 5^83
+        0x83C7088E1AAB65DBULL, 0x792667C6DA79E0FAULL, // 5^84
+        0xA4B8CAB1A1563F52ULL, 0x577001B891185938ULL, // 5^85
+        0xCDE6FD5E09ABCF26ULL, 0xED4C0226B55E6F86ULL, // 5^86
+        0x80B05E5AC60B6178ULL, 0x544F8158315B05B4ULL, // 5^87
+        0xA0DC75F1778E39D6ULL, 0x696361AE3DB1C721ULL, // 5^88
+        0xC913936DD571C84CULL, 0x03BC3A19CD1E38E9ULL, // 5^89
+        0xFB5878494ACE3A5FULL, 0x04AB48A04065C723ULL, // 5^90
+        0x9D174B2DCEC0E47BULL, 0x62EB0D64283F9C76ULL, // 5^91
+        0xC45D1DF942711D9AULL, 0x3BA5D0BD324F8394ULL, // 5^92
+        0xF5746577930D6500ULL, 0xCA8F44EC7EE36479ULL, // 5^93
+        0x9968BF6ABBE85F20ULL, 0x7E998B13CF4E1ECBULL, // 5^94
+        0xBFC2EF456AE276E8ULL, 0x9E3FEDD8C321A67EULL, // 5^95
+        0xEFB3AB16C59B14A2ULL, 0xC5CFE94EF3EA101EULL, // 5^96
+        0x95D04AEE3B80ECE5ULL, 0xBBA1F1D158724A12ULL, // 5^97
+        0xBB445DA9CA61281FULL, 0x2A8A6E45AE8EDC97ULL, // 5^98
+        0xEA1575143CF97226ULL, 0xF52D09D71A3293BDULL, // 5^99
+        0x924D692CA61BE758ULL, 0x593C2626705F9C56ULL, // 5^100
+        0xB6E0C377CFA2E12EULL, 0x6F8B2FB00C77836CULL, // 5^101
+        0xE498F455C38B997AULL, 0x0B6DFB9C0F956447ULL, // 5^102
+        0x8EDF98B59A373FECULL, 0x4724BD4189BD5EACULL, // 5^103
+        0xB2977EE300C50FE7ULL, 0x58EDEC91EC2CB657ULL, // 5^104
+        0xDF3D5E9BC0F653E1ULL, 0x2F2967B66737E3EDULL, // 5^105
+        0x8B865B215899F46CULL, 0xBD79E0D20082EE74ULL, // 5^106
+        0xAE67F1E9AEC07187ULL, 0xECD8590680A3AA11ULL, // 5^107
+        0xDA01EE641A708DE9ULL, 0xE80E6F4820CC9495ULL, // 5^108
+        0x884134FE908658B2ULL, 0x3109058D147FDCDDULL, // 5^109
+        0xAA51823E34A7EEDEULL, 0xBD4B46F0599FD415ULL, // 5^110
+        0xD4E5E2CDC1D1EA96ULL, 0x6C9E18AC7007C91AULL, // 5^111
+        0x850FADC09923329EULL, 0x03E2CF6BC604DDB0ULL, // 5^112
+        0xA6539930BF6BFF45ULL, 0x84DB8346B786151CULL, // 5^113
+        0xCFE87F7CEF46FF16ULL, 0xE612641865679A63ULL, // 5^114
+        0x81F14FAE158C5F6EULL, 0x4FCB7E8F3F60C07EULL, // 5^115
+        0xA26DA3999AEF7749ULL, 0xE3BE5E330F38F09DULL, // 5^116
+        0xCB090C8001AB551CULL, 0x5CADF5BFD3072CC5ULL, // 5^117
+        0xFDCB4FA002162A63ULL, 0x73D9732FC7C8F7F6ULL, // 5^118
+        0x9E9F11C4014DDA7EULL, 0x2867E7FDDCDD9AFAULL, // 5^119
+        0xC646D63501A1511DULL, 0xB281E1FD541501B8ULL, // 5^120
+        0xF7D88BC24209A565ULL, 0x1F225A7CA91A4226ULL, // 5^121
+        0x9AE757596946075FULL, 0x3375788DE9B06958ULL, // 5^122
+        0xC1A12D2FC3978937ULL, 0x0052D6B1641C83AEULL, // 5^123
+        0xF209787BB47D6B84ULL, 0xC0678C5DBD23A49AULL, // 5^124
+        0x9745EB4D50CE6332ULL, 0xF840B7BA963646E0ULL, // 5^125
+        0xBD176620A501FBFFULL, 0xB650E5A93BC3D898ULL, // 5^126
+        0xEC5D3FA8CE427AFFULL, 0xA3E51F138AB4CEBEULL, // 5^127
+        0x93BA47C980E98CDFULL, 0xC66F336C36B10137ULL, // 5^128
+    };
+
+    /// [mul64x64] 64x64 → 128비트 곱
+    inline void mul64x64(uint64_t a, uint64_t b, uint64_t& hi, uint64_t& lo) {
+#if defined(__SIZEOF_INT128__)
+        const unsigned __int128 p = (unsigned __int128)a * b;
+        hi = (uint64_t)(p >> 64);
+        lo = (uint64_t)p;
+#else
+        const uint64_t aLo = a & 0xFFFFFFFFu, aHi = a >> 32;
+        const uint64_t bLo = b & 0xFFFFFFFFu, bHi = b >> 32;
+        const uint64_t p0 = aLo * bLo, p1 = aLo * bHi, p2 = aHi * bLo, p3 = aHi * bHi;
+        const uint64_t mid = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+        lo = (mid << 32) | (p0 & 0xFFFFFFFFu);
+        hi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+#endif
+    }
+
+    /// [eiselLemire] w * 10^q 를 정확히 반올림된 (가수, 지수 필드)로 변환
+    ///
+    /// @param w 유효숫자 (0 아님)
+    /// @param q 10진 지수
+    /// @param fmt 목표 형식
+    /// @param mantissa [OUT] 가수 필드 (숨은 비트 제외)
+    /// @param power2 [OUT] 지수 필드 (0: 서브노멀/0, infinitePower: 무한대)
+    /// @return false: 테이블 범위 밖이라 계산하지 못함 (폴백 필요)
+    bool eiselLemire(uint64_t w, int64_t q, const BinaryFormat& fmt, uint64_t& mantissa, int& power2) {
+        if (q < fmt.smallestPow10) { mantissa = 0; power2 = 0; return true; }
+        if (q > fmt.largestPow10) { mantissa = 0; power2 = fmt.infinitePower; return true; }
+        if (q < kPow5MinQ || q > kPow5MaxQ) return false;
+
+#if defined(__GNUC__) || defined(__clang__)
+        const int lz = __builtin_clzll(w);
+#else
+        int lz = 0;
+        while (!((w << lz) >> 63)) lz++;
+#endif
+        w <<= lz;
+
+        // 1. 5^q 근사값과 곱합니다. 하위 비트가 모두 1이면 다음 64비트로 정밀도를 보강합니다.
+        const size_t index = 2 * (size_t)(q - kPow5MinQ);
+        uint64_t hi, lo;
+        mul64x64(w, kPow5Table[index], hi, lo);
+        const uint64_t precisionMask = ~(uint64_t)0 >> (fmt.mantissaBits + 3);
+        if ((hi & precisionMask) == precisionMask) {
+            uint64_t hi2, lo2;
+            mul64x64(w, kPow5Table[index + 1], hi2, lo2);
+            lo += hi2;
+            if (hi2 > lo) hi++;
+        }
+
+        // 2. 상위 mantissaBits+3 비트를 취하고 2진 지수를 계산합니다. (floor(q * log2(10)) + 63)
+        const int upperBit = (int)(hi >> 63);
+        const int shift = upperBit + 64 - fmt.mantissaBits - 3;
+        mantissa = hi >> shift;
+        power2 = (int)((((152170 + 65536) * q) >> 16) + 63) + upperBit - lz - fmt.minExponent;
+
+        if (power2 <= 0) {
+            // 서브노멀 영역
+            if (-power2 + 1 >= 64) { mantissa = 0; power2 = 0; return true; }
+            mantissa >>= -power2 + 1;
+            mantissa += (mantissa & 1);
+            mantissa >>= 1;
+            power2 = (mantissa < ((uint64_t)1 << fmt.mantissaBits)) ? 0 : 1;
+            mantissa &= ~((uint64_t)1 << fmt.mantissaBits);
+            return true;
+        }
+
+        // 3. 정확히 중간값(…5)인 경우 짝수 쪽으로 반올림합니다.
+        if (lo <= 1 && q >= fmt.minRoundToEven && q <= fmt.maxRoundToEven && (mantissa & 3) == 1) {
+            if ((mantissa << shift) == hi) mantissa &= ~(uint64_t)1;
+        }
+        mantissa += (mantissa & 1);
+        mantissa >>= 1;
+        if (mantissa >= ((uint64_t)2 << fmt.mantissaBits)) {
+            mantissa = (uint64_t)1 << fmt.mantissaBits;
+            power2++;
+        }
+        mantissa &= ~((uint64_t)1 << fmt.mantissaBits);
+        if (power2 >= fmt.infinitePower) { mantissa = 0; power2 = fmt.infinitePower; }
+        return true;
+    }
+
+    /// [fallbackDigits] 폴백용으로 "유효숫자e지수" 형태의 정규화 문자열을 만듭니다.
+    ///
+    /// 원본이 NUL 종료가 아닐 수 있으므로 스택 버퍼에 복사하며, 100자리를 넘는 숫자는
+    /// 0이 아닌 나머지가 있으면 끝에 '1'을 붙여(Sticky) 반올림 방향을 보존합니다.
+    void fallbackDigits(const DecimalScan& scan, char* out, size_t outSize) {
+        const size_t maxDigits = 100;
+        size_t n = 0;
+        bool sticky = false;
+        int64_t exp10 = scan.explicitExp;
+        bool leading = true;
+
+        // 정수부: 버린 자리는 자릿값만큼 지수를 올립니다.
+        for (const char* c = scan.intBegin; c < scan.intEnd; ++c) {
+            if (leading && *c == '0') continue;
+            leading = false;
+            if (n < maxDigits) out[n++] = *c;
+            else { exp10++; if (*c != '0') sticky = true; }
+        }
+        // 소수부: 기록한 자리마다 지수를 내리고, 버린 자리는 지수에 영향이 없습니다.
+        for (const char* c = scan.fracBegin; c < scan.fracEnd; ++c) {
+            if (leading && *c == '0') { exp10--; continue; }
+            leading = false;
+            if (n < maxDigits) { out[n++] = *c; exp10--; }
+            else if (*c != '0') sticky = true;
+        }
+        if (n == 0) out[n++] = '0';
+        if (sticky) { out[n++] = '1'; exp10--; }
+
+        // 지수 기록
+        out[n++] = 'e';
+        if (exp10 < 0) { out[n++] = '-'; exp10 = -exp10; }
+        char tmp[24];
+        int t = 0;
+        do { tmp[t++] = (char)('0' + exp10 % 10); exp10 /= 10; } while (exp10 > 0 && t < 20);
+        while (t > 0 && n + 1 < outSize) out[n++] = tmp[--t];
+        out[n] = '\0';
+    }
+
+    /// [matchWord] 대소문자 무시 단어 일치 검사 (inf / nan 용)
+    inline bool matchWord(const char* p, const char* last, const char* word) {
+        for (; *word; ++word, ++p) {
+            if (p >= last || cms::string::toLower((unsigned char)*p) != *word) return false;
+        }
+        return true;
+    }
+
+    /// [parseSpecial] "inf", "infinity", "nan" 처리
+    /// @return 소비한 위치 (일치하지 않으면 nullptr)
+    const char* parseSpecial(const char* p, const char* last, bool& isNan) {
+        if (matchWord(p, last, "nan")) {
+            isNan = true;
+            p += 3;
+            // nan(문자열) 형태의 페이로드는 무시하고 건너뜁니다.
+            if (p < last && *p == '(') {
+                const char* q = p + 1;
+                while (q < last && (cms::string::isDigit((unsigned char)*q) || *q == '_' ||
+                                    (cms::string::toLower((unsigned char)*q) >= 'a' && cms::string::toLower((unsigned char)*q) <= 'z'))) q++;
+                if (q < last && *q == ')') p = q + 1;
+            }
+            return p;
+        }
+        if (matchWord(p, last, "inf")) {
+            isNan = false;
+            return matchWord(p, last, "infinity") ? p + 8 : p + 3;
+        }
+        return nullptr;
+    }
+
+    // 부동소수점 연산이 선언된 형식의 정밀도로 수행되는지 여부 (Clinger 경로의 전제 조건)
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    constexpr bool kClingerExact = true;
+#else
+    constexpr bool kClingerExact = false;
+#endif
+
+    // Clinger 고속 경로용 정확한 10의 거듭제곱
+    static const double kExactPow10d[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    static const float kExactPow10f[] = {
+        1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+    };
+
+    /// [digitValue] 문자 하나의 자릿값 (0~35, 숫자가 아니면 255)
+    inline unsigned digitValue(unsigned char c) {
+        if ((unsigned char)(c - '0') < 10) return (unsigned)(c - '0');
+        const unsigned char lower = (unsigned char)(c | 0x20);
+        if ((unsigned char)(lower - 'a') < 26) return (unsigned)(lower - 'a' + 10);
+        return 255;
+    }
+
+    /// [parseIntegerCore] parseInt<T>의 타입 독립 본체
+    ///
+    /// Why: 정수 타입마다 파싱 루프가 복제되지 않도록 64비트 크기(magnitude)로 한 번만 구현합니다.
+    /// How: 10진수는 8자리 SWAR로 19자리까지 오버플로우 걱정 없이 누적한 뒤 한도와 비교하고,
+    ///      그 외 진법은 자리마다 (limit - d) / base 비교로 오버플로우를 검출합니다.
+    ///
+    /// @param base 진법 (0: 접두사 자동 감지, 2~36)
+    /// @param posLimit 양수 최대 크기
+    /// @param negLimit 음수 최대 크기 (부호 없는 타입이면 0 → '-' 거부)
+    /// @param magnitude [OUT] 절대값
+    /// @param negative [OUT] 음수 여부
+    cms::string::ParseResult parseIntegerCore(const char* first, const char* last, int base,
+                                              uint64_t posLimit, uint64_t negLimit,
+                                              uint64_t& magnitude, bool& negative) {
+        using cms::string::ParseError;
+        if (!first || !last || first >= last || base == 1 || base < 0 || base > 36) return { first, ParseError::Invalid };
+
+        // 1. 부호
+        const char* p = first;
+        negative = false;
+        if (*p == '-' || *p == '+') {
+            negative = (*p == '-');
+            if (negative && negLimit == 0) return { first, ParseError::Invalid };
+            p++;
+        }
+        const uint64_t limit = negative ? negLimit : posLimit;
+
+        // 2. 진법 접두사 (0x, 0b). 접두사 뒤에 숫자가 없으면 "0"까지만 소비합니다.
+        if (last - p >= 3 && p[0] == '0') {
+            const char x = (char)(p[1] | 0x20);
+            if ((x == 'x' && (base == 0 || base == 16) && digitValue((unsigned char)p[2]) < 16) ||
+                (x == 'b' && (base == 0 || base == 2) && digitValue((unsigned char)p[2]) < 2)) {
+                base = (x == 'x') ? 16 : 2;
+                p += 2;
+            }
+        }
+        if (base == 0) base = 10;
+
+        const char* digitsBegin = p;
+        uint64_t v = 0;
+        bool overflow = false;
+
+        if (base == 10) {
+            // 3-A. 10진수: 앞자리 0을 건너뛰고 SWAR로 누적합니다. (19자리까지는 uint64에서 넘치지 않음)
+            while (p < last && *p == '0') p++;
+            const char* sig = p;
+            p = scanDigits(p, last, v);
+            const ptrdiff_t count = p - sig;
+            if (count > 19) {
+                // 20자리 이상: 앞 19자리를 다시 모은 뒤 나머지 자리만 검사된 연산으로 처리합니다.
+                v = 0;
+                const char* q = sig;
+                for (int i = 0; i < 19; ++i) v = v * 10 + (uint64_t)(*q++ - '0');
+                for (; q < p && !overflow; ++q) {
+                    const uint64_t d = (uint64_t)(*q - '0');
+                    if (v > (UINT64_MAX - d) / 10) overflow = true;
+                    else v = v * 10 + d;
+                }
+            }
+            if (!overflow && v > limit) overflow = true;
+        } else {
+            // 3-B. 그 외 진법: 자리마다 오버플로우를 검사합니다.
+            const uint64_t b = (uint64_t)base;
+            while (p < last) {
+                const unsigned d = digitValue((unsigned char)*p);
+                if (d >= (unsigned)base) break;
+                if (!overflow) {
+                    if (d > limit || v > (limit - d) / b) overflow = true;
+                    else v = v * b + d;
+                }
+                p++;
+            }
+        }
+
+        if (p == digitsBegin) return { first, ParseError::Invalid };
+        if (overflow) return { p, ParseError::OutOfRange };
+        magnitude = v;
+        return { p, ParseError::Ok };
+    }
+
+    /// [parseFloating] fromChars의 형식 공통 구현
+    ///
+    /// @tparam T double 또는 float
+    /// @tparam Bits T와 같은 크기의 부호 없는 정수
+    /// @param fmt 목표 IEEE-754 형식 상수
+    /// @param exactPow10 Clinger 경로용 정확한 10의 거듭제곱 테이블
+    /// @param fallback 드문 경우에 사용할 표준 변환 함수 (strtod / strtof)
+    template <typename T, typename Bits>
+    cms::string::ParseResult parseFloating(const char* first, const char* last, T& value, const BinaryFormat& fmt,
+                                           const T* exactPow10, T (*fallback)(const char*, char**)) {
+        using cms::string::ParseError;
+        if (!first || !last || first >= last) return { first, ParseError::Invalid };
+
+        DecimalScan scan;
+        if (!scanDecimal(first, last, scan)) {
+            // 숫자가 없으면 inf / nan 인지 확인합니다.
+            const char* p = first;
+            bool negative = false;
+            if (*p == '-' || *p == '+') { negative = (*p == '-'); p++; }
+            bool isNan = false;
+            const char* end = parseSpecial(p, last, isNan);
+            if (!end) return { first, ParseError::Invalid };
+            const T v = isNan ? std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::infinity();
+            value = negative ? -v : v;
+            return { end, ParseError::Ok };
+        }
+
+        // 1. Clinger 고속 경로: 가수와 10^|q|가 모두 정확하면 연산 한 번으로 정확히 반올림됩니다.
+        //    (x87처럼 확장 정밀도로 계산하는 환경에서는 이중 반올림이 생기므로 사용하지 않습니다.)
+        if (kClingerExact && !scan.truncated && scan.w <= ((uint64_t)1 << (fmt.mantissaBits + 1)) &&
+            scan.exp10 >= -fmt.maxExactPow10 && scan.exp10 <= fmt.maxExactPow10) {
+            T v = (T)scan.w;
+            v = (scan.exp10 < 0) ? v / exactPow10[-scan.exp10] : v * exactPow10[scan.exp10];
+            value = scan.negative ? -v : v;
+            return { scan.end, ParseError::Ok };
+        }
+
+        // 2. Eisel-Lemire: 잘린 입력은 w와 w+1의 결과가 같을 때만 확정합니다.
+        uint64_t mantissa = 0;
+        int power2 = 0;
+        bool exact = true;
+        if (scan.w != 0) {
+            exact = eiselLemire(scan.w, scan.exp10, fmt, mantissa, power2);
+            if (exact && scan.truncated) {
+                uint64_t mantissaUp;
+                int power2Up;
+                exact = eiselLemire(scan.w + 1, scan.exp10, fmt, mantissaUp, power2Up) &&
+                        mantissaUp == mantissa && power2Up == power2;
+            }
+        }
+
+        ParseError ec = ParseError::Ok;
+        if (exact) {
+            Bits bits = (Bits)(mantissa | ((uint64_t)power2 << fmt.mantissaBits));
+            if (scan.negative) bits |= (Bits)1 << (sizeof(Bits) * 8 - 1);
+            memcpy(&value, &bits, sizeof(value));
+            if (power2 == fmt.infinitePower || (power2 == 0 && mantissa == 0 && scan.w != 0)) ec = ParseError::OutOfRange;
+            return { scan.end, ec };
+        }
+
+        // 3. 폴백: 정규화한 숫자열을 표준 변환기로 넘깁니다.
+        char tmp[128];
+        fallbackDigits(scan, tmp, sizeof(tmp));
+        const T v = fallback(tmp, nullptr);
+        value = scan.negative ? -v : v;
+        if (v == std::numeric_limits<T>::infinity() || (v == 0 && scan.w != 0)) ec = ParseError::OutOfRange;
+        return { scan.end, ec };
+    }
+
+    // ==============================================================================================
+    // [Binary-to-Text] 16진수/Base64/Base32 인코딩 커널
+    // 16진수는 바이트마다 독립적으로 변환되므로 SSE2/NEON으로 16바이트씩 처리하고,
+    // Base64/Base32는 비트 재배치에 바이트 셔플(SSSE3 이상)이 필요하므로 테이블 기반 스칼라로 처리합니다.
+    // ==============================================================================================
+
+    static const char kBase64Std[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    static const char kBase64Url[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+    static const char kBase32[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567";
+
+    /// Base64 역변환 테이블 (표준/URL-safe 문자를 모두 허용, 그 외는 0xFF)
+    struct Base64DecodeTable {
+        uint8_t v[256];
+        constexpr Base64DecodeTable() : v{} {
+            for (int i = 0; i < 256; ++i) v[i] = 0xFF;
+            for (int k = 0; k < 26; ++k) {
+                v['A' + k] = (uint8_t)k;
+                v['a' + k] = (uint8_t)(26 + k);
+            }
+            for (int k = 0; k < 10; ++k) v['0' + k] = (uint8_t)(52 + k);
+            v[(unsigned char)'+'] = 62;
+            v[(unsigned char)'-'] = 62;
+            v[(unsigned char)'/'] = 63;
+            v[(unsigned char)'_'] = 63;
+        }
+    };
+    static constexpr Base64DecodeTable kBase64Decode{};
+
+    /// [base32Value] Base32 문자 하나의 값 (대소문자 무시, 아니면 0xFF)
+    inline unsigned base32Value(unsigned char c) {
+        const unsigned char lower = (unsigned char)(c | 0x20);
+        if ((unsigned char)(lower - 'a') < 26) return (unsigned)(lower - 'a');
+        if ((unsigned char)(c - '2') < 6) return (unsigned)(c - '2' + 26);
+        return 0xFF;
+    }
+
+    /// [hexEncodeVector] 16바이트 블록 단위 16진수 인코딩
+    ///
+    /// 상위/하위 니블을 분리해 '0'을 더하고, 9보다 큰 레인에만 알파벳 보정값을 더한 뒤
+    /// 두 벡터를 교차(unpack/vst2)하여 32자를 한 번에 기록합니다.
+    /// @return 처리한 바이트 수 (16의 배수, SIMD 미지원 환경에서는 0)
+    size_t hexEncodeVector(const uint8_t* src, size_t len, char* out, bool uppercase) {
+        size_t i = 0;
+#if defined(CMS_SIMD_SSE2)
+        const __m128i lowMask = _mm_set1_epi8(0x0F);
+        const __m128i nine = _mm_set1_epi8(9);
+        const __m128i ascii0 = _mm_set1_epi8('0');
+        const __m128i alphaAdj = _mm_set1_epi8((char)((uppercase ? 'A' : 'a') - '0' - 10));
+        for (; i + 16 <= len; i += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), lowMask);
+            __m128i lo = _mm_and_si128(v, lowMask);
+            hi = _mm_add_epi8(_mm_add_epi8(hi, ascii0), _mm_and_si128(_mm_cmpgt_epi8(hi, nine), alphaAdj));
+            lo = _mm_add_epi8(_mm_add_epi8(lo, ascii0), _mm_and_si128(_mm_cmpgt_epi8(lo, nine), alphaAdj));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i), _mm_unpacklo_epi8(hi, lo));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+        }
+#elif defined(CMS_SIMD_NEON)
+        const uint8x16_t lowMask = vdupq_n_u8(0x0F);
+        const uint8x16_t nine = vdupq_n_u8(9);
+        const uint8x16_t ascii0 = vdupq_n_u8('0');
+        const uint8x16_t alphaAdj = vdupq_n_u8((uint8_t)((uppercase ? 'A' : 'a') - '0' - 10));
+        for (; i + 16 <= len; i += 16) {
+            uint8x16_t v = vld1q_u8(src + i);
+            uint8x16x2_t pair;
+            pair.val[0] = vshrq_n_u8(v, 4);
+            pair.val[1] = vandq_u8(v, lowMask);
+            pair.val[0] = vaddq_u8(vaddq_u8(pair.val[0], ascii0), vandq_u8(vcgtq_u8(pair.val[0], nine), alphaAdj));
+            pair.val[1] = vaddq_u8(vaddq_u8(pair.val[1], ascii0), vandq_u8(vcgtq_u8(pair.val[1], nine), alphaAdj));
+            vst2q_u8(reinterpret_cast<uint8_t*>(out + 2 * i), pair); // 상위/하위 니블을 교차 저장
+        }
+#else
+        (void)src; (void)len; (void)out; (void)uppercase;
+#endif
+        return i;
     }
 
-    /// [findUtf8CharStart] UTF-8 논리적 인덱스의 물리적 주소 탐색
-    ///
-    /// 멀티바이트 환경에서 'n번째 글자'가 실제 메모리의 어디에 위치하는지 정확히 찾기 위해 필요합니다.
-    /// UTF-8의 후속 바이트 비트 패턴(10xxxxxx)을 건너뛰며 논리적 글자 수를 카운트합니다.
-    ///
-    /// @param str 검색할 UTF-8 문자열
-    /// @param charIdx 찾고자 하는 글자의 논리적 위치 (0부터 시작)
-    /// @return 해당 글자가 시작되는 메모리 주소
-    const char* findUtf8CharStart(const char* str, size_t charIdx) {
-        // 1. 입력 문자열이 유효하지 않으면 즉시 종료합니다.
-        if (!str) return nullptr;
+#if defined(CMS_SIMD_SSE2)
+    /// [hexNibbles] 16개 문자를 니블 값으로 변환하고 유효 여부 마스크를 반환 (SSE2)
+    inline __m128i hexNibbles(__m128i c, __m128i& valid) {
+        const __m128i d = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+        const __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+        const __m128i l = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+        const __m128i isAlpha = _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l);
+        valid = _mm_or_si128(isDigit, isAlpha);
+        return _mm_or_si128(_mm_and_si128(isDigit, d), _mm_and_si128(isAlpha, _mm_add_epi8(l, _mm_set1_epi8(10))));
+    }
 
-        const char* p = str;
-        size_t count = 0;
+    /// [hexPack] 니블 쌍(짝수 문자 = 상위)을 16비트 레인에서 바이트로 합침 (SSE2)
+    inline __m128i hexPack(__m128i nib) {
+        const __m128i hi = _mm_and_si128(nib, _mm_set1_epi16(0x00FF));
+        return _mm_or_si128(_mm_slli_epi16(hi, 4), _mm_srli_epi16(nib, 8));
+    }
+#endif
 
-        // 2. 문자열의 끝을 만나거나, 원하는 문자 인덱스(charIdx)에 도달할 때까지 바이트를 훑습니다.
-        while (*p && count < charIdx) {
-            // UTF-8 규칙: 바이트의 상위 2비트가 '10'이면 이전 문자에 딸린 '후속 바이트'입니다.
-            // 따라서 '10'이 아닌 경우에만 새로운 문자가 시작된 것으로 보고 카운트를 올립니다.
-            if ((*p & 0xC0) != 0x80) count++;
-            p++;
+    /// [hexDecodeVector] 32자 블록 단위 16진수 디코딩
+    ///
+    /// 블록 안에 16진수가 아닌 문자(공백, 오류)가 하나라도 있으면 멈추고 스칼라 경로에 넘깁니다.
+    /// @return 처리한 문자 수 (32의 배수, SIMD 미지원 환경에서는 0)
+    size_t hexDecodeVector(const char* src, size_t len, uint8_t* dst, size_t dstCap) {
+        size_t i = 0;
+#if defined(CMS_SIMD_SSE2)
+        for (; i + 32 <= len && i / 2 + 16 <= dstCap; i += 32) {
+            __m128i validA, validB;
+            const __m128i a = hexNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), validA);
+            const __m128i b = hexNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16)), validB);
+            if (_mm_movemask_epi8(_mm_and_si128(validA, validB)) != 0xFFFF) break;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i / 2), _mm_packus_epi16(hexPack(a), hexPack(b)));
         }
-        // 3. 만약 루프가 끝났는데 p가 후속 바이트 중간을 가리키고 있다면, 다음 문자의 시작점까지 전진합니다.
-        while (*p && (*p & 0xC0) == 0x80) p++;
-        return p;
+#elif defined(CMS_SIMD_NEON)
+        for (; i + 32 <= len && i / 2 + 16 <= dstCap; i += 32) {
+            // vld2q_u8가 짝수(상위 니블)/홀수(하위 니블) 문자를 분리해 읽습니다.
+            const uint8x16x2_t c = vld2q_u8(reinterpret_cast<const uint8_t*>(src + i));
+            uint8x16_t nib[2];
+            uint8x16_t valid = vdupq_n_u8(0xFF);
+            for (int k = 0; k < 2; ++k) {
+                const uint8x16_t d = vsubq_u8(c.val[k], vdupq_n_u8('0'));
+                const uint8x16_t l = vsubq_u8(vorrq_u8(c.val[k], vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+                const uint8x16_t isDigit = vcleq_u8(d, vdupq_n_u8(9));
+                const uint8x16_t isAlpha = vcleq_u8(l, vdupq_n_u8(5));
+                valid = vandq_u8(valid, vorrq_u8(isDigit, isAlpha));
+                nib[k] = vorrq_u8(vandq_u8(isDigit, d), vandq_u8(isAlpha, vaddq_u8(l, vdupq_n_u8(10))));
+            }
+            // 전 레인이 0xFF인지 니블 마스크로 확인합니다. (vminvq는 AArch64 전용)
+            if (vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(valid), 4)), 0) != ~(uint64_t)0) break;
+            vst1q_u8(dst + i / 2, vorrq_u8(vshlq_n_u8(nib[0], 4), nib[1]));
+        }
+#else
+        (void)src; (void)len; (void)dst; (void)dstCap;
+#endif
+        return i;
+    }
+
+    /// [utf8SequenceLength] p에서 시작하는 유효한 UTF-8 시퀀스의 바이트 수를 반환합니다. (validateUtf8과 같은 규칙)
+    /// @return 1~4, 깨졌거나 end를 넘으면 0
+    inline size_t utf8SequenceLength(const unsigned char* p, const unsigned char* end) {
+        const unsigned char b0 = p[0];
+        if (b0 <= 0x7F) return 1;
+        const size_t avail = (size_t)(end - p);
+        auto cont = [&](size_t k) { return (p[k] & 0xC0) == 0x80; };
+        if (b0 >= 0xC2 && b0 <= 0xDF) return (avail >= 2 && cont(1)) ? 2 : 0;
+        if (b0 >= 0xE0 && b0 <= 0xEF) {
+            if (avail < 3 || !cont(2)) return 0;
+            // E0: Overlong 방지, ED: Surrogate 영역 방지
+            const unsigned char lo = b0 == 0xE0 ? 0xA0 : 0x80;
+            const unsigned char hi = b0 == 0xED ? 0x9F : 0xBF;
+            return (p[1] >= lo && p[1] <= hi) ? 3 : 0;
+        }
+        if (b0 >= 0xF0 && b0 <= 0xF4) {
+            if (avail < 4 || !cont(2) || !cont(3)) return 0;
+            // F0: Overlong 방지, F4: U+10FFFF 초과 방지
+            const unsigned char lo = b0 == 0xF0 ? 0x90 : 0x80;
+            const unsigned char hi = b0 == 0xF4 ? 0x8F : 0xBF;
+            return (p[1] >= lo && p[1] <= hi) ? 4 : 0;
+        }
+        return 0;
     }
 }
 
@@ -292,31 +2087,23 @@ namespace cms {
         /// @return 수정 후의 문자열 바이트 길이
         size_t trim(char* str) {
             if (!str || *str == '\0') return 0;
+            return trim(str, strlen(str));
+        }
 
-            size_t len = strlen(str);
-            char* start = str;
-            while (*start && cms::string::isSpace((unsigned char)*start)) {
-                start++;
-            }
-
-            // 모든 문자가 공백인 경우 처리
-            if (*start == '\0') {
-                str[0] = '\0';
-                return 0;
-            }
+        // [최적화] 길이를 이미 알고 있는 경우를 위한 오버로드
+        // 양 끝의 공백과 남은 본문(memmove)만 접근하므로, 공백이 없으면 본문을 한 바이트도 읽지 않습니다.
+        size_t trim(char* str, size_t len) {
+            if (!str) return 0;
 
-            char* end = str + len - 1;
-            while (end > start && cms::string::isSpace((unsigned char)*end)) {
-                *end = '\0';
-                end--;
-            }
+            size_t start = 0;
+            while (start < len && cms::string::isSpace((unsigned char)str[start])) start++;
 
-            size_t newLen = (end - start) + 1;
-            if (start != str) {
-                // [최적화] 이미 계산된 end와 start 포인터를 이용하여 이동할 길이를 즉시 도출
-                memmove(str, start, newLen + 1);
-            }
+            size_t end = len;
+            while (end > start && cms::string::isSpace((unsigned char)str[end - 1])) end--;
 
+            const size_t newLen = end - start;
+            if (start > 0 && newLen > 0) memmove(str, str + start, newLen);
+            str[newLen] = '\0';
             return newLen;
         }
 
@@ -457,27 +2244,51 @@ namespace cms {
         int toInt(const char* str, size_t len) {
             if (!str || len == 0) return 0;
 
-            size_t i = 0;
             // 1. 앞부분 공백 건너뛰기
+            size_t i = 0;
             while (i < len && cms::string::isSpace((unsigned char)str[i])) i++;
             if (i == len) return 0;
 
-            // 2. 부호 처리
-            int sign = 1;
-            if (str[i] == '-') { sign = -1; i++; }
-            else if (str[i] == '+') { i++; }
+            // 2. 파싱: 범위를 벗어나면 int 한계값으로 포화시킵니다. (기존의 조용한 절삭 방지)
+            int val = 0;
+            ParseResult r = parseInt(str + i, str + len, val);
+            if (r.ec == ParseError::OutOfRange) return (str[i] == '-') ? INT_MIN : INT_MAX;
+            return (r.ec == ParseError::Ok) ? val : 0;
+        }
 
-            // 3. 숫자 파싱
-            long long val = 0;
-            while (i < len && cms::string::isDigit((unsigned char)str[i])) {
-                unsigned char c = (unsigned char)str[i];
-                val = val * 10 + (c - '0');
-                i++;
+        /// [parseInt] 정수 문자열을 지정한 타입으로 변환 (std::from_chars 호환 형태)
+        ///
+        /// 타입 한계를 넘으면 값을 바꾸지 않고 OutOfRange를 반환합니다.
+        /// @tparam T 정수 타입 (int8_t ~ uint64_t)
+        /// @param base 진법 (0: 0x/0b 접두사 자동 감지, 기본 10)
+        template <typename T>
+        ParseResult parseInt(const char* first, const char* last, T& value, int base) {
+            static_assert(std::numeric_limits<T>::is_integer, "cms::string::parseInt requires an integer type.");
+            const uint64_t posLimit = (uint64_t)std::numeric_limits<T>::max();
+            const uint64_t negLimit = std::numeric_limits<T>::is_signed ? posLimit + 1 : 0;
+
+            uint64_t magnitude = 0;
+            bool negative = false;
+            ParseResult r = parseIntegerCore(first, last, base, posLimit, negLimit, magnitude, negative);
+            if (r.ec == ParseError::Ok) {
+                // 2의 보수 변환: 음수 최솟값(-2^63 등)도 오버플로우 없이 표현됩니다.
+                value = negative ? (T)(0 - magnitude) : (T)magnitude;
             }
-
-            return static_cast<int>(val * sign);
+            return r;
         }
 
+        // 지원 타입 명시적 인스턴스화 (구현은 이 번역 단위에만 존재)
+        template ParseResult parseInt<signed char>(const char*, const char*, signed char&, int);
+        template ParseResult parseInt<unsigned char>(const char*, const char*, unsigned char&, int);
+        template ParseResult parseInt<short>(const char*, const char*, short&, int);
+        template ParseResult parseInt<unsigned short>(const char*, const char*, unsigned short&, int);
+        template ParseResult parseInt<int>(const char*, const char*, int&, int);
+        template ParseResult parseInt<unsigned int>(const char*, const char*, unsigned int&, int);
+        template ParseResult parseInt<long>(const char*, const char*, long&, int);
+        template ParseResult parseInt<unsigned long>(const char*, const char*, unsigned long&, int);
+        template ParseResult parseInt<long long>(const char*, const char*, long long&, int);
+        template ParseResult parseInt<unsigned long long>(const char*, const char*, unsigned long long&, int);
+
         /// [isDigit] 유효한 10진수 정수 형식 여부 확인
         bool isDigit(const char* str) {
             if (!str || *str == '\0') return false;
@@ -521,20 +2332,12 @@ namespace cms {
             while (i < len && cms::string::isSpace((unsigned char)str[i])) i++;
             if (i == len) return 0;
 
-            // 2. 0x 또는 0X 접두사 처리
-            if (i + 1 < len && str[i] == '0' && toLower((unsigned char)str[i+1]) == 'x') {
-                i += 2;
-            }
-
-            unsigned int val = 0;
-            while (i < len && isHexDigit((unsigned char)str[i])) {
-                unsigned char c = (unsigned char)str[i++];
-                val <<= 4;
-                // [최적화] 이미 isHexDigit을 통과했으므로 isDigit 결과에 따라
-                // 숫자('0'-'9') 또는 문자('a'-'f'/'A'-'F') 값을 안전하게 더합니다.
-                if (cms::string::isDigit(c)) val += (c - '0');
-                else val += (cms::string::toLower(c) - 'a' + 10);
-            }
+            // 2. 32비트 비트 패턴으로 해석합니다. ("0xFFFFFFFF" → -1)
+            //    8자리를 넘는 값은 더 이상 조용히 감기지(wrap) 않고 0xFFFFFFFF로 포화됩니다.
+            uint32_t val = 0;
+            ParseResult r = parseInt(str + i, str + len, val, 16);
+            if (r.ec == ParseError::OutOfRange) val = UINT32_MAX;
+            else if (r.ec != ParseError::Ok) val = 0;
             return static_cast<int>(val);
         }
 
@@ -579,37 +2382,31 @@ namespace cms {
         double toFloat(const char* str, size_t len) {
             if (!str || len == 0) return 0.0;
 
+            // 1. 공백 스킵 후 정확 반올림 파서에 위임합니다.
             size_t i = 0;
-            // 1. 공백 스킵
             while (i < len && cms::string::isSpace((unsigned char)str[i])) i++;
-            if (i == len) return 0.0;
-
-            // 2. 부호 처리
-            double sign = 1.0;
-            if (str[i] == '-') { sign = -1.0; i++; }
-            else if (str[i] == '+') { i++; }
 
-            // 3. 정수부 파싱
             double val = 0.0;
-            while (i < len && cms::string::isDigit((unsigned char)str[i])) {
-                unsigned char c = (unsigned char)str[i];
-                val = val * 10.0 + (c - '0');
-                i++;
-            }
+            if (fromChars(str + i, str + len, val).ec == ParseError::Invalid) return 0.0;
+            return val;
+        }
 
-            // 4. 소수부 파싱
-            if (i < len && str[i] == '.') {
-                i++;
-                double weight = 0.1;
-                while (i < len && cms::string::isDigit((unsigned char)str[i])) {
-                    unsigned char c = (unsigned char)str[i];
-                    val += (c - '0') * weight;
-                    weight /= 10.0;
-                    i++;
-                }
-            }
+        /// [fromChars] 실수 문자열을 double로 변환 (std::from_chars 호환 형태)
+        ///
+        /// 10진 표기(부호, 소수점, e 지수)와 inf/infinity/nan(대소문자 무시)을 지원합니다.
+        /// @param first 입력 시작
+        /// @param last 입력 끝 (NUL 종료 불필요)
+        /// @param value [OUT] 변환 결과 (Invalid이면 변경하지 않음)
+        /// @return 파싱이 끝난 위치와 오류 코드
+        ParseResult fromChars(const char* first, const char* last, double& value) {
+            return parseFloating<double, uint64_t>(first, last, value, kBinary64, kExactPow10d, strtod);
+        }
 
-            return val * sign;
+        /// [fromChars] 실수 문자열을 float로 변환
+        ///
+        /// double을 거치지 않고 float로 바로 정확히 반올림하므로 이중 반올림 오차가 없습니다.
+        ParseResult fromChars(const char* first, const char* last, float& value) {
+            return parseFloating<float, uint32_t>(first, last, value, kBinary32, kExactPow10f, strtof);
         }
 
         /// [isNumeric] 유효한 실수 형식 여부 확인
@@ -654,24 +2451,17 @@ namespace cms {
         /// [utf8_strlen] UTF-8 논리적 글자 수 측정
         ///
         /// 바이트 크기가 아닌 실제 화면에 표시되는 글자 수를 계산합니다.
-        /// ASCII 영역은 고속 스킵하고, 멀티바이트 영역은 비트 패턴을 분석합니다.
+        /// 길이를 모르는 경우 strlen으로 길이를 얻은 뒤 벡터화된 선두 바이트 카운터에 위임합니다.
         /// @param str 측정할 UTF-8 문자열
         size_t utf8_strlen(const char* str) {
             if (!str) return 0;
+            return countUtf8Leads(reinterpret_cast<const unsigned char*>(str), strlen(str));
+        }
 
-            const unsigned char* p = reinterpret_cast<const unsigned char*>(str);
-            size_t count = 0;
-
-            // 빠른 경로: 선행 ASCII 바이트가 연속되는 경우 한 번에 처리
-            while (*p && *p < 0x80) { count++; p++; }
-            if (!*p) return count;
-
-            // 비 ASCII가 섞여 있는 경우 기존 방식으로 남은 부분 처리
-            while (*p) {
-                if ((*p & 0xC0) != 0x80) count++;
-                p++;
-            }
-            return count;
+        // [최적화] 길이를 이미 알고 있는 경우 NUL 스캔 없이 바로 집계합니다.
+        size_t utf8_strlen(const char* str, size_t len) {
+            if (!str || len == 0) return 0;
+            return countUtf8Leads(reinterpret_cast<const unsigned char*>(str), len);
         }
 
         /// [utf8SafeEnd] 안전한 UTF-8 종료 지점 계산
@@ -712,12 +2502,17 @@ namespace cms {
         int find(const char* str, size_t strLen, const char* target, size_t targetLen, size_t startChar, bool ignoreCase) {
             if (!str || !target || targetLen == 0 || targetLen > strLen) return -1;
 
-            // 1. 물리적 시작 주소 확보: n번째 '글자'가 시작되는 실제 메모리 주소를 계산합니다.
-            const char* startPtr = findUtf8CharStart(str, startChar);
-            if (!startPtr || *startPtr == '\0') return -1;
+            // 1. 물리적 시작 주소 확보: n번째 '글자'가 시작되는 실제 메모리 주소를 길이 안에서 계산합니다.
+            const char* end = str + strLen;
+            const char* startPtr = str;
+            for (size_t count = 0; startPtr < end && count < startChar; ++startPtr) {
+                if ((*startPtr & 0xC0) != 0x80) count++;
+            }
+            while (startPtr < end && (*startPtr & 0xC0) == 0x80) startPtr++;
+            if (startPtr >= end) return -1;
 
-            // 2. 고속 메모리 스캔: strstr 또는 strcasestr을 사용하여 주소를 찾습니다.
-            const char* foundPtr = ignoreCase ? cms::string::strcasestr(startPtr, target) : strstr(startPtr, target);
+            // 2. 고속 메모리 스캔: 길이 기반 findBytes를 사용하므로 양쪽 모두 NUL 종료가 필요 없습니다.
+            const char* foundPtr = findBytes(startPtr, (size_t)(end - startPtr), target, targetLen, ignoreCase);
             if (!foundPtr) return -1;
 
             // 3. 논리적 인덱스 변환: startPtr부터 foundPtr까지의 글자 수를 계산하여 상대적 인덱스로 환산
@@ -742,16 +2537,8 @@ namespace cms {
         int lastIndexOf(const char* str, size_t strLen, const char* target, size_t targetLen, bool ignoreCase) {
             if (!str || !target || targetLen == 0 || targetLen > strLen) return -1;
 
-            const char* lastFound = nullptr;
-            const char* current = str;
-
-            while (true) {
-                const char* found = ignoreCase ? cms::string::strcasestr(current, target) : strstr(current, target);
-                if (!found) break;
-                lastFound = found;
-                current = found + 1; // 다음 검색은 발견된 위치 바로 다음부터 시작
-            }
-
+            // 끝에서부터 역방향으로 탐색하므로 첫 발견이 곧 마지막 출현 위치입니다.
+            const char* lastFound = findLastBytes(str, strLen, target, targetLen, ignoreCase);
             if (!lastFound) return -1;
 
             // 처음부터 마지막 발견 지점까지 한 번만 스캔하여 인덱스 확정
@@ -770,16 +2557,24 @@ namespace cms {
         /// @param src 삽입할 문자열
         /// @return 삽입 후의 새로운 문자열 바이트 길이
         size_t insert(char* buffer, size_t maxLen, size_t curLen, size_t charIdx, const char* src) {
-            if (!buffer || !src || *src == '\0') return curLen;
+            if (!src) return curLen;
+            return insert(buffer, maxLen, curLen, charIdx, src, strlen(src));
+        }
+
+        // [최적화] 삽입할 길이를 이미 알고 있는 경우를 위한 오버로드 (NUL 종료 불필요)
+        size_t insert(char* buffer, size_t maxLen, size_t curLen, size_t charIdx, const char* src, size_t srcLen, size_t* dropped) {
+            if (dropped) *dropped = 0;
+            if (!buffer || !src || srcLen == 0) return curLen;
 
             // 1. 삽입 지점 확보: 삽입할 글자 인덱스를 물리적 메모리 주소로 변환합니다.
             const char* targetPtr = findUtf8CharStart(buffer, charIdx);
             size_t byteOffset = targetPtr - buffer;
-            size_t srcLen = strlen(src);
 
             // 2. 오버플로우 방어: 삽입 후 전체 길이가 버퍼 크기를 넘지 않도록 삽입할 길이를 조정합니다.
             if (curLen + srcLen >= maxLen) {
-                srcLen = (maxLen > curLen + 1) ? (maxLen - curLen - 1) : 0;
+                const size_t fit = (maxLen > curLen + 1) ? (maxLen - curLen - 1) : 0;
+                if (dropped) *dropped = srcLen - fit;
+                srcLen = fit;
             }
             if (srcLen == 0) return curLen;
 
@@ -829,20 +2624,27 @@ namespace cms {
         /// @param left 시작 글자 인덱스
         /// @param right 종료 글자 인덱스 (0일 경우 끝까지)
         size_t substring(const char* src, char* dest, size_t destLen, size_t left, size_t right) {
+            if (!src) return 0;
+            return substring(src, strlen(src), dest, destLen, left, right);
+        }
+
+        // [최적화] 원본 길이를 알고 있는 경우를 위한 오버로드 (NUL 종료 불필요, 종료 글자 이후는 읽지 않음)
+        size_t substring(const char* src, size_t srcLen, char* dest, size_t destLen, size_t left, size_t right) {
             if (!src || !dest || destLen == 0) return 0;
             dest[0] = '\0';
 
             // 1. 추출 범위 계산: 잘라낼 시작점과 끝점의 물리적 주소를 찾습니다.
-            const char* startPtr = findUtf8CharStart(src, left);
-            if (!startPtr || *startPtr == '\0') return 0;
+            const char* const srcEnd = src + srcLen;
+            const char* startPtr = findUtf8CharStart(src, srcEnd, left);
+            if (startPtr == srcEnd) return 0;
 
             const char* endPtr;
             if (right == 0) {
-                endPtr = src + strlen(src);
+                endPtr = srcEnd;
             } else {
                 if (right <= left) return 0;
                 // 시작 지점(startPtr)부터 상대적으로 종료 지점 탐색 (중복 스캔 방지)
-                endPtr = findUtf8CharStart(startPtr, right - left);
+                endPtr = findUtf8CharStart(startPtr, srcEnd, right - left);
             }
 
             if (endPtr <= startPtr) return 0;
@@ -864,11 +2666,16 @@ namespace cms {
         /// @param startByte 시작 바이트 오프셋
         /// @param endByte 종료 바이트 오프셋 (0일 경우 끝까지)
         size_t byteSubstring(const char* src, char* dest, size_t destLen, size_t startByte, size_t endByte) {
+            if (!src) return 0;
+            return byteSubstring(src, strlen(src), dest, destLen, startByte, endByte);
+        }
+
+        // [최적화] 원본 길이를 알고 있는 경우를 위한 오버로드 (복사 구간만 접근)
+        size_t byteSubstring(const char* src, size_t srcLen, char* dest, size_t destLen, size_t startByte, size_t endByte) {
             if (!src || !dest || destLen == 0) return 0;
             dest[0] = '\0';
 
             // 1. 오프셋 유효성 검사: 시작 바이트가 원본 길이를 넘는지 확인합니다.
-            size_t srcLen = strlen(src);
             if (startByte >= srcLen) return 0;
             // 끝 바이트가 0이거나 원본보다 크면 원본 끝으로 설정합니다.
             if (endByte == 0 || endByte > srcLen) endByte = srcLen;
@@ -920,6 +2727,25 @@ namespace cms {
             return count;
         }
 
+        // [최적화] 길이를 알고 있는 경우 NUL을 확인하지 않고 memchr로 구분자 사이를 건너뜁니다.
+        size_t split(char* str, size_t len, char delimiter, char** tokens, size_t maxTokens) {
+            if (!str || !tokens || maxTokens == 0) return 0;
+
+            size_t count = 0;
+            tokens[count++] = str;
+
+            char* p = str;
+            char* const end = str + len;
+            while (count < maxTokens && p < end) {
+                char* hit = static_cast<char*>(memchr(p, delimiter, (size_t)(end - p)));
+                if (!hit) break;
+                *hit = '\0';
+                tokens[count++] = hit + 1;
+                p = hit + 1;
+            }
+            return count;
+        }
+
         /// [split] 구분자 기준 문자열 분리 (비파괴적)
         ///
         /// 원본을 수정하지 않고 Token 구조체(포인터+길이) 배열을 생성합니다.
@@ -928,30 +2754,105 @@ namespace cms {
         /// @param tokens 분리된 Token 구조체 배열
         /// @param maxTokens 최대 분리 가능 개수
         size_t split(const char* str, char delimiter, Token* tokens, size_t maxTokens) {
+            if (!str) return 0;
+            return split(str, strlen(str), delimiter, tokens, maxTokens);
+        }
+
+        // [최적화] 길이를 알고 있는 경우 strlen 없이 memchr(벡터화)로 구분자를 건너뜁니다.
+        size_t split(const char* str, size_t len, char delimiter, Token* tokens, size_t maxTokens) {
             if (!str || !tokens || maxTokens == 0) return 0;
 
             size_t count = 0;
             const char* start = str;
-            const char* p = str;
+            const char* end = str + len;
+
+            while (count < maxTokens - 1) {
+                const char* d = static_cast<const char*>(memchr(start, delimiter, (size_t)(end - start)));
+                if (!d) break;
+                tokens[count].ptr = start;
+                tokens[count].len = (size_t)(d - start);
+                count++;
+                start = d + 1;
+            }
 
-            while (*p) {
-                if (*p == delimiter) {
-                    if (count < maxTokens - 1) {
-                        tokens[count].ptr = start;
-                        tokens[count].len = (size_t)(p - start);
-                        count++;
-                        start = p + 1;
-                    } else {
-                        break; // 마지막 토큰은 남은 전체를 포함
-                    }
+            // 마지막 세그먼트 추가 (토큰 배열이 가득 찬 경우 남은 전체를 포함)
+            tokens[count].ptr = start;
+            tokens[count].len = (size_t)(end - start);
+            return ++count;
+        }
+
+        /// [findAnyOf] 문자 집합 중 하나의 첫 위치 탐색
+        ///
+        /// 구분자 집합(예: ",;\"")을 한 번의 스캔으로 찾기 위해 사용합니다.
+        /// 집합이 1개면 memchr, 8개 이하면 SIMD/SWAR 블록 비교, 그 외에는 256비트 비트맵으로 검사합니다.
+        /// @param str 검색 대상 (NUL 종료 불필요)
+        /// @param len 검색 길이
+        /// @param set 찾을 문자 집합
+        /// @param setLen 집합 크기
+        const char* findAnyOf(const char* str, size_t len, const char* set, size_t setLen) {
+            if (!str || !set || setLen == 0 || len == 0) return nullptr;
+            if (setLen == 1) return static_cast<const char*>(memchr(str, set[0], len));
+
+            const unsigned char* p = reinterpret_cast<const unsigned char*>(str);
+            size_t i = 0;
+            if (setLen <= 8 && findAnyOfVector(p, len, set, setLen, i)) return str + i;
+
+            // 꼬리 구간(또는 큰 집합): 비트맵 조회로 바이트당 한 번만 검사
+            uint32_t bitmap[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+            for (size_t k = 0; k < setLen; ++k) {
+                unsigned char c = (unsigned char)set[k];
+                bitmap[c >> 5] |= (1u << (c & 31));
+            }
+            for (; i < len; ++i) {
+                if (bitmap[p[i] >> 5] & (1u << (p[i] & 31))) return str + i;
+            }
+            return nullptr;
+        }
+
+        /// [findBytes] 길이 기반 부분 문자열 탐색
+        ///
+        /// strstr/strcasestr은 양쪽 모두 NUL 종료를 요구하므로 Token/StringView 같은 뷰에 쓸 수 없습니다.
+        /// 첫 바이트 후보를 memchr(대소문자 무시 시 findAnyOf로 대/소문자 두 개)로 건너뛴 뒤
+        /// 후보 위치에서만 나머지를 비교합니다.
+        /// @param str 검색 대상 (NUL 종료 불필요)
+        /// @param target 찾을 패턴 (NUL 종료 불필요)
+        const char* findBytes(const char* str, size_t strLen, const char* target, size_t targetLen, bool ignoreCase) {
+            if (!str || !target || targetLen > strLen) return nullptr;
+            if (targetLen == 0) return str;
+
+            // 패턴이 시작될 수 있는 마지막 위치 다음까지만 후보를 찾습니다.
+            const char* p = str;
+            const char* last = str + (strLen - targetLen) + 1;
+            const char firstSet[2] = {toLower((unsigned char)target[0]), toUpper((unsigned char)target[0])};
+            const size_t setLen = (ignoreCase && firstSet[0] != firstSet[1]) ? 2 : 1;
+
+            while (p < last) {
+                p = ignoreCase ? findAnyOf(p, (size_t)(last - p), firstSet, setLen)
+                               : static_cast<const char*>(memchr(p, target[0], (size_t)(last - p)));
+                if (!p) return nullptr;
+                if (ignoreCase ? equals(p + 1, targetLen - 1, target + 1, targetLen - 1, true)
+                               : memcmp(p + 1, target + 1, targetLen - 1) == 0) {
+                    return p;
                 }
                 p++;
             }
+            return nullptr;
+        }
 
-            // 마지막 세그먼트 추가
-            tokens[count].ptr = start;
-            tokens[count].len = (size_t)(p - start);
-            return ++count;
+        /// [findLastBytes] 길이 기반 부분 문자열 역방향 탐색
+        ///
+        /// 끝에서부터 후보 위치를 거꾸로 검사하므로, 첫 발견이 곧 마지막 출현 위치입니다.
+        const char* findLastBytes(const char* str, size_t strLen, const char* target, size_t targetLen, bool ignoreCase) {
+            if (!str || !target || targetLen > strLen) return nullptr;
+            if (targetLen == 0) return str + strLen;
+
+            const char first = ignoreCase ? toLower((unsigned char)target[0]) : target[0];
+            for (size_t i = strLen - targetLen + 1; i-- > 0;) {
+                const char* p = str + i;
+                const char c = ignoreCase ? toLower((unsigned char)*p) : *p;
+                if (c == first && equals(p + 1, targetLen - 1, target + 1, targetLen - 1, ignoreCase)) return p;
+            }
+            return nullptr;
         }
 
         /// [append] 고속 데이터 추가
@@ -962,8 +2863,10 @@ namespace cms {
         /// @param curLen [IN/OUT] 현재 길이
         /// @param src 추가할 데이터 소스
         /// @param srcLen 추가할 데이터의 바이트 길이
-        void append(char* __restrict buffer, size_t maxLen, size_t& curLen, const char* __restrict src, size_t srcLen) noexcept {
-            if (!buffer || !src || srcLen == 0 || curLen >= maxLen - 1) return;
+        /// @return 공간이 부족해 버려진 바이트 수
+        size_t append(char* __restrict buffer, size_t maxLen, size_t& curLen, const char* __restrict src, size_t srcLen) noexcept {
+            if (!src || srcLen == 0) return 0;
+            if (!buffer || maxLen == 0 || curLen >= maxLen - 1) return srcLen;
 
             size_t available = maxLen - 1 - curLen;
             size_t toCopy = (srcLen < available) ? srcLen : available;
@@ -973,70 +2876,360 @@ namespace cms {
                 curLen += toCopy;
                 buffer[curLen] = '\0';
             }
+            return srcLen - toCopy;
         }
 
         /// [appendInt] 정수값을 문자열로 변환하여 추가
         ///
         /// 숫자를 텍스트로 변환하여 버퍼 끝에 덧붙입니다. 자릿수 맞춤(Padding) 기능을 지원합니다.
+        /// int64_t 전체 범위(마이크로초 타임스탬프 등)를 지원합니다.
         /// @param buffer 대상 버퍼
         /// @param curLen [IN/OUT] 현재 길이
         /// @param val 변환할 정수값
-        /// @param width 최소 출력 너비
+        /// @param width 최소 출력 너비 (부호 포함)
         /// @param padChar 채움 문자 (예: '0', ' ')
-        void appendInt(char* buffer, size_t maxLen, size_t& curLen, long val, int width, char padChar) {
-            // 1. 방어적 코드: 버퍼가 이미 가득 찼다면 중단합니다.
-            if (curLen >= maxLen - 1) return;
-            unsigned long uval;
-            if (val < 0) {
-                buffer[curLen++] = '-';
-                uval = static_cast<unsigned long>(-(val + 1)) + 1;
-                appendUIntInternal(buffer, maxLen, curLen, uval, width > 0 ? width - 1 : 0, padChar);
-            } else {
-                uval = static_cast<unsigned long>(val);
-                appendUIntInternal(buffer, maxLen, curLen, uval, width, padChar);
+        size_t appendInt(char* buffer, size_t maxLen, size_t& curLen, long long val, int width, char padChar) {
+            // 최솟값(-2^63)도 오버플로우 없이 절대값을 구합니다.
+            const uint64_t uval = (val < 0) ? (uint64_t)0 - (uint64_t)val : (uint64_t)val;
+            return appendUIntInternal(buffer, maxLen, curLen, uval, width, padChar, val < 0);
+        }
+
+        /// [appendUInt] 부호 없는 정수값을 문자열로 변환하여 추가
+        ///
+        /// @param val 변환할 값 (uint64_t 전체 범위)
+        /// @param width 최소 출력 너비
+        /// @param padChar 채움 문자
+        size_t appendUInt(char* buffer, size_t maxLen, size_t& curLen, unsigned long long val, int width, char padChar) {
+            return appendUIntInternal(buffer, maxLen, curLen, (uint64_t)val, width, padChar);
+        }
+
+        /// [appendHex] 부호 없는 정수값을 16진수 문자열로 변환하여 추가
+        ///
+        /// @param val 변환할 값 (uint64_t 전체 범위)
+        /// @param width 최소 출력 너비
+        /// @param padChar 채움 문자
+        /// @param uppercase true일 경우 A-F 대문자 사용
+        size_t appendHex(char* buffer, size_t maxLen, size_t& curLen, unsigned long long val, int width, char padChar, bool uppercase) {
+            return appendHexInternal(buffer, maxLen, curLen, (uint64_t)val, width, padChar, uppercase);
+        }
+
+        /// [appendHexBytes] 바이트 배열을 16진수 덤프로 변환하여 추가
+        ///
+        /// 바이트마다 appendPrintf("%02X ")를 호출하면 포맷 파서가 바이트 수만큼 반복 실행됩니다.
+        /// 여기서는 남은 공간에 들어가는 바이트 수를 먼저 계산한 뒤, 구분자가 없으면 16바이트씩 SIMD로,
+        /// 나머지는 니블 테이블로 한 번에 기록합니다.
+        /// @param data 원본 바이트
+        /// @param len 원본 바이트 수
+        /// @param separator 바이트 사이 구분 문자 ('\0'이면 구분 없음)
+        /// @param uppercase true일 경우 A-F 대문자 사용
+        /// @return 기록한 원본 바이트 수 (공간이 부족하면 바이트 단위로 잘림)
+        size_t appendHexBytes(char* buffer, size_t maxLen, size_t& curLen, const void* data, size_t len, char separator, bool uppercase) {
+            if (!buffer || !data || len == 0 || curLen + 2 >= maxLen) return 0;
+
+            // 1. 들어갈 수 있는 바이트 수 계산 (첫 바이트 2자, 이후 바이트당 2자 + 구분자)
+            const size_t stride = separator ? 3 : 2;
+            const size_t room = maxLen - 1 - curLen;
+            size_t fit = (room - 2) / stride + 1;
+            if (fit > len) fit = len;
+
+            // 2. 니블 테이블로 기록
+            const char* hexChars = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+            const uint8_t* src = (const uint8_t*)data;
+            char* out = buffer + curLen;
+            size_t i = 0;
+            if (!separator) {
+                i = hexEncodeVector(src, fit, out, uppercase);
+                out += 2 * i;
             }
+            for (; i < fit; ++i) {
+                if (separator && i > 0) *out++ = separator;
+                *out++ = hexChars[src[i] >> 4];
+                *out++ = hexChars[src[i] & 0xF];
+            }
+            curLen = (size_t)(out - buffer);
+            buffer[curLen] = '\0';
+            return fit;
         }
 
-        /// [appendFloat] 실수값을 문자열로 변환하여 추가
+        /// [appendBase64] 바이트 배열을 Base64(RFC 4648)로 인코딩하여 추가
         ///
-        /// 반올림 보정을 수행한 후 정수부와 소수부를 분리하여 순차적으로 결합합니다.
-        /// @param buffer 대상 버퍼
-        /// @param curLen [IN/OUT] 현재 길이
-        /// @param val 변환할 실수값
-        /// @param decimalPlaces 소수점 이하 출력 자리수
-        void appendFloat(char* buffer, size_t maxLen, size_t& curLen, double val, int decimalPlaces) {
-            if (curLen >= maxLen - 1) return;
-            if (decimalPlaces < 0) decimalPlaces = 0;
-            if (decimalPlaces > 9) decimalPlaces = 9;
+        /// 3바이트를 24비트 워드로 묶어 6비트씩 테이블에서 꺼냅니다.
+        /// 공간이 부족하면 3바이트 그룹 경계에서 멈추므로, 반환값 이후부터 이어서 인코딩해도 결과가 이어집니다.
+        /// @param urlSafe true이면 '-', '_' 문자를 사용하고 '=' 패딩을 생략합니다.
+        /// @return 인코딩한 원본 바이트 수 (len보다 작으면 잘림)
+        size_t appendBase64(char* buffer, size_t maxLen, size_t& curLen, const void* data, size_t len, bool urlSafe) {
+            if (!buffer || !data || len == 0 || curLen + 1 >= maxLen) return 0;
+
+            const char* alphabet = urlSafe ? kBase64Url : kBase64Std;
+            const uint8_t* src = (const uint8_t*)data;
+            const size_t room = maxLen - 1 - curLen;
+
+            // 1. 완전한 3바이트 그룹
+            size_t groups = len / 3;
+            if (groups > room / 4) groups = room / 4;
+            char* out = buffer + curLen;
+            for (size_t g = 0; g < groups; ++g, src += 3, out += 4) {
+                const uint32_t v = ((uint32_t)src[0] << 16) | ((uint32_t)src[1] << 8) | src[2];
+                out[0] = alphabet[v >> 18];
+                out[1] = alphabet[(v >> 12) & 0x3F];
+                out[2] = alphabet[(v >> 6) & 0x3F];
+                out[3] = alphabet[v & 0x3F];
+            }
+            size_t consumed = groups * 3;
+
+            // 2. 1~2바이트 꼬리 (모든 그룹이 들어간 경우에만)
+            const size_t tail = len - consumed;
+            if (tail > 0 && tail < 3) {
+                const size_t need = urlSafe ? tail + 1 : 4;
+                if (room - groups * 4 >= need) {
+                    const uint32_t v = ((uint32_t)src[0] << 16) | (tail == 2 ? (uint32_t)src[1] << 8 : 0);
+                    *out++ = alphabet[v >> 18];
+                    *out++ = alphabet[(v >> 12) & 0x3F];
+                    if (tail == 2) *out++ = alphabet[(v >> 6) & 0x3F];
+                    if (!urlSafe) {
+                        if (tail == 1) *out++ = '=';
+                        *out++ = '=';
+                    }
+                    consumed = len;
+                }
+            }
 
-            double dval = val;
-            if (dval < 0) {
-                buffer[curLen++] = '-';
-                dval = -dval;
+            curLen = (size_t)(out - buffer);
+            buffer[curLen] = '\0';
+            return consumed;
+        }
+
+        /// [appendBase32] 바이트 배열을 Base32(RFC 4648)로 인코딩하여 추가
+        ///
+        /// 5바이트를 40비트 워드로 묶어 5비트씩 테이블에서 꺼내며, 마지막 그룹은 '='로 8자를 채웁니다.
+        /// @return 인코딩한 원본 바이트 수 (len보다 작으면 잘림)
+        size_t appendBase32(char* buffer, size_t maxLen, size_t& curLen, const void* data, size_t len) {
+            if (!buffer || !data || len == 0 || curLen + 1 >= maxLen) return 0;
+
+            const uint8_t* src = (const uint8_t*)data;
+            const size_t room = maxLen - 1 - curLen;
+            char* out = buffer + curLen;
+
+            // 1. 완전한 5바이트 그룹
+            size_t groups = len / 5;
+            if (groups > room / 8) groups = room / 8;
+            for (size_t g = 0; g < groups; ++g, src += 5, out += 8) {
+                uint64_t v = ((uint64_t)src[0] << 32) | ((uint64_t)src[1] << 24) | ((uint64_t)src[2] << 16) |
+                             ((uint64_t)src[3] << 8) | src[4];
+                for (int k = 7; k >= 0; --k, v >>= 5) out[k] = kBase32[v & 0x1F];
+            }
+            size_t consumed = groups * 5;
+
+            // 2. 1~4바이트 꼬리: 0으로 채워 변환한 뒤 유효 문자 이후를 '='로 채웁니다.
+            const size_t tail = len - consumed;
+            if (tail > 0 && tail < 5 && room - groups * 8 >= 8) {
+                static const uint8_t kChars[5] = {0, 2, 4, 5, 7};
+                uint64_t v = 0;
+                for (size_t k = 0; k < 5; ++k) v = (v << 8) | (k < tail ? src[k] : 0);
+                for (int k = 7; k >= 0; --k, v >>= 5) out[k] = kBase32[v & 0x1F];
+                for (size_t k = kChars[tail]; k < 8; ++k) out[k] = '=';
+                out += 8;
+                consumed = len;
             }
 
-            // 1. 반올림 보정 (나눗셈 대신 미리 계산된 테이블 사용)
-            dval += roundingOffsets[decimalPlaces];
+            curLen = (size_t)(out - buffer);
+            buffer[curLen] = '\0';
+            return consumed;
+        }
 
-            // 2. 정수부 추출 및 추가
-            unsigned long intPart = (unsigned long)dval;
-            appendInt(buffer, maxLen, curLen, (long)intPart, 0, ' ');
+        /// [decodeHexTo] 16진수 문자열을 바이트 배열로 디코딩
+        ///
+        /// 대소문자를 모두 허용하며, 바이트 쌍 사이의 공백("DE AD BE EF")은 건너뜁니다.
+        /// 연속된 16진수 구간은 32자씩 SIMD로 검증과 변환을 동시에 수행합니다.
+        /// @param first 입력 시작
+        /// @param last 입력 끝
+        /// @param dest 결과 버퍼
+        /// @param destCap 결과 버퍼 크기
+        /// @param written [OUT] 기록한 바이트 수
+        /// @return Ok / Invalid(ptr: 잘못된 문자 또는 짝이 없는 마지막 자리) / OutOfRange(ptr: 기록하지 못한 첫 바이트 쌍)
+        ParseResult decodeHexTo(const char* first, const char* last, void* dest, size_t destCap, size_t& written) {
+            written = 0;
+            if (!first || !last || first > last) return { first, ParseError::Invalid };
+            uint8_t* dst = (uint8_t*)dest;
+            if (!dst) destCap = 0;
+
+            const char* p = first;
+            bool tryVector = true;
+            while (p < last) {
+                if (tryVector) {
+                    const size_t n = hexDecodeVector(p, (size_t)(last - p), dst + written, destCap - written);
+                    p += n;
+                    written += n / 2;
+                    tryVector = (n > 0);
+                    if (p >= last) break;
+                }
+                const unsigned char c = (unsigned char)*p;
+                if (isSpace(c)) {
+                    p++;
+                    if (!tryVector) tryVector = (c == '\n'); // 줄바꿈 후 다시 연속 구간일 가능성이 높습니다.
+                    continue;
+                }
+                const unsigned hi = digitValue(c);
+                if (hi >= 16) return { p, ParseError::Invalid };
+                if (p + 1 >= last) return { p, ParseError::Invalid };
+                const unsigned lo = digitValue((unsigned char)p[1]);
+                if (lo >= 16) return { p + 1, ParseError::Invalid };
+                if (written >= destCap) return { p, ParseError::OutOfRange };
+                dst[written++] = (uint8_t)((hi << 4) | lo);
+                p += 2;
+            }
+            return { p, ParseError::Ok };
+        }
 
-            // 3. 소수부 추출 및 추가 (정수 연산으로 변환하여 정밀도 확보)
-            if (decimalPlaces > 0 && curLen < maxLen - 1) {
-                buffer[curLen++] = '.';
+        /// [decodeBase64To] Base64 문자열을 바이트 배열로 디코딩
+        ///
+        /// 표준('+', '/')과 URL-safe('-', '_') 문자를 모두 허용하고, 공백/줄바꿈은 건너뜁니다.
+        /// '=' 패딩은 선택 사항이며, 패딩 뒤에는 공백만 올 수 있습니다.
+        /// 공백 없는 4자 그룹은 역변환 테이블 4회 조회와 OR 한 번으로 검증합니다.
+        /// @param written [OUT] 기록한 바이트 수
+        /// @return Ok / Invalid(ptr: 잘못된 문자) / OutOfRange(ptr: 기록하지 못한 첫 그룹)
+        ParseResult decodeBase64To(const char* first, const char* last, void* dest, size_t destCap, size_t& written) {
+            written = 0;
+            if (!first || !last || first > last) return { first, ParseError::Invalid };
+            uint8_t* dst = (uint8_t*)dest;
+            if (!dst) destCap = 0;
+
+            const uint8_t* table = kBase64Decode.v;
+            const char* p = first;
+            const char* groupStart = p;
+            uint32_t acc = 0;
+            int n = 0; // acc에 모인 6비트 값 개수
+            while (p < last) {
+                // 고속 경로: 그룹 경계에서 공백 없는 4자
+                if (n == 0 && last - p >= 4) {
+                    const uint8_t a = table[(unsigned char)p[0]], b = table[(unsigned char)p[1]];
+                    const uint8_t c = table[(unsigned char)p[2]], d = table[(unsigned char)p[3]];
+                    if (((a | b | c | d) & 0x80) == 0) {
+                        if (written + 3 > destCap) return { p, ParseError::OutOfRange };
+                        const uint32_t v = ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6) | d;
+                        dst[written++] = (uint8_t)(v >> 16);
+                        dst[written++] = (uint8_t)(v >> 8);
+                        dst[written++] = (uint8_t)v;
+                        p += 4;
+                        continue;
+                    }
+                }
+                const unsigned char ch = (unsigned char)*p;
+                const uint8_t v = table[ch];
+                if (v < 64) {
+                    if (n == 0) groupStart = p;
+                    acc = (acc << 6) | v;
+                    p++;
+                    if (++n == 4) {
+                        if (written + 3 > destCap) return { groupStart, ParseError::OutOfRange };
+                        dst[written++] = (uint8_t)(acc >> 16);
+                        dst[written++] = (uint8_t)(acc >> 8);
+                        dst[written++] = (uint8_t)acc;
+                        n = 0;
+                        acc = 0;
+                    }
+                    continue;
+                }
+                if (isSpace(ch)) { p++; continue; }
+                if (ch == '=' && n >= 2) break;
+                return { p, ParseError::Invalid };
+            }
 
-                double fracPart = dval - (double)intPart;
-                // 부동 소수점 오차 보정을 위해 미세한 값(epsilon)을 더함 (double 정밀도에 맞춰 조정)
-                unsigned long fracInt = (unsigned long)(fracPart * powersOf10[decimalPlaces] + 1e-9);
+            // 꼬리 그룹: 2자 -> 1바이트, 3자 -> 2바이트
+            if (n == 1) return { p, ParseError::Invalid };
+            if (n >= 2) {
+                const size_t bytes = (size_t)(n - 1);
+                if (written + bytes > destCap) return { groupStart, ParseError::OutOfRange };
+                acc <<= 6 * (4 - n);
+                dst[written++] = (uint8_t)(acc >> 16);
+                if (bytes == 2) dst[written++] = (uint8_t)(acc >> 8);
+            }
+            while (p < last && (*p == '=' || isSpace((unsigned char)*p))) p++;
+            if (p < last) return { p, ParseError::Invalid };
+            return { p, ParseError::Ok };
+        }
 
-                // 자릿수 오버플로우 방지 (예: 0.999... 가 1.0이 되는 경우)
-                if (fracInt >= (unsigned long)powersOf10[decimalPlaces]) {
-                    fracInt = (unsigned long)powersOf10[decimalPlaces] - 1;
+        /// [decodeBase32To] Base32 문자열을 바이트 배열로 디코딩
+        ///
+        /// 대소문자를 모두 허용하고 공백은 건너뛰며, '=' 패딩은 선택 사항입니다.
+        /// @param written [OUT] 기록한 바이트 수
+        /// @return Ok / Invalid(ptr: 잘못된 문자 또는 불완전한 꼬리) / OutOfRange(ptr: 기록하지 못한 첫 그룹)
+        ParseResult decodeBase32To(const char* first, const char* last, void* dest, size_t destCap, size_t& written) {
+            written = 0;
+            if (!first || !last || first > last) return { first, ParseError::Invalid };
+            uint8_t* dst = (uint8_t*)dest;
+            if (!dst) destCap = 0;
+
+            const char* p = first;
+            const char* groupStart = p;
+            uint64_t acc = 0;
+            int n = 0; // acc에 모인 5비트 값 개수
+            while (p < last) {
+                const unsigned char ch = (unsigned char)*p;
+                const unsigned v = base32Value(ch);
+                if (v < 32) {
+                    if (n == 0) groupStart = p;
+                    acc = (acc << 5) | v;
+                    p++;
+                    if (++n == 8) {
+                        if (written + 5 > destCap) return { groupStart, ParseError::OutOfRange };
+                        for (int k = 4; k >= 0; --k) dst[written++] = (uint8_t)(acc >> (8 * k));
+                        n = 0;
+                        acc = 0;
+                    }
+                    continue;
                 }
+                if (isSpace(ch)) { p++; continue; }
+                if (ch == '=' && n > 0) break;
+                return { p, ParseError::Invalid };
+            }
 
-                appendUIntInternal(buffer, maxLen, curLen, fracInt, decimalPlaces, '0');
+            // 꼬리 그룹: 2/4/5/7자 -> 1/2/3/4바이트
+            if (n > 0) {
+                static const int8_t kBytes[8] = {0, -1, 1, -1, 2, 3, -1, 4};
+                const int bytes = kBytes[n];
+                if (bytes < 0) return { p, ParseError::Invalid };
+                if (written + (size_t)bytes > destCap) return { groupStart, ParseError::OutOfRange };
+                acc <<= 5 * (8 - n);
+                for (int k = 0; k < bytes; ++k) dst[written++] = (uint8_t)(acc >> (32 - 8 * k));
             }
+            while (p < last && (*p == '=' || isSpace((unsigned char)*p))) p++;
+            if (p < last) return { p, ParseError::Invalid };
+            return { p, ParseError::Ok };
+        }
+
+        /// [appendFloat] 실수값을 소수점 고정 표기로 변환하여 추가
+        ///
+        /// 값을 정확히 전개하여 소수점 이하 decimalPlaces 자리에서 한 번만 반올림합니다. (Half-Even, printf %.Nf와 동일)
+        /// 정수부를 정수형으로 캐스팅하지 않으므로 4.3e9 이상의 값도 정확히 출력됩니다.
+        /// @param buffer 대상 버퍼
+        /// @param curLen [IN/OUT] 현재 길이
+        /// @param val 변환할 실수값
+        /// @param decimalPlaces 소수점 이하 출력 자리수
+        size_t appendFloat(char* buffer, size_t maxLen, size_t& curLen, double val, int decimalPlaces) {
+            if (decimalPlaces < 0) decimalPlaces = 0;
+            return appendFloatInternal(buffer, maxLen, curLen, val, false, FloatFormat::Fixed, decimalPlaces, false, 0, ' ');
+        }
+
+        /// [appendFloat] 실수값(double)을 지정한 형식으로 변환하여 추가
+        ///
+        /// @param format 출력 형식 (Fixed, Exponent, General, Shortest)
+        /// @param precision 정밀도 (-1이면 6, Shortest에서는 무시)
+        /// @param uppercase 지수/특수값을 대문자(E, INF, NAN)로 출력할지 여부
+        /// @param width 최소 출력 너비
+        /// @param padChar 채움 문자
+        size_t appendFloat(char* buffer, size_t maxLen, size_t& curLen, double val, FloatFormat format, int precision, bool uppercase,
+                           int width, char padChar) {
+            return appendFloatInternal(buffer, maxLen, curLen, val, false, format, precision, uppercase, width, padChar);
+        }
+
+        /// [appendFloat] 실수값(float)을 지정한 형식으로 변환하여 추가
+        ///
+        /// Shortest는 float 정밀도 기준으로 계산하므로 3.14f는 "3.1400001"이 아닌 "3.14"로 출력됩니다.
+        /// 정밀도 지정 형식은 float 값 그대로를 전개합니다. (printf에 float를 넘긴 것과 동일)
+        size_t appendFloat(char* buffer, size_t maxLen, size_t& curLen, float val, FloatFormat format, int precision, bool uppercase,
+                           int width, char padChar) {
+            return appendFloatInternal(buffer, maxLen, curLen, (double)val, true, format, precision, uppercase, width, padChar);
         }
 
         /// [contains] 부분 문자열 포함 여부 확인
@@ -1052,9 +3245,7 @@ namespace cms {
 
         bool contains(const char* str, size_t strLen, const char* target, size_t targetLen, bool ignoreCase) {
             if (!str || !target || targetLen > strLen) return false;
-            if (targetLen == 0) return true;
-
-            return (ignoreCase ? cms::string::strcasestr(str, target) : strstr(str, target)) != nullptr;
+            return findBytes(str, strLen, target, targetLen, ignoreCase) != nullptr;
         }
 
         /// [toUpperCase] 모든 영문 소문자를 대문자로 변환
@@ -1069,6 +3260,12 @@ namespace cms {
             }
         }
 
+        // [최적화] 길이를 알고 있는 경우를 위한 오버로드 (NUL 검사 없는 고정 횟수 루프)
+        void toUpperCase(char* str, size_t len) {
+            if (!str) return;
+            for (size_t i = 0; i < len; ++i) str[i] = toUpper((unsigned char)str[i]);
+        }
+
         /// [toLowerCase] 모든 영문 대문자를 소문자로 변환
         ///
         /// ASCII 범위 내의 문자만 처리하여 한글 등 멀티바이트 인코딩 깨짐을 방지합니다.
@@ -1081,6 +3278,12 @@ namespace cms {
             }
         }
 
+        // [최적화] 길이를 알고 있는 경우를 위한 오버로드
+        void toLowerCase(char* str, size_t len) {
+            if (!str) return;
+            for (size_t i = 0; i < len; ++i) str[i] = toLower((unsigned char)str[i]);
+        }
+
         /// [endsWith] 접미사 일치 여부 확인
         ///
         /// 파일 확장자나 특정 종료 문구로 끝나는지 판별하기 위해 사용합니다.
@@ -1096,15 +3299,8 @@ namespace cms {
         bool endsWith(const char* str, size_t strLen, const char* suffix, size_t suffixLen, bool ignoreCase) {
             if (!str || !suffix || suffixLen > strLen) return false;
 
-            const char* target = str + (strLen - suffixLen);
-            if (!ignoreCase) return strcmp(target, suffix) == 0;
-
-            // [최적화] strcasecmp 대체 로직
-            while (*target && *suffix) {
-                if (toLower((unsigned char)*target) != toLower((unsigned char)*suffix)) return false;
-                target++; suffix++;
-            }
-            return *suffix == '\0';
+            // 길이가 같은 두 구간 비교이므로 NUL 종료와 무관하게 equals(memcmp)로 끝납니다.
+            return equals(str + (strLen - suffixLen), suffixLen, suffix, suffixLen, ignoreCase);
         }
 
         /// [replace] 특정 패턴의 전체 치환
@@ -1117,21 +3313,23 @@ namespace cms {
         /// @param to 바꿀 내용
         /// @param ignoreCase true일 경우 대소문자 무시
         size_t replace(char* str, size_t maxLen, size_t curLen, const char* from, const char* to, bool ignoreCase) {
-            if (!str || !from || !to || *from == '\0') return curLen;
+            if (!from || !to) return curLen;
+            return replace(str, maxLen, curLen, from, strlen(from), to, strlen(to), ignoreCase);
+        }
+
+        // [최적화] 패턴/치환 길이를 이미 알고 있는 경우를 위한 오버로드 (NUL 종료 불필요)
+        size_t replace(char* str, size_t maxLen, size_t curLen, const char* from, size_t fromLen,
+                       const char* to, size_t toLen, bool ignoreCase, size_t* dropped) {
+            if (dropped) *dropped = 0;
+            if (!str || !from || !to || fromLen == 0) return curLen;
 
-            size_t fromLen = strlen(from);
-            size_t toLen = strlen(to);
             size_t currentLen = curLen;
             char* p = str;
             bool truncated = false;
 
             while (true) {
-                // [최적화] 단일 문자 검색 시 strchr 사용 (대소문자 구분 시)
-                if (ignoreCase) {
-                    p = (char*) cms::string::strcasestr(p, from);
-                } else {
-                    p = (fromLen == 1) ? strchr(p, *from) : strstr(p, from);
-                }
+                // 길이 기반 탐색: 첫 바이트 후보를 memchr로 건너뛰므로 단일 문자 패턴도 빠릅니다.
+                p = (char*)findBytes(p, currentLen - (size_t)(p - str), from, fromLen, ignoreCase);
 
                 if (!p) break;
 
@@ -1139,6 +3337,16 @@ namespace cms {
                     size_t diff = toLen - fromLen;
                     if (currentLen + diff >= maxLen) {
                         truncated = true;
+                        if (dropped) {
+                            // 남은 일치를 모두 치환했을 때의 길이에서 담을 수 있는 길이를 뺀 값입니다.
+                            size_t wouldBe = currentLen + diff;
+                            const char* q = p + fromLen;
+                            while ((q = findBytes(q, currentLen - (size_t)(q - str), from, fromLen, ignoreCase)) != nullptr) {
+                                wouldBe += diff;
+                                q += fromLen;
+                            }
+                            *dropped = wouldBe - (maxLen - 1);
+                        }
                         break;
                     }
                     // [최적화] 데이터가 늘어나는 경우만 memmove로 공간 확보
@@ -1157,7 +3365,7 @@ namespace cms {
             }
 
             // [최적화] 실제로 버퍼 오버플로우로 인해 잘린 경우에만 UTF-8 정제 수행
-            return truncated ? sanitizeUtf8(str, maxLen) : currentLen;
+            return truncated ? sanitizeUtf8(str, maxLen, currentLen) : currentLen;
         }
 
         /// [matches] POSIX 정규표현식 매칭 검사
@@ -1166,10 +3374,17 @@ namespace cms {
         /// @param pattern 정규표현식 패턴
         /// @return true: 매칭 성공, false: 실패 또는 문법 오류
         bool matches(const char* str, const char* pattern) {
+            if (!str) return false;
+            return matches(str, strlen(str), pattern);
+        }
+
+        // [최적화] 길이를 알고 있는 경우를 위한 오버로드
+        // REG_STARTEND(newlib/BSD/glibc)를 지원하면 [0, len) 구간만 검사하고, 아니면 str[len]이 NUL이어야 합니다.
+        bool matches(const char* str, size_t len, const char* pattern) {
 #ifdef ARDUINO
 // Arduino는 기본 환경에 정규식이 없으므로 POSIX regex를 명시적으로 포함합니다.
             // 1. 유효성 검사: 대상 문자열이나 패턴이 비어있으면 매칭 실패로 간주합니다.
-            if (!str || !pattern || *str == '\0') return false;
+            if (!str || !pattern || len == 0) return false;
 
             // 2. 정규식 객체 선언: POSIX 표준 정규식 정보를 담을 구조체입니다.
             regex_t regex;
@@ -1183,7 +3398,14 @@ namespace cms {
 
             // 5. [실행 단계]: 컴파일된 정규식을 실제 문자열에 적용하여 일치 여부를 확인합니다.
             // regexec는 패턴이 일치하면 0을 반환합니다.
+#ifdef REG_STARTEND
+            regmatch_t range[1];
+            range[0].rm_so = 0;
+            range[0].rm_eo = (regoff_t)len;
+            ret = regexec(&regex, str, 1, range, REG_STARTEND);
+#else
             ret = regexec(&regex, str, 0, NULL, 0);
+#endif
 
             // 6. [정리 단계]: 컴파일 과정에서 할당된 내부 메모리를 해제하여 메모리 누수를 방지합니다.
             regfree(&regex);
@@ -1191,6 +3413,7 @@ namespace cms {
             // 7. 결과 반환: 0이면 일치(true), 그 외에는 불일치(false)입니다.
             return (ret == 0);
 #else
+            (void)str; (void)len; (void)pattern;
             return false; // Native 환경에서는 정규식 테스트 제외
 #endif
         }
@@ -1202,16 +3425,28 @@ namespace cms {
         /// @return true: 유효함, false: 인코딩 오류 발견
         bool validateUtf8(const char* str) {
             if (!str) return false;
+            return validateUtf8(str, strlen(str));
+        }
+
+        // [최적화] 길이를 알고 있는 경우를 위한 오버로드 (NUL 종료 불필요)
+        bool validateUtf8(const char* str, size_t len) {
+            if (!str) return false;
 
             const unsigned char* bytes = reinterpret_cast<const unsigned char*>(str);
+            const unsigned char* const end = bytes + len;
 
-            while (*bytes) {
+            while (bytes < end) {
                 // 1. [1바이트 영역 (ASCII)]: 00~7F 범위는 단일 바이트 글자입니다.
                 if (bytes[0] <= 0x7F) {
                     bytes++;
+                    continue;
                 }
+                // 후속 바이트가 구간 밖으로 넘어가면 잘린 시퀀스입니다.
+                const size_t need = bytes[0] >= 0xF0 ? 4 : (bytes[0] >= 0xE0 ? 3 : 2);
+                if (need > (size_t)(end - bytes)) return false;
+
                 // 2. [2바이트 영역]: C2~DF로 시작하며, 뒤에 1개의 후속 바이트가 와야 합니다.
-                else if (bytes[0] >= 0xC2 && bytes[0] <= 0xDF) {
+                if (bytes[0] >= 0xC2 && bytes[0] <= 0xDF) {
                     if ((bytes[1] & 0xC0) != 0x80) return false;
                     bytes += 2;
                 }
@@ -1264,139 +3499,84 @@ namespace cms {
         /// @return 정제 후의 최종 바이트 길이
         size_t sanitizeUtf8(char* str, size_t maxLen) {
             if (!str || maxLen == 0) return 0;
+            // 버퍼 안에 NUL이 없으면 버퍼 끝(maxLen - 1)까지를 내용으로 봅니다.
+            const char* nul = static_cast<const char*>(memchr(str, '\0', maxLen));
+            return sanitizeUtf8(str, maxLen, nul ? (size_t)(nul - str) : maxLen - 1);
+        }
+
+        // [최적화] 현재 길이를 알고 있는 경우를 위한 오버로드 (NUL을 찾지 않고 curLen까지만 읽음)
+        size_t sanitizeUtf8(char* str, size_t maxLen, size_t curLen) {
+            if (!str || maxLen == 0) return 0;
+            if (curLen > maxLen - 1) curLen = maxLen - 1;
 
-            unsigned char* src = reinterpret_cast<unsigned char*>(str);
-            unsigned char* dst = src;
+            unsigned char* const base = reinterpret_cast<unsigned char*>(str);
+            unsigned char* src = base;
+            unsigned char* dst = base;
+            unsigned char* end = base + curLen;
             const char* replacement = "\xEF\xBF\xBD"; // U+FFFD 대체문자(UTF-8 바이트 시퀀스)
             const size_t replLen = 3;
 
-            // 한 번의 선형 통과로 문자열을 재작성하여 O(n) 동작 보장
-            while (*src) {
-                // 유효한 UTF-8 시퀀스와 길이를 검사합니다
-                if (src[0] <= 0x7F) {
-                    // ASCII 한 바이트
-                    if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) >= maxLen - 1) break;
-                    *dst++ = *src++;
-                } else if (src[0] >= 0xC2 && src[0] <= 0xDF) {
-                    // 2-byte sequence
-                    if (src[1] && (src[1] & 0xC0) == 0x80) {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + 2 >= maxLen) break;
-                        *dst++ = *src++;
-                        *dst++ = *src++;
-                    } else {
-                        // 유효하지 않음: 대체문자(혹은 공간 부족 시 '?') 로 대체
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + replLen < maxLen) {
-                            memcpy(dst, replacement, replLen); dst += replLen; src += 1;
-                        } else if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) < maxLen - 1) {
-                            *dst++ = '?'; src += 1;
-                        } else break;
-                    }
-                } else if (src[0] == 0xE0) {
-                    if (src[1] && src[2] && src[1] >= 0xA0 && src[1] <= 0xBF && (src[2] & 0xC0) == 0x80) {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + 3 >= maxLen) break;
-                        *dst++ = *src++; *dst++ = *src++; *dst++ = *src++;
-                    } else {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + replLen < maxLen) {
-                            memcpy(dst, replacement, replLen); dst += replLen; src += 1;
-                        } else if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) < maxLen - 1) {
-                            *dst++ = '?'; src += 1;
-                        } else break;
-                    }
-                } else if (src[0] >= 0xE1 && src[0] <= 0xEC) {
-                    if (src[1] && src[2] && (src[1] & 0xC0) == 0x80 && (src[2] & 0xC0) == 0x80) {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + 3 >= maxLen) break;
-                        *dst++ = *src++; *dst++ = *src++; *dst++ = *src++;
-                    } else {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + replLen < maxLen) {
-                            memcpy(dst, replacement, replLen); dst += replLen; src += 1;
-                        } else if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) < maxLen - 1) {
-                            *dst++ = '?'; src += 1;
-                        } else break;
-                    }
-                } else if (src[0] == 0xED) {
-                    if (src[1] && src[2] && src[1] >= 0x80 && src[1] <= 0x9F && (src[2] & 0xC0) == 0x80) {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + 3 >= maxLen) break;
-                        *dst++ = *src++; *dst++ = *src++; *dst++ = *src++;
-                    } else {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + replLen < maxLen) {
-                            memcpy(dst, replacement, replLen); dst += replLen; src += 1;
-                        } else if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) < maxLen - 1) {
-                            *dst++ = '?'; src += 1;
-                        } else break;
-                    }
-                } else if (src[0] >= 0xEE && src[0] <= 0xEF) {
-                    if (src[1] && src[2] && (src[1] & 0xC0) == 0x80 && (src[2] & 0xC0) == 0x80) {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + 3 >= maxLen) break;
-                        *dst++ = *src++; *dst++ = *src++; *dst++ = *src++;
-                    } else {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + replLen < maxLen) {
-                            memcpy(dst, replacement, replLen); dst += replLen; src += 1;
-                        } else if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) < maxLen - 1) {
-                            *dst++ = '?'; src += 1;
-                        } else break;
-                    }
-                } else if (src[0] == 0xF0) {
-                    if (src[1] && src[2] && src[3] && src[1] >= 0x90 && src[1] <= 0xBF && (src[2] & 0xC0) == 0x80 && (src[3] & 0xC0) == 0x80) {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + 4 >= maxLen) break;
-                        *dst++ = *src++; *dst++ = *src++; *dst++ = *src++; *dst++ = *src++;
-                    } else {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + replLen < maxLen) {
-                            memcpy(dst, replacement, replLen); dst += replLen; src += 1;
-                        } else if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) < maxLen - 1) {
-                            *dst++ = '?'; src += 1;
-                        } else break;
-                    }
-                } else if (src[0] >= 0xF1 && src[0] <= 0xF3) {
-                    if (src[1] && src[2] && src[3] && (src[1] & 0xC0) == 0x80 && (src[2] & 0xC0) == 0x80 && (src[3] & 0xC0) == 0x80) {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + 4 >= maxLen) break;
-                        *dst++ = *src++; *dst++ = *src++; *dst++ = *src++; *dst++ = *src++;
-                    } else {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + replLen < maxLen) {
-                            memcpy(dst, replacement, replLen); dst += replLen; src += 1;
-                        } else if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) < maxLen - 1) {
-                            *dst++ = '?'; src += 1;
-                        } else break;
-                    }
-                } else if (src[0] == 0xF4) {
-                    if (src[1] && src[2] && src[3] && src[1] >= 0x80 && src[1] <= 0x8F && (src[2] & 0xC0) == 0x80 && (src[3] & 0xC0) == 0x80) {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + 4 >= maxLen) break;
-                        *dst++ = *src++; *dst++ = *src++; *dst++ = *src++; *dst++ = *src++;
+            // 한 번의 선형 통과로 문자열을 재작성하여 O(n) 동작 보장 (깨진 바이트가 없으면 dst == src로 복사만 수행)
+            while (src < end) {
+                const size_t out = (size_t)(dst - base);
+                const size_t seq = utf8SequenceLength(src, end);
+                if (seq != 0) {
+                    // 유효한 시퀀스: 통째로 들어갈 자리가 없으면 멈춥니다. (글자를 반으로 자르지 않음)
+                    if (out + seq >= maxLen) break;
+                    if (dst != src) memmove(dst, src, seq);
+                    dst += seq;
+                    src += seq;
+                    continue;
+                }
+
+                // 유효하지 않음: 대체문자(혹은 공간 부족 시 '?') 로 대체
+                if (out + replLen < maxLen) {
+                    // 1바이트를 3바이트로 바꾸므로, 아직 읽지 않은 뒷부분을 덮어쓰게 되면 먼저 뒤로 밀어 둡니다.
+                    unsigned char* const next = src + 1;
+                    if (dst + replLen > next) {
+                        const size_t shift = (size_t)(dst + replLen - next);
+                        size_t rest = (size_t)(end - next);
+                        const size_t room = maxLen - 1 - (out + replLen);
+                        if (rest > room) rest = room;
+                        memmove(next + shift, next, rest);
+                        src = next + shift;
+                        end = src + rest;
                     } else {
-                        if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + replLen < maxLen) {
-                            memcpy(dst, replacement, replLen); dst += replLen; src += 1;
-                        } else if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) < maxLen - 1) {
-                            *dst++ = '?'; src += 1;
-                        } else break;
+                        src = next;
                     }
+                    memcpy(dst, replacement, replLen);
+                    dst += replLen;
+                } else if (out < maxLen - 1) {
+                    *dst++ = '?';
+                    src += 1;
                 } else {
-                    // 어떤 규칙에도 맞지 않는 바이트
-                    if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) + replLen < maxLen) {
-                        memcpy(dst, replacement, replLen); dst += replLen; src += 1;
-                    } else if ((size_t)(dst - reinterpret_cast<unsigned char*>(str)) < maxLen - 1) {
-                        *dst++ = '?'; src += 1;
-                    } else break;
+                    break;
                 }
             }
 
             // 최종 널 종료
-            size_t finalLen = (size_t)(dst - reinterpret_cast<unsigned char*>(str));
-            if (finalLen < maxLen) *dst = '\0';
-            else { finalLen = maxLen - 1; *(reinterpret_cast<unsigned char*>(str) + finalLen) = '\0'; }
-
-            return finalLen;
+            *dst = '\0';
+            return (size_t)(dst - base);
         }
 
         /// [appendPrintf] 초경량 포맷팅 엔진
         ///
         /// 표준 vsnprintf의 무거운 스택 사용량을 피하면서 가변 인자 포맷팅 기능을 제공합니다.
-        /// %s, %d, %f 등 필수 지정자만 직접 파싱하여 버퍼 끝에 추가합니다.
+        /// %s, %d, %f, %e, %g 등 필수 지정자만 직접 파싱하여 버퍼 끝에 추가합니다.
+        /// 정수 지정자는 길이 수정자(hh, h, l, ll, z, j, t)를 지원하므로 %lld, %zu, %p 등을 사용할 수 있습니다.
         /// @param buffer 결과 저장 버퍼
         /// @param curLen [IN/OUT] 현재 길이
         /// @param format 포맷 문자열
         /// @param args 가변 인자 리스트
-        /// @return 포맷팅 완료 후 최종 바이트 길이
+        /// @return 공간이 충분했다면 됐을 최종 바이트 길이 (snprintf와 같이, curLen보다 크면 그 차이만큼 잘림)
         int appendPrintf(char* buffer, size_t maxLen, size_t& curLen, const char* format, va_list args) {
             if (!buffer || !format) return 0;
+            CMS_TRACE("appendPrintf");
+
+            // 길이 수정자별 va_arg 호출을 보조 함수로 나누기 위해 이식 가능한 사본을 사용합니다.
+            va_list ap;
+            va_copy(ap, args);
+            size_t dropped = 0; // 커널마다 버린 바이트 수의 합
 
             const char* p = format;
             while (*p) {
@@ -1404,7 +3584,7 @@ namespace cms {
                 const char* nextPercent = strchr(p, '%');
                 if (nextPercent != p) {
                     size_t literalLen = (nextPercent) ? (size_t)(nextPercent - p) : strlen(p);
-                    append(buffer, maxLen, curLen, p, literalLen);
+                    dropped += append(buffer, maxLen, curLen, p, literalLen);
                     p += literalLen;
                     if (!*p) break;
                 }
@@ -1440,62 +3620,88 @@ namespace cms {
                         }
                     }
 
-                    // 4. 타입별 처리
+                    // 4. 길이 수정자 파싱 (hh, h, l, ll, z, j, t, L)
+                    LengthModifier lenMod = LengthModifier::None;
+                    switch (*p) {
+                        case 'h':
+                            if (p[1] == 'h') { lenMod = LengthModifier::Char; p += 2; }
+                            else { lenMod = LengthModifier::Short; p++; }
+                            break;
+                        case 'l':
+                            if (p[1] == 'l') { lenMod = LengthModifier::LongLong; p += 2; }
+                            else { lenMod = LengthModifier::Long; p++; }
+                            break;
+                        case 'z': lenMod = LengthModifier::Size; p++; break;
+                        case 'j': lenMod = LengthModifier::Max; p++; break;
+                        case 't': lenMod = LengthModifier::Ptrdiff; p++; break;
+                        case 'L': p++; break; // long double는 double로 처리
+                        default: break;
+                    }
+
+                    // 5. 타입별 처리
                     switch (*p) {
                         case 's': { // 문자열
-                            const char* s = va_arg(args, const char*);
+                            const char* s = va_arg(ap, const char*);
                             const char* src = s ? s : "(null)";
-                            append(buffer, maxLen, curLen, src, strlen(src));
+                            dropped += append(buffer, maxLen, curLen, src, strlen(src));
                             break;
                         }
-                        case 'd': // 정수
-                            appendInt(buffer, maxLen, curLen, (long)va_arg(args, int), width, padChar);
+                        case 'd': // 부호 있는 정수
+                        case 'i':
+                            dropped += appendInt(buffer, maxLen, curLen, fetchSigned(&ap, lenMod), width, padChar);
                             break;
                         case 'u': // 부호 없는 정수
-                            appendUIntInternal(buffer, maxLen, curLen, va_arg(args, unsigned int), width, padChar);
+                            dropped += appendUIntInternal(buffer, maxLen, curLen, fetchUnsigned(&ap, lenMod), width, padChar);
                             break;
                         case 'x': // 16진수 (소문자)
-                            appendHexInternal(buffer, maxLen, curLen, va_arg(args, unsigned int), width, padChar, false);
+                            dropped += appendHexInternal(buffer, maxLen, curLen, fetchUnsigned(&ap, lenMod), width, padChar, false);
                             break;
                         case 'X': // 16진수 (대문자)
-                            appendHexInternal(buffer, maxLen, curLen, va_arg(args, unsigned int), width, padChar, true);
+                            dropped += appendHexInternal(buffer, maxLen, curLen, fetchUnsigned(&ap, lenMod), width, padChar, true);
                             break;
-                        case 'l': // long (ld, lu, lx, lX 대응)
-                            if (*(p + 1) == 'd') {
-                                appendInt(buffer, maxLen, curLen, va_arg(args, long), width, padChar);
-                                p++;
-                            } else if (*(p + 1) == 'u') {
-                                appendUIntInternal(buffer, maxLen, curLen, va_arg(args, unsigned long), width, padChar);
-                                p++;
-                            } else if (*(p + 1) == 'x') {
-                                appendHexInternal(buffer, maxLen, curLen, va_arg(args, unsigned long), width, padChar, false);
-                                p++;
-                            } else if (*(p + 1) == 'X') {
-                                appendHexInternal(buffer, maxLen, curLen, va_arg(args, unsigned long), width, padChar, true);
-                                p++;
-                            }
+                        case 'p': { // 포인터 (0x 접두사 + 소문자 16진수)
+                            const uintptr_t ptr = (uintptr_t)va_arg(ap, void*);
+                            dropped += append(buffer, maxLen, curLen, "0x", 2);
+                            dropped += appendHexInternal(buffer, maxLen, curLen, (uint64_t)ptr, width > 2 ? width - 2 : 0, padChar, false);
                             break;
-                        case 'f': // 실수
-                            appendFloat(buffer, maxLen, curLen, va_arg(args, double), (precision >= 0) ? precision : 2);
+                        }
+                        case 'f': // 실수 (고정 표기, 기본 정밀도 2)
+                        case 'F':
+                            dropped += appendFloatInternal(buffer, maxLen, curLen, va_arg(ap, double), false, FloatFormat::Fixed,
+                                                           (precision >= 0) ? precision : 2, *p == 'F', width, padChar);
+                            break;
+                        case 'e': // 실수 (지수 표기)
+                        case 'E':
+                            dropped += appendFloatInternal(buffer, maxLen, curLen, va_arg(ap, double), false, FloatFormat::Exponent,
+                                                           precision, *p == 'E', width, padChar);
+                            break;
+                        case 'g': // 실수 (고정/지수 중 짧은 표기)
+                        case 'G':
+                            dropped += appendFloatInternal(buffer, maxLen, curLen, va_arg(ap, double), false, FloatFormat::General,
+                                                           precision, *p == 'G', width, padChar);
                             break;
                         case 'c': // 단일 문자
                             {
-                                char c = (char)va_arg(args, int);
-                                append(buffer, maxLen, curLen, &c, 1);
+                                char c = (char)va_arg(ap, int);
+                                dropped += append(buffer, maxLen, curLen, &c, 1);
                             }
                             break;
                         case '%': // '%' 문자 자체
-                            append(buffer, maxLen, curLen, "%", 1);
+                            dropped += append(buffer, maxLen, curLen, "%", 1);
+                            break;
+                        case '\0': // 지정자 없이 끝난 경우 ("%l" 등)
+                            p--;
                             break;
                         default: // 지원하지 않는 포맷은 원문 출력
-                            append(buffer, maxLen, curLen, "%", 1);
-                            append(buffer, maxLen, curLen, p, 1);
+                            dropped += append(buffer, maxLen, curLen, "%", 1);
+                            dropped += append(buffer, maxLen, curLen, p, 1);
                             break;
                     }
                 }
                 p++;
             }
-            return (int)curLen;
+            va_end(ap);
+            return (int)(curLen + dropped);
         }
 
     } // string
@@ -9,6 +9,7 @@
 #include <cstring>  // strlen, strchr, strstr
 #include <stddef.h> // size_t, NULL
 #include <stdarg.h> // va_list
+#include <stdint.h> // uint8_t, uint32_t, uint64_t, UINTPTR_MAX
 
 namespace cms {
     namespace string {
@@ -68,11 +69,14 @@ namespace cms {
         // 후방 공백은 널 문자로 자르고, 전방 공백은 memmove로 당깁니다.
         //
         // Usage: cms::string::trim(buf);
+        //        len = cms::string::trim(buf, len);   // 길이를 알면 strlen 생략
         //
-        // @param str 수정할 대상 문자열 (Null-terminated)
+        // @param str 수정할 대상 문자열 (Null-terminated, 길이 버전은 str[len]에 NUL을 기록)
+        // @return 수정 후의 문자열 바이트 길이
         // @note 원본 문자열이 직접 수정되므로 데이터 보존이 필요하면 복사본을 사용하세요.
         // ---------------------------------------------------------
         size_t trim(char* str);
+        size_t trim(char* str, size_t len);
 
         // ---------------------------------------------------------
         // [startsWith] 문자열이 특정 접두사(prefix)로 시작하는지 확인합니다.
@@ -143,6 +147,9 @@ namespace cms {
             bool operator==(const char* s) const { return equals(s); }
             bool operator!=(const Token& other) const { return !equals(other); }
             bool operator!=(const char* s) const { return !equals(s); }
+
+            /// 기본 알고리즘(CMS_HASH_DEFAULT)으로 해시를 계산합니다. (Token은 값 타입이라 캐시하지 않음)
+            uint32_t hash(bool ignoreCase = false) const noexcept;
         };
 
         // ---------------------------------------------------------
@@ -163,7 +170,7 @@ namespace cms {
         // Usage: int v = cms::string::toInt("123");
         //
         // @param str 변환할 문자열 (예: "123")
-        // @return 변환된 정수값 (실패 시 0)
+        // @return 변환된 정수값 (실패 시 0, 범위 초과 시 INT_MIN/INT_MAX로 포화)
         // ---------------------------------------------------------
         int toInt(const char* str);
         int toInt(const char* str, size_t len);
@@ -186,7 +193,7 @@ namespace cms {
         // Usage: int v = cms::string::hexToInt("0xABC");
         //
         // @param str 변환할 16진수 문자열
-        // @return 변환된 정수값 (실패 시 0)
+        // @return 변환된 정수값 (32비트 비트 패턴, 실패 시 0, 8자리 초과 시 0xFFFFFFFF로 포화)
         // ---------------------------------------------------------
         int hexToInt(const char* str);
         int hexToInt(const char* str, size_t len);
@@ -213,6 +220,71 @@ namespace cms {
         double toFloat(const char* str);
         double toFloat(const char* str, size_t len);
 
+        // ---------------------------------------------------------
+        // [ParseError] 숫자 파싱 결과 코드입니다.
+        //
+        // - Ok         : 성공
+        // - Invalid    : 숫자 형식이 아님 (값 변경 없음)
+        // - OutOfRange : 표현 범위를 벗어남 (실수는 ±inf 또는 ±0 으로 설정됨)
+        // ---------------------------------------------------------
+        enum class ParseError : uint8_t {
+            Ok = 0,
+            Invalid,
+            OutOfRange
+        };
+
+        // ---------------------------------------------------------
+        // [ParseResult] 숫자 파싱 결과입니다. (std::from_chars_result 대응)
+        // ---------------------------------------------------------
+        struct ParseResult {
+            const char* ptr;  // 파싱이 끝난 위치 (Invalid이면 입력 시작 위치)
+            ParseError ec;    // 결과 코드
+
+            explicit operator bool() const noexcept { return ec == ParseError::Ok; }
+        };
+
+        // ---------------------------------------------------------
+        // [fromChars] 실수 문자열을 정확히 반올림하여 변환합니다.
+        //
+        // 앞쪽 공백은 허용하지 않으며, 숫자가 끝난 위치를 반환하므로 CSV/JSON 필드를 연속으로 읽을 수 있습니다.
+        // 대부분의 입력은 Clinger 고속 경로 또는 Eisel-Lemire(64x64 곱셈 1~2회)로 처리됩니다.
+        //
+        // Usage:
+        //   double v;
+        //   auto r = cms::string::fromChars(p, end, v);
+        //   if (r) p = r.ptr;
+        //
+        // @param first 입력 시작
+        // @param last 입력 끝 (NUL 종료 불필요)
+        // @param value [OUT] 변환 결과
+        // @return 끝 위치와 결과 코드
+        // ---------------------------------------------------------
+        ParseResult fromChars(const char* first, const char* last, double& value);
+        ParseResult fromChars(const char* first, const char* last, float& value);
+
+        // ---------------------------------------------------------
+        // [parseInt] 정수 문자열을 오버플로우 검사와 함께 변환합니다.
+        //
+        // 10진수는 8자리씩 SWAR 곱셈으로 한 번에 변환하며, 타입 한계를 넘으면
+        // 값을 바꾸지 않고 OutOfRange를 반환합니다. (끝 위치는 숫자 뒤)
+        // 부호 없는 타입에 '-'가 오면 Invalid입니다.
+        //
+        // Usage:
+        //   int16_t v;
+        //   auto r = cms::string::parseInt(p, end, v);          // 10진수
+        //   auto h = cms::string::parseInt(p, end, u32, 16);    // 16진수 (0x 접두사 허용)
+        //   auto a = cms::string::parseInt(p, end, u8, 0);      // 0x / 0b 접두사 자동 감지
+        //
+        // @tparam T 정수 타입 (int8_t ~ int64_t, uint8_t ~ uint64_t)
+        // @param first 입력 시작 (앞쪽 공백 불허)
+        // @param last 입력 끝 (NUL 종료 불필요)
+        // @param value [OUT] 변환 결과
+        // @param base 진법 (0: 자동 감지, 2~36, 기본 10)
+        // @return 끝 위치와 결과 코드
+        // ---------------------------------------------------------
+        template <typename T>
+        ParseResult parseInt(const char* first, const char* last, T& value, int base = 10);
+
         // ---------------------------------------------------------
         // [isNumeric] 문자열이 유효한 실수(float/double) 형식인지 검사합니다.
         // 부호(+, -), 소수점(.), 앞뒤 공백을 허용합니다.
@@ -227,12 +299,17 @@ namespace cms {
         // ---------------------------------------------------------
         // [utf8_strlen] UTF-8 인코딩을 인식하여 문자열의 글자 수를 측정합니다.
         //
+        // 후속 바이트(10xxxxxx)가 아닌 바이트 수를 세며, 길이를 아는 경우 SIMD/SWAR로
+        // 한 번에 16~64바이트씩 처리합니다.
+        //
         // Usage: size_t n = cms::string::utf8_strlen(str);
         //
         // @param str 측정할 UTF-8 문자열
+        // @param len 문자열 바이트 길이 (NUL 스캔 생략)
         // @return 논리적 글자 수 (바이트 크기가 아님)
         // ---------------------------------------------------------
         size_t utf8_strlen(const char* str);
+        size_t utf8_strlen(const char* str, size_t len);
         // ---------------------------------------------------------
         // [utf8SafeEnd] UTF-8 ?? ??? ???? ??? ?? ??? ?????.
         //
@@ -282,9 +359,12 @@ namespace cms {
         // @param maxLen 버퍼의 물리적 최대 크기 (널 종료 문자 포함)
         // @param charIdx 삽입할 논리적 글자 위치
         // @param src 삽입할 문자열
+        // @param dropped [OUT, 선택] 공간이 부족해 삽입하지 못한 바이트 수
         // @return 삽입 후의 새로운 문자열 바이트 길이
         // ---------------------------------------------------------
         size_t insert(char* buffer, size_t maxLen, size_t curLen, size_t charIdx, const char* src);
+        size_t insert(char* buffer, size_t maxLen, size_t curLen, size_t charIdx, const char* src, size_t srcLen,
+                      size_t* dropped = nullptr);
 
         // ---------------------------------------------------------
         // [remove] 문자열의 특정 구간을 삭제합니다.
@@ -312,6 +392,7 @@ namespace cms {
         // @return 추출된 문자열의 바이트 길이
         // ---------------------------------------------------------
         size_t substring(const char* src, char* dest, size_t destLen, size_t left, size_t right = 0);
+        size_t substring(const char* src, size_t srcLen, char* dest, size_t destLen, size_t left, size_t right = 0);
 
         // ---------------------------------------------------------
         // [byteSubstring] 바이트 오프셋 기준으로 문자열을 자릅니다.
@@ -326,6 +407,7 @@ namespace cms {
         // @return 추출된 문자열의 바이트 길이
         // ---------------------------------------------------------
         size_t byteSubstring(const char* src, char* dest, size_t destLen, size_t startByte, size_t endByte = 0);
+        size_t byteSubstring(const char* src, size_t srcLen, char* dest, size_t destLen, size_t startByte, size_t endByte = 0);
 
         // ---------------------------------------------------------
 
@@ -341,6 +423,7 @@ namespace cms {
         // @return 실제 분리된 토큰의 개수
         // ---------------------------------------------------------
         size_t split(char* str, char delimiter, char** tokens, size_t maxTokens);
+        size_t split(char* str, size_t len, char delimiter, char** tokens, size_t maxTokens);
 
         // ---------------------------------------------------------
         // [split] 원본을 보존하는 비파괴적 분할 함수입니다. (최적화)
@@ -354,6 +437,43 @@ namespace cms {
         // @return 실제 분리된 토큰의 개수
         // ---------------------------------------------------------
         size_t split(const char* str, char delimiter, Token* tokens, size_t maxTokens);
+        size_t split(const char* str, size_t len, char delimiter, Token* tokens, size_t maxTokens);
+
+        // ---------------------------------------------------------
+        // [findAnyOf] 문자 집합 중 하나가 처음 나타나는 위치를 찾습니다.
+        // 길이 기반으로 동작하며(NUL 무시), SIMD 비교+movemask로 16바이트씩 검사합니다.
+        //
+        // Usage: const char* p = cms::string::findAnyOf(buf, len, ",;\"", 3);
+        //
+        // @param str 검색 대상 (NUL 종료 불필요)
+        // @param len 검색할 바이트 길이
+        // @param set 찾을 문자 집합
+        // @param setLen 문자 집합의 크기
+        // @return 처음 발견된 위치의 포인터 (찾지 못하면 nullptr)
+        // ---------------------------------------------------------
+        const char* findAnyOf(const char* str, size_t len, const char* set, size_t setLen);
+
+        // ---------------------------------------------------------
+        // [findBytes] 부분 문자열이 처음 나타나는 위치를 바이트 단위로 찾습니다.
+        // 대상과 패턴 모두 NUL 종료가 필요 없으며, 지정한 길이 밖은 읽지 않습니다.
+        //
+        // Usage: const char* p = cms::string::findBytes(buf, len, "\r\n", 2, false);
+        //
+        // @param str 검색 대상 (NUL 종료 불필요)
+        // @param strLen 검색할 바이트 길이
+        // @param target 찾을 패턴 (NUL 종료 불필요)
+        // @param targetLen 패턴 바이트 길이 (0이면 str 반환)
+        // @param ignoreCase true일 경우 대소문자 무시
+        // @return 처음 발견된 위치의 포인터 (찾지 못하면 nullptr)
+        // ---------------------------------------------------------
+        const char* findBytes(const char* str, size_t strLen, const char* target, size_t targetLen, bool ignoreCase = false);
+
+        // ---------------------------------------------------------
+        // [findLastBytes] 부분 문자열이 마지막으로 나타나는 위치를 바이트 단위로 찾습니다.
+        //
+        // @return 마지막 발견 위치의 포인터 (찾지 못하면 nullptr, targetLen이 0이면 str + strLen)
+        // ---------------------------------------------------------
+        const char* findLastBytes(const char* str, size_t strLen, const char* target, size_t targetLen, bool ignoreCase = false);
 
         // ---------------------------------------------------------
         // [contains] 문자열 내에 특정 부분 문자열이 포함되어 있는지 확인합니다.
@@ -376,6 +496,7 @@ namespace cms {
         // @param str 변환할 대상 문자열 (In-place 수정)
         // ---------------------------------------------------------
         void toUpperCase(char* str);
+        void toUpperCase(char* str, size_t len);
 
         // ---------------------------------------------------------
         // [toLowerCase] 영문 대문자를 소문자로 변환합니다.
@@ -385,6 +506,7 @@ namespace cms {
         // @param str 변환할 대상 문자열 (In-place 수정)
         // ---------------------------------------------------------
         void toLowerCase(char* str);
+        void toLowerCase(char* str, size_t len);
 
         // ---------------------------------------------------------
         // [endsWith] 문자열이 특정 접미사로 끝나는지 확인합니다.
@@ -410,9 +532,12 @@ namespace cms {
         // @param from 찾을 패턴
         // @param to 바꿀 내용
         // @param ignoreCase true일 경우 대소문자 무시
+        // @param dropped [OUT, 선택] 공간이 부족해 치환을 멈춘 경우, 남은 일치를 모두 치환했을 때 넘치는 바이트 수
         // @return 치환 완료 후의 새로운 문자열 바이트 길이
         // ---------------------------------------------------------
         size_t replace(char* str, size_t maxLen, size_t curLen, const char* from, const char* to, bool ignoreCase = false);
+        size_t replace(char* str, size_t maxLen, size_t curLen, const char* from, size_t fromLen,
+                       const char* to, size_t toLen, bool ignoreCase, size_t* dropped = nullptr);
 
         // ---------------------------------------------------------
         // [matches] 정규식 패턴과의 일치 여부를 확인합니다.
@@ -420,10 +545,12 @@ namespace cms {
         // Usage: if (cms::string::matches(s, "^[0-9]+$")) { ... }
         //
         // @param str 검사 대상 문자열
+        // @param len [선택] str의 바이트 길이 (REG_STARTEND를 지원하면 NUL까지 훑지 않고 이 구간만 검사)
         // @param pattern 정규표현식 패턴 (예: "^[0-9]+$")
         // @return true: 매칭 성공, false: 매칭 실패 또는 패턴 문법 오류
         // ---------------------------------------------------------
         bool matches(const char* str, const char* pattern);
+        bool matches(const char* str, size_t len, const char* pattern);
 
         // ---------------------------------------------------------
         // [validateUtf8] 문자열이 UTF-8 규칙을 만족하는지 검사합니다.
@@ -434,6 +561,7 @@ namespace cms {
         // @return true: 유효한 UTF-8, false: 인코딩 오류(깨진 글자) 발견
         // ---------------------------------------------------------
         bool validateUtf8(const char* str);
+        bool validateUtf8(const char* str, size_t len);
 
         // ---------------------------------------------------------
         // [sanitizeUtf8] 깨진 UTF-8 바이트를 대체 문자로 치환합니다.
@@ -442,9 +570,11 @@ namespace cms {
         //
         // @param str 정제할 문자열 (In-place 수정)
         // @param maxLen 버퍼 최대 크기
+        // @param curLen [선택] 현재 바이트 길이 (주면 NUL을 찾지 않고 이 길이까지만 읽음)
         // @return 정제 후의 최종 문자열 바이트 길이
         // ---------------------------------------------------------
         size_t sanitizeUtf8(char* str, size_t maxLen);
+        size_t sanitizeUtf8(char* str, size_t maxLen, size_t curLen);
 
         // ---------------------------------------------------------
         // [appendPrintf] 초경량 포맷팅 엔진입니다.
@@ -456,7 +586,7 @@ namespace cms {
         // @param curLen 현재 문자열 길이 (참조로 전달되어 업데이트됨)
         // @param format 포맷 문자열
         // @param args 가변 인자 리스트 (va_list)
-        // @return 포맷팅 완료 후 최종 문자열의 전체 바이트 길이
+        // @return 공간이 충분했다면 됐을 최종 바이트 길이 (snprintf와 같이, 갱신된 curLen보다 크면 그 차이만큼 잘림)
         // ---------------------------------------------------------
         int appendPrintf(char* buffer, size_t maxLen, size_t& curLen, const char* format, va_list args);
 
@@ -470,8 +600,9 @@ namespace cms {
         // @param curLen 현재 문자열 길이 (함수 실행 후 증가된 길이로 업데이트됨)
         // @param src 추가할 데이터 소스
         // @param srcLen 추가할 데이터의 바이트 길이
+        // @return 공간이 부족해 버려진 바이트 수 (0이면 전부 기록)
         // ---------------------------------------------------------
-        void append(char* buffer, size_t maxLen, size_t& curLen, const char* src, size_t srcLen) noexcept;
+        size_t append(char* buffer, size_t maxLen, size_t& curLen, const char* src, size_t srcLen) noexcept;
 
         // ---------------------------------------------------------
         // [appendInt] 정수값을 문자열로 변환하여 버퍼 끝에 추가합니다.
@@ -481,11 +612,139 @@ namespace cms {
         // @param buffer 대상 버퍼
         // @param maxLen 버퍼 최대 크기
         // @param curLen 현재 길이 (업데이트됨)
-        // @param val 변환할 정수값 (long 타입)
-        // @param width 최소 출력 너비 (0일 경우 가변 길이)
+        // @param val 변환할 정수값 (int64_t 전체 범위)
+        // @param width 최소 출력 너비 (부호 포함, 0일 경우 가변 길이)
         // @param padChar 채움 문자 (예: '0', ' ')
+        // @return 버려진 바이트 수 (숫자가 통째로 들어가지 않으면 출력 전체 길이, 기록했으면 0)
+        //
+        // @note 모든 정수 타입에 대한 오버로드를 제공하여 int/long/long long 간의 모호성을 없앱니다.
+        // ---------------------------------------------------------
+        size_t appendInt(char* buffer, size_t maxLen, size_t& curLen, long long val, int width = 0, char padChar = ' ');
+        inline size_t appendInt(char* buffer, size_t maxLen, size_t& curLen, int val, int width = 0, char padChar = ' ') {
+            return appendInt(buffer, maxLen, curLen, (long long)val, width, padChar);
+        }
+        inline size_t appendInt(char* buffer, size_t maxLen, size_t& curLen, long val, int width = 0, char padChar = ' ') {
+            return appendInt(buffer, maxLen, curLen, (long long)val, width, padChar);
+        }
+
+        // ---------------------------------------------------------
+        // [appendUInt] 부호 없는 정수값을 문자열로 변환하여 버퍼 끝에 추가합니다.
+        //
+        // Usage: cms::string::appendUInt(buf, maxLen, len, micros64);
+        //
+        // @param val 변환할 값 (uint64_t 전체 범위, 최대 20자리)
+        // @param width 최소 출력 너비
+        // @param padChar 채움 문자
+        // @return 버려진 바이트 수 (appendInt와 같음)
+        // ---------------------------------------------------------
+        size_t appendUInt(char* buffer, size_t maxLen, size_t& curLen, unsigned long long val, int width = 0, char padChar = ' ');
+        inline size_t appendUInt(char* buffer, size_t maxLen, size_t& curLen, unsigned int val, int width = 0, char padChar = ' ') {
+            return appendUInt(buffer, maxLen, curLen, (unsigned long long)val, width, padChar);
+        }
+        inline size_t appendUInt(char* buffer, size_t maxLen, size_t& curLen, unsigned long val, int width = 0, char padChar = ' ') {
+            return appendUInt(buffer, maxLen, curLen, (unsigned long long)val, width, padChar);
+        }
+
+        // 부호 없는 값을 appendInt로 넘겨도 모호하지 않도록 appendUInt로 연결합니다.
+        inline size_t appendInt(char* buffer, size_t maxLen, size_t& curLen, unsigned int val, int width = 0, char padChar = ' ') {
+            return appendUInt(buffer, maxLen, curLen, (unsigned long long)val, width, padChar);
+        }
+        inline size_t appendInt(char* buffer, size_t maxLen, size_t& curLen, unsigned long val, int width = 0, char padChar = ' ') {
+            return appendUInt(buffer, maxLen, curLen, (unsigned long long)val, width, padChar);
+        }
+        inline size_t appendInt(char* buffer, size_t maxLen, size_t& curLen, unsigned long long val, int width = 0, char padChar = ' ') {
+            return appendUInt(buffer, maxLen, curLen, val, width, padChar);
+        }
+
+        // ---------------------------------------------------------
+        // [appendHex] 부호 없는 정수값을 16진수 문자열로 변환하여 버퍼 끝에 추가합니다.
+        //
+        // Usage: cms::string::appendHex(buf, maxLen, len, 0xBEEFu, 8, '0', true); // "0000BEEF"
+        //
+        // @param val 변환할 값 (uint64_t 전체 범위, 접두사 "0x"는 붙이지 않음)
+        // @param width 최소 출력 너비
+        // @param padChar 채움 문자
+        // @param uppercase true일 경우 A-F 대문자 사용
+        // @return 버려진 바이트 수 (appendInt와 같음)
+        // ---------------------------------------------------------
+        size_t appendHex(char* buffer, size_t maxLen, size_t& curLen, unsigned long long val, int width = 0, char padChar = ' ', bool uppercase = false);
+
+        // ---------------------------------------------------------
+        // [appendHexBytes] 바이트 배열을 16진수 덤프로 변환하여 버퍼 끝에 추가합니다.
+        //
+        // Usage: cms::string::appendHexBytes(buf, maxLen, len, packet, 4, ' '); // "DE AD BE EF"
+        //
+        // @param data 원본 바이트
+        // @param len 원본 바이트 수
+        // @param separator 바이트 사이 구분 문자 ('\0'이면 구분 없음)
+        // @param uppercase true일 경우 A-F 대문자 사용
+        // @return 기록한 원본 바이트 수 (공간이 부족하면 바이트 단위로 잘림)
         // ---------------------------------------------------------
-        void appendInt(char* buffer, size_t maxLen, size_t& curLen, long val, int width = 0, char padChar = ' ');
+        size_t appendHexBytes(char* buffer, size_t maxLen, size_t& curLen, const void* data, size_t len, char separator = '\0', bool uppercase = true);
+
+        // ---------------------------------------------------------
+        // [appendBase64] 바이트 배열을 Base64(RFC 4648)로 인코딩하여 버퍼 끝에 추가합니다.
+        //
+        // Usage: size_t done = cms::string::appendBase64(buf, maxLen, len, payload, n);
+        //
+        // @param urlSafe true이면 '-', '_' 문자를 사용하고 '=' 패딩을 생략합니다. (JWT 등)
+        // @return 인코딩한 원본 바이트 수 (len보다 작으면 잘림, 3바이트 그룹 경계에서 멈추므로 이어서 인코딩 가능)
+        // ---------------------------------------------------------
+        size_t appendBase64(char* buffer, size_t maxLen, size_t& curLen, const void* data, size_t len, bool urlSafe = false);
+
+        // ---------------------------------------------------------
+        // [appendBase32] 바이트 배열을 Base32(RFC 4648, '=' 패딩)로 인코딩하여 버퍼 끝에 추가합니다.
+        //
+        // @return 인코딩한 원본 바이트 수 (len보다 작으면 잘림, 5바이트 그룹 경계에서 멈춤)
+        // ---------------------------------------------------------
+        size_t appendBase32(char* buffer, size_t maxLen, size_t& curLen, const void* data, size_t len);
+
+        // ---------------------------------------------------------
+        // [decodeHexTo] 16진수 문자열을 바이트 배열로 디코딩합니다.
+        //
+        // 대소문자를 모두 허용하며, 바이트 쌍 사이의 공백("DE AD BE EF")은 건너뜁니다.
+        //
+        // Usage: size_t n; auto r = cms::string::decodeHexTo(s, s + len, out, sizeof(out), n);
+        //
+        // @param dest 결과 버퍼
+        // @param destCap 결과 버퍼 크기
+        // @param written [OUT] 기록한 바이트 수
+        // @return Ok, Invalid(ptr: 잘못된 문자), OutOfRange(ptr: 결과 버퍼가 부족해 기록하지 못한 첫 위치)
+        // ---------------------------------------------------------
+        ParseResult decodeHexTo(const char* first, const char* last, void* dest, size_t destCap, size_t& written);
+
+        // ---------------------------------------------------------
+        // [decodeBase64To] Base64 문자열을 바이트 배열로 디코딩합니다.
+        //
+        // 표준/URL-safe 문자를 모두 허용하고 공백과 줄바꿈은 건너뛰며, '=' 패딩은 선택 사항입니다.
+        //
+        // @param written [OUT] 기록한 바이트 수
+        // @return Ok, Invalid(ptr: 잘못된 문자), OutOfRange(ptr: 기록하지 못한 첫 그룹)
+        // ---------------------------------------------------------
+        ParseResult decodeBase64To(const char* first, const char* last, void* dest, size_t destCap, size_t& written);
+
+        // ---------------------------------------------------------
+        // [decodeBase32To] Base32 문자열을 바이트 배열로 디코딩합니다. (대소문자 무시, 패딩 선택)
+        //
+        // @param written [OUT] 기록한 바이트 수
+        // @return Ok, Invalid(ptr: 잘못된 문자), OutOfRange(ptr: 기록하지 못한 첫 그룹)
+        // ---------------------------------------------------------
+        ParseResult decodeBase32To(const char* first, const char* last, void* dest, size_t destCap, size_t& written);
+
+        // ---------------------------------------------------------
+        // [FloatFormat] appendFloat의 출력 형식입니다.
+        //
+        // - Fixed    : 소수점 고정 표기 (printf %f)
+        // - Exponent : 지수 표기 (printf %e, 예: 1.500000e+03)
+        // - General  : 유효숫자 기준 고정/지수 자동 선택, 끝자리 0 제거 (printf %g)
+        // - Shortest : 다시 읽었을 때 같은 값이 되는 짧은 표기 (Grisu2, 최단은 보장하지 않음. JSON 텔레메트리용)
+        // ---------------------------------------------------------
+        enum class FloatFormat : uint8_t {
+            Fixed,
+            Exponent,
+            General,
+            Shortest
+        };
 
         // ---------------------------------------------------------
         // [appendFloat] 실수값을 문자열로 변환하여 버퍼 끝에 추가합니다.
@@ -497,9 +756,181 @@ namespace cms {
         // @param curLen 현재 길이 (업데이트됨)
         // @param val 변환할 실수값 (float 타입)
         // @param decimalPlaces 소수점 이하 출력 자리수
+        //
+        // @return 버려진 바이트 수 (숫자가 통째로 들어가지 않으면 출력 전체 길이, 기록했으면 0)
+        //
+        // @note 공간이 부족하면 아무것도 기록하지 않습니다. (잘린 숫자를 남기지 않음)
         // ---------------------------------------------------------
-        void appendFloat(char* buffer, size_t maxLen, size_t& curLen, double val, int decimalPlaces = 2);
+        size_t appendFloat(char* buffer, size_t maxLen, size_t& curLen, double val, int decimalPlaces = 2);
+
+        // ---------------------------------------------------------
+        // [appendFloat] 실수값을 지정한 형식으로 변환하여 버퍼 끝에 추가합니다.
+        //
+        // Fixed/Exponent/General은 값을 정확히 전개해 한 번만 반올림하므로 printf와 같은 결과를 냅니다. (정확히 절반이면 짝수 쪽)
+        // Shortest는 Grisu2 정수 연산으로 왕복 가능한 자릿수를 만들며, float 버전은 float 정밀도 기준입니다. (3.14f -> "3.14")
+        //
+        // Usage: cms::string::appendFloat(buf, maxLen, len, 0.1, cms::string::FloatFormat::Shortest);
+        //
+        // @param format 출력 형식
+        // @param precision 정밀도 (-1이면 6, Shortest에서는 무시)
+        // @param uppercase 지수/특수값을 대문자(E, INF, NAN)로 출력할지 여부
+        // @param width 최소 출력 너비 (printf %8.3f의 8)
+        // @param padChar 채움 문자 ('0'이면 부호 뒤에 채움)
+        // @return 버려진 바이트 수 (위와 같음)
+        // ---------------------------------------------------------
+        size_t appendFloat(char* buffer, size_t maxLen, size_t& curLen, double val, FloatFormat format, int precision = -1, bool uppercase = false,
+                           int width = 0, char padChar = ' ');
+        size_t appendFloat(char* buffer, size_t maxLen, size_t& curLen, float val, FloatFormat format, int precision = -1, bool uppercase = false,
+                           int width = 0, char padChar = ' ');
+
+        // ---------------------------------------------------------
+        // [Hash] 비암호화 문자열 해시 (해시 테이블, 문자열 switch, 태그 색상용)
+        //
+        // 모든 알고리즘은 constexpr이라 컴파일 타임 리터럴과 런타임 값이 같은 결과를 냅니다.
+        // ignoreCase는 ASCII 소문자를 대문자로 접어서 계산합니다. ("WiFi" == "WIFI")
+        // 결과는 플랫폼마다 기본 알고리즘이 다를 수 있으므로 저장/전송용 식별자에는 알고리즘을 명시하세요.
+        //
+        // Usage:
+        //   switch (cms::string::hash(tok.ptr, tok.len)) {
+        //       case cms::string::hash("GET", 3): ...
+        //   }
+        // ---------------------------------------------------------
+        enum class HashAlgorithm : uint8_t {
+            Fnv1a,  // 바이트당 XOR + 곱셈 1회. 32비트 MCU 기본값
+            Djb2,   // 바이트당 시프트 + 덧셈. 곱셈기가 느린 코어용 (로거 태그 색상)
+            WyHash  // 8바이트 단위 64x64->128 곱셈 혼합. 64비트 호스트 기본값
+        };
+
+        namespace detail {
+            // ignoreCase 시 대문자로 접은 바이트
+            constexpr uint8_t hashByte(const char* s, size_t i, bool ignoreCase) noexcept {
+                const uint8_t c = (uint8_t)s[i];
+                return (ignoreCase && c >= 'a' && c <= 'z') ? (uint8_t)(c - ('a' - 'A')) : c;
+            }
+            // n(<=8)바이트를 리틀 엔디언 정수로 읽기 (컴파일러가 단일 로드로 합칩니다)
+            constexpr uint64_t hashRead(const char* s, size_t n, bool ignoreCase) noexcept {
+                uint64_t v = 0;
+                for (size_t i = 0; i < n; ++i) v |= (uint64_t)hashByte(s, i, ignoreCase) << (8 * i);
+                return v;
+            }
+            // 64x64 -> 128비트 곱셈 후 상/하위 64비트를 돌려줍니다.
+            constexpr void hashMum(uint64_t& a, uint64_t& b) noexcept {
+#ifdef __SIZEOF_INT128__
+                const unsigned __int128 r = (unsigned __int128)a * b;
+                a = (uint64_t)r;
+                b = (uint64_t)(r >> 64);
+#else
+                const uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+                const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+                const uint64_t t = rl + (rm0 << 32);
+                uint64_t carry = t < rl;
+                const uint64_t lo = t + (rm1 << 32);
+                carry += lo < t;
+                a = lo;
+                b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+            }
+            constexpr uint64_t hashMix(uint64_t a, uint64_t b) noexcept {
+                hashMum(a, b);
+                return a ^ b;
+            }
+        } // namespace detail
+
+        // [fnv1a] FNV-1a 32비트
+        constexpr uint32_t fnv1a(const char* s, size_t len, bool ignoreCase = false) noexcept {
+            uint32_t h = 2166136261u;
+            for (size_t i = 0; i < len; ++i) {
+                h ^= detail::hashByte(s, i, ignoreCase);
+                h *= 16777619u;
+            }
+            return h;
+        }
+
+        // [djb2] DJB2 (hash * 33 + c, 초기값 5381)
+        constexpr uint32_t djb2(const char* s, size_t len, bool ignoreCase = false) noexcept {
+            uint32_t h = 5381;
+            for (size_t i = 0; i < len; ++i) h = ((h << 5) + h) + detail::hashByte(s, i, ignoreCase);
+            return h;
+        }
+
+        // [wyhash] wyhash(v4) 구조를 따르는 64비트 혼합 해시의 32비트 축약값
+        //
+        // 16바이트 이하는 겹쳐 읽기 두 번으로 끝나고, 그 이상은 16/48바이트 단위로 혼합합니다.
+        // 64비트 곱셈이 하드웨어로 지원되지 않는 코어에서는 fnv1a보다 느립니다.
+        constexpr uint32_t wyhash(const char* s, size_t len, bool ignoreCase = false, uint64_t seed = 0) noexcept {
+            constexpr uint64_t P0 = 0xa0761d6478bd642full, P1 = 0xe7037ed1a0b428dbull;
+            constexpr uint64_t P2 = 0x8ebc6af09c88c6e3ull, P3 = 0x589965cc75374cc3ull;
+            seed ^= detail::hashMix(seed ^ P0, P1);
+            uint64_t a = 0, b = 0;
+            if (len <= 16) {
+                if (len >= 4) {
+                    const size_t q = (len >> 3) << 2;
+                    a = (detail::hashRead(s, 4, ignoreCase) << 32) | detail::hashRead(s + q, 4, ignoreCase);
+                    b = (detail::hashRead(s + len - 4, 4, ignoreCase) << 32) | detail::hashRead(s + len - 4 - q, 4, ignoreCase);
+                } else if (len > 0) {
+                    a = ((uint64_t)detail::hashByte(s, 0, ignoreCase) << 16) | ((uint64_t)detail::hashByte(s, len >> 1, ignoreCase) << 8) |
+                        detail::hashByte(s, len - 1, ignoreCase);
+                }
+            } else {
+                const char* p = s;
+                size_t i = len;
+                if (i > 48) {
+                    uint64_t see1 = seed, see2 = seed;
+                    do {
+                        seed = detail::hashMix(detail::hashRead(p, 8, ignoreCase) ^ P1, detail::hashRead(p + 8, 8, ignoreCase) ^ seed);
+                        see1 = detail::hashMix(detail::hashRead(p + 16, 8, ignoreCase) ^ P2, detail::hashRead(p + 24, 8, ignoreCase) ^ see1);
+                        see2 = detail::hashMix(detail::hashRead(p + 32, 8, ignoreCase) ^ P3, detail::hashRead(p + 40, 8, ignoreCase) ^ see2);
+                        p += 48;
+                        i -= 48;
+                    } while (i > 48);
+                    seed ^= see1 ^ see2;
+                }
+                while (i > 16) {
+                    seed = detail::hashMix(detail::hashRead(p, 8, ignoreCase) ^ P1, detail::hashRead(p + 8, 8, ignoreCase) ^ seed);
+                    p += 16;
+                    i -= 16;
+                }
+                a = detail::hashRead(p + i - 16, 8, ignoreCase);
+                b = detail::hashRead(p + i - 8, 8, ignoreCase);
+            }
+            a ^= P1;
+            b ^= seed;
+            detail::hashMum(a, b);
+            const uint64_t h = detail::hashMix(a ^ P0 ^ len, b ^ P1);
+            return (uint32_t)(h ^ (h >> 32));
+        }
+
+        // [hash] 알고리즘을 지정하여 해시를 계산합니다.
+        constexpr uint32_t hash(const char* s, size_t len, HashAlgorithm algo, bool ignoreCase = false) noexcept {
+            return algo == HashAlgorithm::WyHash ? wyhash(s, len, ignoreCase)
+                 : algo == HashAlgorithm::Djb2   ? djb2(s, len, ignoreCase)
+                                                 : fnv1a(s, len, ignoreCase);
+        }
+
+// 기본 알고리즘: 64비트 호스트는 WyHash, 그 외(ESP32/STM32/AVR)는 곱셈 1회짜리 Fnv1a
+// 프로젝트 전체에서 바꾸려면 빌드 플래그로 지정합니다. (-DCMS_HASH_DEFAULT=cms::string::HashAlgorithm::Djb2)
+#ifndef CMS_HASH_DEFAULT
+#if UINTPTR_MAX > 0xFFFFFFFFu
+#define CMS_HASH_DEFAULT cms::string::HashAlgorithm::WyHash
+#else
+#define CMS_HASH_DEFAULT cms::string::HashAlgorithm::Fnv1a
+#endif
+#endif
+
+        // [hash] 기본 알고리즘(CMS_HASH_DEFAULT)으로 해시를 계산합니다.
+        constexpr uint32_t hash(const char* s, size_t len, bool ignoreCase = false) noexcept {
+            return hash(s, len, CMS_HASH_DEFAULT, ignoreCase);
+        }
+
+        inline uint32_t Token::hash(bool ignoreCase) const noexcept { return cms::string::hash(ptr, len, ignoreCase); }
     } // string
+
+    namespace literals {
+        // [_hash] 문자열 리터럴의 기본 알고리즘 해시 (switch case 라벨용)
+        //
+        // Usage: using namespace cms::literals; case "GET"_hash: ...
+        constexpr uint32_t operator""_hash(const char* s, size_t len) noexcept { return cms::string::hash(s, len); }
+    } // literals
 } // namespace cms
 
 // =========================================================
@@ -0,0 +1,205 @@
+/// @author comser.dev
+///
+/// NUL 종료 없이 (포인터, 길이)만으로 문자열 구간을 다루는 비소유(Non-owning) 뷰 정의서입니다.
+/// 길이를 이미 알고 있는 호출자가 StringBase/cms::string API를 strlen 없이 사용할 수 있도록 합니다.
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <cstring>  // strlen, memchr
+#include "cmsStringUtil.h"
+
+namespace cms {
+
+// ==================================================================================================
+// [StringView] 개요
+// - 왜 존재하는가: Token은 (ptr, len)만 담는 최소 구조체라 부분 구간/검색/공백 제거를 하려면 매번 커널을 직접 호출해야 했고,
+//                  StringBase의 대부분 API는 const char*를 받아 내부에서 strlen을 다시 수행했습니다.
+// - 어떻게 동작하는가: 원본을 가리키는 포인터와 길이만 복사하며, 모든 연산은 길이 기반 cms::string 커널(findBytes, equals, compare)에 위임합니다.
+// ==================================================================================================
+
+    /// 원본 메모리를 소유하지 않는 읽기 전용 문자열 구간입니다.
+    ///
+    /// Why: 수신 버퍼의 일부, Token, 다른 String의 구간을 복사 없이 검색/비교/대입 인자로 넘기기 위함입니다.
+    /// How: 값 타입(포인터 + 길이)으로 전달되며, substr/trim은 새 뷰를 반환할 뿐 원본을 수정하지 않습니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// cms::StringView line(rx, rxLen);              // NUL 종료 불필요
+    /// cms::StringView key = line.substr(0, line.find('=')).trim();
+    /// if (key.equals("mode", true)) cfg = line.substr(line.find('=') + 1);
+    /// @endcode
+    ///
+    /// @note 원본 버퍼가 살아있는 동안만 유효합니다. 바이트 단위 인덱스를 사용합니다. (글자 단위는 StringBase::find)
+    class StringView {
+    public:
+        /// 찾지 못함 또는 "끝까지"를 나타내는 값입니다.
+        static constexpr size_t npos = (size_t)-1;
+
+        /// 빈 뷰를 생성합니다.
+        constexpr StringView() noexcept : _ptr(""), _len(0) {}
+        /// (포인터, 길이)로 뷰를 생성합니다. (NUL 종료 불필요)
+        constexpr StringView(const char* ptr, size_t len) noexcept : _ptr(ptr ? ptr : ""), _len(ptr ? len : 0) {}
+        /// NUL 종료 문자열로 뷰를 생성합니다. (생성 시 한 번만 strlen 수행, nullptr은 빈 뷰)
+        /// 리터럴은 컴파일 타임에 길이가 계산되므로 constexpr 테이블(StringTable)의 키로 쓸 수 있습니다.
+        constexpr StringView(const char* str) noexcept : _ptr(str ? str : ""), _len(str ? lengthOf(str) : 0) {}
+        /// split/Tokenizer 결과 Token으로 뷰를 생성합니다.
+        constexpr StringView(const cms::string::Token& token) noexcept : _ptr(token.ptr ? token.ptr : ""), _len(token.ptr ? token.len : 0) {}
+
+        /// 구간 시작 포인터를 반환합니다. (NUL 종료를 보장하지 않음)
+        constexpr const char* data() const noexcept { return _ptr; }
+        /// 바이트 길이를 반환합니다.
+        constexpr size_t size() const noexcept { return _len; }
+        /// 바이트 길이를 반환합니다.
+        constexpr size_t length() const noexcept { return _len; }
+        /// 비어있는지 확인합니다.
+        constexpr bool isEmpty() const noexcept { return _len == 0; }
+        /// 특정 바이트에 접근합니다. (범위 검사 없음)
+        constexpr char operator[](size_t index) const noexcept { return _ptr[index]; }
+        /// 범위 기반 for 문용 반복자입니다.
+        constexpr const char* begin() const noexcept { return _ptr; }
+        constexpr const char* end() const noexcept { return _ptr + _len; }
+
+        /// Token으로 변환합니다. (Tokenizer, CsvParser 등 Token 기반 API 연동용)
+        constexpr cms::string::Token toToken() const noexcept { return cms::string::Token{_ptr, _len}; }
+
+        /// [substr] 바이트 구간을 잘라낸 새 뷰를 반환합니다.
+        ///
+        /// @param pos 시작 바이트 위치 (length()보다 크면 빈 뷰)
+        /// @param count 최대 바이트 수 (npos면 끝까지)
+        constexpr StringView substr(size_t pos, size_t count = npos) const noexcept {
+            if (pos > _len) pos = _len;
+            const size_t rest = _len - pos;
+            return StringView(_ptr + pos, count < rest ? count : rest);
+        }
+
+        /// 앞쪽 n바이트를 제외한 뷰를 반환합니다.
+        constexpr StringView dropFront(size_t n) const noexcept { return substr(n); }
+        /// 뒤쪽 n바이트를 제외한 뷰를 반환합니다.
+        constexpr StringView dropBack(size_t n) const noexcept { return StringView(_ptr, n < _len ? _len - n : 0); }
+
+        /// [trim] 양 끝의 공백(Space, \t, \r, \n 등)을 제외한 뷰를 반환합니다. (원본 수정 없음)
+        StringView trim() const noexcept { return trimLeft().trimRight(); }
+        /// 앞쪽 공백을 제외한 뷰를 반환합니다.
+        StringView trimLeft() const noexcept {
+            size_t i = 0;
+            while (i < _len && cms::string::isSpace((unsigned char)_ptr[i])) i++;
+            return StringView(_ptr + i, _len - i);
+        }
+        /// 뒤쪽 공백을 제외한 뷰를 반환합니다.
+        StringView trimRight() const noexcept {
+            size_t n = _len;
+            while (n > 0 && cms::string::isSpace((unsigned char)_ptr[n - 1])) n--;
+            return StringView(_ptr, n);
+        }
+
+        /// [find] 문자가 처음 나타나는 바이트 위치를 찾습니다.
+        /// @return 바이트 인덱스 (찾지 못하면 npos)
+        size_t find(char c, size_t pos = 0) const noexcept {
+            if (pos >= _len) return npos;
+            const char* p = static_cast<const char*>(memchr(_ptr + pos, c, _len - pos));
+            return p ? (size_t)(p - _ptr) : npos;
+        }
+
+        /// [find] 부분 문자열이 처음 나타나는 바이트 위치를 찾습니다.
+        ///
+        /// @param target 찾을 문자열 (NUL 종료 불필요)
+        /// @param pos 검색 시작 바이트 위치
+        /// @param ignoreCase 대소문자 무시 여부
+        /// @return 바이트 인덱스 (찾지 못하면 npos)
+        size_t find(StringView target, size_t pos = 0, bool ignoreCase = false) const noexcept {
+            if (pos > _len) return npos;
+            const char* p = cms::string::findBytes(_ptr + pos, _len - pos, target._ptr, target._len, ignoreCase);
+            return p ? (size_t)(p - _ptr) : npos;
+        }
+
+        /// [rfind] 문자가 마지막으로 나타나는 바이트 위치를 찾습니다.
+        size_t rfind(char c) const noexcept {
+            for (size_t i = _len; i-- > 0;) {
+                if (_ptr[i] == c) return i;
+            }
+            return npos;
+        }
+
+        /// [rfind] 부분 문자열이 마지막으로 나타나는 바이트 위치를 찾습니다.
+        size_t rfind(StringView target, bool ignoreCase = false) const noexcept {
+            const char* p = cms::string::findLastBytes(_ptr, _len, target._ptr, target._len, ignoreCase);
+            return p ? (size_t)(p - _ptr) : npos;
+        }
+
+        /// [findAnyOf] 문자 집합 중 하나가 처음 나타나는 바이트 위치를 찾습니다. (SIMD)
+        size_t findAnyOf(StringView set, size_t pos = 0) const noexcept {
+            if (pos >= _len) return npos;
+            const char* p = cms::string::findAnyOf(_ptr + pos, _len - pos, set._ptr, set._len);
+            return p ? (size_t)(p - _ptr) : npos;
+        }
+
+        /// 부분 문자열 포함 여부를 확인합니다.
+        bool contains(StringView target, bool ignoreCase = false) const noexcept {
+            return cms::string::findBytes(_ptr, _len, target._ptr, target._len, ignoreCase) != nullptr;
+        }
+        /// 문자 포함 여부를 확인합니다.
+        bool contains(char c) const noexcept { return find(c) != npos; }
+
+        /// 특정 접두사로 시작하는지 확인합니다.
+        bool startsWith(StringView prefix, bool ignoreCase = false) const noexcept {
+            return prefix._len <= _len && cms::string::equals(_ptr, prefix._len, prefix._ptr, prefix._len, ignoreCase);
+        }
+        /// 특정 문자로 시작하는지 확인합니다.
+        constexpr bool startsWith(char c) const noexcept { return _len > 0 && _ptr[0] == c; }
+
+        /// 특정 접미사로 끝나는지 확인합니다.
+        bool endsWith(StringView suffix, bool ignoreCase = false) const noexcept {
+            return cms::string::endsWith(_ptr, _len, suffix._ptr, suffix._len, ignoreCase);
+        }
+        /// 특정 문자로 끝나는지 확인합니다.
+        constexpr bool endsWith(char c) const noexcept { return _len > 0 && _ptr[_len - 1] == c; }
+
+        /// 내용 일치 여부를 확인합니다. (길이가 다르면 즉시 false)
+        bool equals(StringView other, bool ignoreCase = false) const noexcept {
+            return cms::string::equals(_ptr, _len, other._ptr, other._len, ignoreCase);
+        }
+        /// 사전식으로 비교합니다. (0: 일치, <0: 작음, >0: 큼)
+        int compare(StringView other) const noexcept {
+            return cms::string::compare(_ptr, _len, other._ptr, other._len);
+        }
+        /// 대소문자를 무시하고 사전식으로 비교합니다.
+        int compareIgnoreCase(StringView other) const noexcept {
+            return cms::string::compareIgnoreCase(_ptr, _len, other._ptr, other._len);
+        }
+
+        /// 기본 알고리즘(CMS_HASH_DEFAULT)으로 해시를 계산합니다. (constexpr: 리터럴 뷰는 컴파일 타임에 계산)
+        constexpr uint32_t hash(bool ignoreCase = false) const noexcept { return cms::string::hash(_ptr, _len, ignoreCase); }
+
+        /// 논리적 글자 수를 반환합니다. (UTF-8 인식)
+        size_t count() const noexcept { return cms::string::utf8_strlen(_ptr, _len); }
+        /// 내용을 정수(int)로 변환합니다. (실패 시 0)
+        int toInt() const { return cms::string::toInt(_ptr, _len); }
+        /// 내용을 실수(double)로 변환합니다. (실패 시 0.0)
+        double toFloat() const { return cms::string::toFloat(_ptr, _len); }
+
+        // 비교 연산자 (한쪽이 StringView이면 const char*/Token도 암시적으로 변환되어 비교됩니다)
+        friend bool operator==(StringView a, StringView b) noexcept { return a.equals(b); }
+        friend bool operator!=(StringView a, StringView b) noexcept { return !a.equals(b); }
+        friend bool operator<(StringView a, StringView b) noexcept { return a.compare(b) < 0; }
+        friend bool operator>(StringView a, StringView b) noexcept { return a.compare(b) > 0; }
+        friend bool operator<=(StringView a, StringView b) noexcept { return a.compare(b) <= 0; }
+        friend bool operator>=(StringView a, StringView b) noexcept { return a.compare(b) >= 0; }
+
+    private:
+        /// 상수 식에서도 평가되는 strlen입니다. (런타임에는 라이브러리 strlen 호출)
+        static constexpr size_t lengthOf(const char* s) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_strlen(s);
+#else
+            size_t n = 0;
+            while (s[n]) n++;
+            return n;
+#endif
+        }
+
+        const char* _ptr; ///< 구간 시작 (빈 뷰도 nullptr이 아닌 ""를 가리킴)
+        size_t _len;      ///< 바이트 길이
+    };
+
+} // namespace cms
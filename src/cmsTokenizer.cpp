@@ -0,0 +1,149 @@
+/// @author comser.dev
+///
+/// 길이 기반 지연(Lazy) 토크나이저 구현부입니다.
+/// 구분자 탐색은 cms::string::findAnyOf의 SIMD/SWAR 커널에 위임합니다.
+
+#include <cstring>          // strlen, memchr
+#include "cmsTokenizer.h"   // Tokenizer 정의
+
+namespace cms {
+    namespace string {
+
+        /// 길이를 알고 있는 입력으로 토크나이저를 생성합니다.
+        ///
+        /// Why: 이미 길이를 알고 있는 수신 버퍼에 대해 strlen 재스캔을 피하기 위함입니다.
+        /// How: 상태만 초기화하며 실제 분리는 next() 호출 시점에 수행합니다.
+        Tokenizer::Tokenizer(const char* str, size_t len, const char* delimiters)
+            : _str(str), _len(str ? len : 0), _pos(0),
+              _delims(delimiters ? delimiters : ""), _delimCount(delimiters ? strlen(delimiters) : 0),
+              _quote('\0'), _escape('\0'), _trim(false), _skipEmpty(false), _lastQuoted(false), _done(str == nullptr) {}
+
+        Tokenizer::Tokenizer(const char* str, const char* delimiters)
+            : Tokenizer(str, str ? strlen(str) : 0, delimiters) {}
+
+        Tokenizer::Tokenizer(const Token& src, const char* delimiters)
+            : Tokenizer(src.ptr, src.len, delimiters) {}
+
+        Tokenizer::Tokenizer(cms::StringView src, const char* delimiters)
+            : Tokenizer(src.data(), src.length(), delimiters) {}
+
+        /// 따옴표 필드 처리를 설정합니다.
+        void Tokenizer::setQuote(char quote, char escape) noexcept {
+            _quote = quote;
+            _escape = escape;
+        }
+
+        /// 처음 위치로 되돌립니다.
+        void Tokenizer::reset() noexcept {
+            _pos = 0;
+            _lastQuoted = false;
+            _done = (_str == nullptr);
+        }
+
+        /// 아직 처리하지 않은 나머지 구간을 반환합니다.
+        Token Tokenizer::rest() const noexcept {
+            if (_done) return Token{_str ? _str + _len : nullptr, 0};
+            return Token{_str + _pos, _len - _pos};
+        }
+
+        /// 다음 토큰을 추출합니다.
+        ///
+        /// @param out [OUT] 추출된 토큰
+        /// @return true: 토큰 추출 성공, false: 더 이상 토큰 없음
+        bool Tokenizer::next(Token& out) {
+            while (nextField(out)) {
+                if (!_skipEmpty || out.len > 0) return true;
+            }
+            return false;
+        }
+
+        /// 닫는 따옴표 위치를 찾습니다.
+        ///
+        /// How: 따옴표/이스케이프 문자만 집합으로 SIMD 검색하여 필드 본문을 건너뜁니다.
+        ///      이스케이프가 따옴표와 같으면 "" 쌍을, 다르면 escape+임의 문자를 건너뜁니다.
+        /// @return 닫는 따옴표 위치 (없으면 end)
+        const char* Tokenizer::findClosingQuote(const char* p, const char* end) const {
+            const char set[2] = {_quote, _escape};
+            const size_t setLen = (_escape && _escape != _quote) ? 2 : 1;
+
+            while (p < end) {
+                const char* q = findAnyOf(p, (size_t)(end - p), set, setLen);
+                if (!q) return end;
+                if (*q == _quote && (_escape != _quote || q + 1 >= end || q[1] != _quote)) {
+                    return q; // 닫는 따옴표
+                }
+                // 이스케이프 시퀀스 ("" 또는 \x): 두 바이트를 건너뜁니다.
+                p = q + 2;
+            }
+            return end;
+        }
+
+        /// 빈 토큰 여부와 무관하게 다음 필드 하나를 추출합니다.
+        bool Tokenizer::nextField(Token& out) {
+            if (_done) return false;
+
+            const char* p = _str + _pos;
+            const char* end = _str + _len;
+            _lastQuoted = false;
+
+            // 1. 선행 공백 제거
+            if (_trim) {
+                while (p < end && isSpace((unsigned char)*p) && !memchr(_delims, *p, _delimCount)) p++;
+            }
+
+            const char* delim;
+
+            if (_quote && p < end && *p == _quote) {
+                // 2-A. 따옴표 필드: 닫는 따옴표까지 본문으로 취급하고, 그 뒤 다음 구분자까지는 버립니다.
+                const char* body = p + 1;
+                const char* close = findClosingQuote(body, end);
+                out.ptr = body;
+                out.len = (size_t)(close - body);
+                _lastQuoted = true;
+                const char* after = (close < end) ? close + 1 : end;
+                delim = findAnyOf(after, (size_t)(end - after), _delims, _delimCount);
+            } else {
+                // 2-B. 일반 필드: 다음 구분자 직전까지가 본문입니다.
+                delim = findAnyOf(p, (size_t)(end - p), _delims, _delimCount);
+                const char* fieldEnd = delim ? delim : end;
+
+                // 후행 공백 제거
+                if (_trim) {
+                    while (fieldEnd > p && isSpace((unsigned char)fieldEnd[-1])) fieldEnd--;
+                }
+                out.ptr = p;
+                out.len = (size_t)(fieldEnd - p);
+            }
+
+            // 3. 위치 갱신: 구분자가 없으면 마지막 토큰입니다.
+            if (delim) {
+                _pos = (size_t)(delim - _str) + 1;
+            } else {
+                _pos = _len;
+                _done = true;
+            }
+            return true;
+        }
+
+        /// 따옴표 필드의 이스케이프 시퀀스를 해제하여 대상 버퍼에 복사합니다.
+        ///
+        /// @return 기록된 바이트 길이
+        size_t Tokenizer::unescape(const Token& token, char quote, char escape, char* dest, size_t destLen) {
+            if (!dest || destLen == 0) return 0;
+
+            size_t w = 0;
+            const char* p = token.ptr;
+            const char* end = token.ptr + token.len;
+            while (p < end && w < destLen - 1) {
+                char c = *p++;
+                if (escape && c == escape && p < end && (escape != quote || *p == quote)) {
+                    c = *p++; // 이스케이프된 문자 그대로 복사
+                }
+                dest[w++] = c;
+            }
+            dest[w] = '\0';
+            return w;
+        }
+
+    } // string
+} // namespace cms
@@ -0,0 +1,148 @@
+/// @author comser.dev
+///
+/// 길이 기반 지연(Lazy) 토크나이저 정의서입니다.
+/// 고정 크기 Token 배열 없이 구분자 집합, 따옴표 필드, 공백 정리를 지원하며
+/// 원본을 수정하지 않고 (포인터, 길이) 뷰만 반환합니다.
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include "cmsStringUtil.h"
+#include "cmsStringView.h"
+
+namespace cms {
+    namespace string {
+
+// ==================================================================================================
+// [Tokenizer] 개요
+// - 왜 존재하는가: CSV 텔레메트리나 AT 명령 응답을 maxTokens 배열 없이 고속으로 순회하기 위해 존재합니다.
+// - 어떻게 동작하는가: findAnyOf(SIMD 비교+movemask)로 다음 구분자/따옴표 위치를 찾아 next() 호출마다 Token 하나를 만듭니다.
+// ==================================================================================================
+
+        /// 구분자 집합과 따옴표 필드를 지원하는 비파괴적 토크나이저입니다.
+        ///
+        /// Why: split()은 단일 구분자와 고정 크기 결과 배열을 요구하므로 가변 필드 수의 입력에 부적합합니다.
+        /// How: 현재 위치만 기억하며, next() 호출 시 다음 토큰 하나만 계산하는 스트리밍 방식으로 동작합니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// cms::string::Tokenizer tk(line, len, ",;");
+        /// tk.setQuote('"', '"');
+        /// tk.setTrim(true);
+        /// cms::string::Token t;
+        /// while (tk.next(t)) { ... }
+        /// @endcode
+        ///
+        /// @note 반환된 Token은 원본 버퍼를 가리키므로 원본이 살아있는 동안만 유효합니다.
+        class Tokenizer {
+        public:
+            /// 길이를 알고 있는 입력으로 토크나이저를 생성합니다.
+            ///
+            /// @param str 분리할 원본 (NUL 종료 불필요)
+            /// @param len 원본 바이트 길이
+            /// @param delimiters 구분 문자 집합 (NUL 종료, 예: ",;")
+            Tokenizer(const char* str, size_t len, const char* delimiters = ",");
+
+            /// NUL 종료 문자열로 토크나이저를 생성합니다. (생성 시 한 번만 strlen 수행)
+            Tokenizer(const char* str, const char* delimiters = ",");
+
+            /// Token 뷰를 입력으로 토크나이저를 생성합니다.
+            Tokenizer(const Token& src, const char* delimiters = ",");
+
+            /// StringView를 입력으로 토크나이저를 생성합니다.
+            Tokenizer(cms::StringView src, const char* delimiters = ",");
+
+            /// 따옴표 필드 처리를 설정합니다.
+            ///
+            /// @param quote 따옴표 문자 ('\0'이면 비활성)
+            /// @param escape 이스케이프 문자 (quote와 같으면 CSV 방식 "" 이중 따옴표, '\\'면 백슬래시 방식)
+            void setQuote(char quote = '"', char escape = '"') noexcept;
+
+            /// 토큰 양 끝의 공백(Space, \t, \r, \n 등) 제거 여부를 설정합니다.
+            void setTrim(bool trim) noexcept { _trim = trim; }
+
+            /// 빈 토큰 건너뛰기 여부를 설정합니다. (연속 공백 구분자 처리 등에 사용)
+            void setSkipEmpty(bool skipEmpty) noexcept { _skipEmpty = skipEmpty; }
+
+            /// 다음 토큰을 추출합니다.
+            ///
+            /// How: 따옴표로 시작하는 필드는 닫는 따옴표까지를 하나의 토큰으로 보며(따옴표 제외),
+            ///      그 외에는 다음 구분자 직전까지를 토큰으로 만듭니다.
+            ///
+            /// @param out [OUT] 추출된 토큰
+            /// @return true: 토큰 추출 성공, false: 더 이상 토큰 없음
+            bool next(Token& out);
+
+            /// 남은 토큰이 있는지 확인합니다.
+            bool hasNext() const noexcept { return !_done; }
+
+            /// 직전에 반환한 토큰이 따옴표 필드였는지 확인합니다.
+            /// @note true이면 내용에 이스케이프 시퀀스가 남아 있을 수 있으므로 unescape()를 사용하세요.
+            bool lastQuoted() const noexcept { return _lastQuoted; }
+
+            /// 처음 위치로 되돌립니다.
+            void reset() noexcept;
+
+            /// 아직 처리하지 않은 나머지 구간을 반환합니다.
+            Token rest() const noexcept;
+
+            /// 따옴표 필드의 이스케이프 시퀀스를 해제하여 대상 버퍼에 복사합니다.
+            ///
+            /// @param token lastQuoted()가 true였던 토큰
+            /// @param quote 따옴표 문자
+            /// @param escape 이스케이프 문자
+            /// @param dest 결과 버퍼
+            /// @param destLen 결과 버퍼 크기 (널 종료 문자 포함)
+            /// @return 기록된 바이트 길이
+            static size_t unescape(const Token& token, char quote, char escape, char* dest, size_t destLen);
+
+            /// 범위 기반 for 문을 위한 입력 반복자입니다.
+            class Iterator {
+            public:
+                Iterator(Tokenizer* owner) : _owner(owner), _cur{nullptr, 0} { advance(); }
+                const Token& operator*() const { return _cur; }
+                Iterator& operator++() { advance(); return *this; }
+                bool operator!=(const Iterator& other) const { return _owner != other._owner; }
+            private:
+                void advance() { if (_owner && !_owner->next(_cur)) _owner = nullptr; }
+                Tokenizer* _owner;
+                Token _cur;
+            };
+
+            /// 현재 위치부터 순회하는 반복자를 반환합니다.
+            Iterator begin() { return Iterator(this); }
+            /// 종료 반복자를 반환합니다.
+            Iterator end() { return Iterator(nullptr); }
+
+        private:
+            /// 원본 문자열 시작 주소.
+            const char* _str;
+            /// 원본 바이트 길이.
+            size_t _len;
+            /// 다음 토큰이 시작될 오프셋.
+            size_t _pos;
+            /// 구분자 집합.
+            const char* _delims;
+            /// 구분자 집합 크기.
+            size_t _delimCount;
+            /// 따옴표 문자 ('\0'이면 비활성).
+            char _quote;
+            /// 이스케이프 문자.
+            char _escape;
+            /// 공백 제거 여부.
+            bool _trim;
+            /// 빈 토큰 건너뛰기 여부.
+            bool _skipEmpty;
+            /// 직전 토큰이 따옴표 필드였는지 여부.
+            bool _lastQuoted;
+            /// 마지막 토큰까지 반환했는지 여부.
+            bool _done;
+
+            /// 빈 토큰 여부와 무관하게 다음 필드 하나를 추출합니다.
+            bool nextField(Token& out);
+            /// 닫는 따옴표 위치를 찾습니다. (이스케이프 고려)
+            const char* findClosingQuote(const char* p, const char* end) const;
+        };
+
+    } // string
+} // namespace cms
@@ -0,0 +1,232 @@
+/// @author comser.dev
+///
+/// 스코프 트레이스의 스레드별 링 버퍼와 Chrome trace-event JSON 덤프 구현부입니다.
+
+#include "cmsTrace.h"
+#include <atomic>
+#include <cstdio>  // snprintf, FILE
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+namespace {
+    constexpr uint32_t RING_MASK = CMS_TRACE_RING_SIZE - 1;
+
+    struct Event {
+        const char* name; ///< 구간 이름 (리터럴)
+        uint64_t stamp;   ///< 사이클 카운터 값
+        char phase;       ///< 'B' 또는 'E'
+    };
+
+    /// 스레드 하나가 소유하는 링입니다. 소유 스레드만 쓰고, head는 덤프 스레드가 읽을 수 있도록 원자적으로 갱신합니다.
+    struct Ring {
+        Event events[CMS_TRACE_RING_SIZE];
+        std::atomic<uint32_t> head{0};
+    };
+
+    Ring g_rings[CMS_TRACE_MAX_THREADS];
+    std::atomic<uint32_t> g_ringCount{CMS_TRACE_MAX_THREADS == 1 ? 1u : 0u};
+    std::atomic<uint32_t> g_droppedThreads{0};
+
+#if CMS_TRACE_MAX_THREADS == 1
+    Ring* currentRing() noexcept { return &g_rings[0]; }
+#else
+    thread_local Ring* t_ring = nullptr;
+    thread_local bool t_assigned = false;
+
+    /// 처음 기록하는 스레드에 링을 배정합니다. (풀이 소진되면 nullptr)
+    Ring* currentRing() noexcept {
+        if (!t_assigned) {
+            t_assigned = true;
+            const uint32_t index = g_ringCount.fetch_add(1, std::memory_order_relaxed);
+            if (index < CMS_TRACE_MAX_THREADS) t_ring = &g_rings[index];
+            else g_droppedThreads.fetch_add(1, std::memory_order_relaxed);
+        }
+        return t_ring;
+    }
+#endif
+
+    uint32_t ringCount() noexcept {
+        const uint32_t n = g_ringCount.load(std::memory_order_acquire);
+        return n < CMS_TRACE_MAX_THREADS ? n : CMS_TRACE_MAX_THREADS;
+    }
+
+    /// 카운터 값의 차이를 계산할 때 쓰는 마스크입니다. (32비트 카운터는 하위 32비트만 유효)
+    constexpr uint64_t COUNTER_MASK = cms::trace::counterBits() >= 64 ? ~0ULL : (1ULL << cms::trace::counterBits()) - 1;
+    /// 이보다 큰 (모듈러) 차이는 앞으로 간 것이 아니라 뒤로 간 것으로 봅니다. (카운터 범위의 절반)
+    constexpr uint64_t HALF_RANGE = COUNTER_MASK / 2;
+
+    /// 링의 첫 타임스탬프를 기준 링(ref)과 같은 시간축에 놓습니다.
+    ///
+    /// Why: 링마다 따로 펼치면 한 링은 랩 직전, 다른 링은 랩 직후에 시작했을 때 원시 값 순서가 실제 순서와 뒤집힙니다.
+    /// How: 32비트 카운터는 ref와의 차이를 부호 있는 값(±절반 범위)으로 읽어 HALF_RANGE + 1을 기준점으로 더합니다.
+    uint64_t alignFirst(uint64_t raw, uint64_t ref) noexcept {
+        if (cms::trace::counterBits() >= 64) return raw;
+        const uint64_t ahead = (raw - ref) & COUNTER_MASK;
+        return ahead <= HALF_RANGE ? HALF_RANGE + 1 + ahead : HALF_RANGE + 1 - ((ref - raw) & COUNTER_MASK);
+    }
+
+    /// 카운터 값을 단조 증가 값으로 펼칩니다. (링 안에서 순서대로 호출)
+    ///
+    /// How: 직전 값과의 차이를 카운터 폭으로 잘라 더하므로 랩어라운드는 자연스럽게 이어집니다.
+    ///      차이가 절반 범위를 넘으면 랩이 아니라 카운터가 뒤로 간 것(다른 코어로 이동 등)이므로 0으로 잘라 냅니다.
+    struct Unwrapper {
+        uint64_t prev;
+        uint64_t value;
+
+        Unwrapper(uint64_t firstRaw, uint64_t firstValue) noexcept : prev(firstRaw), value(firstValue) {}
+
+        uint64_t next(uint64_t raw) noexcept {
+            const uint64_t delta = (raw - prev) & COUNTER_MASK;
+            prev = raw;
+            if (delta <= HALF_RANGE) value += delta;
+            return value;
+        }
+    };
+
+    /// JSON 문자열 안에 넣을 수 없는 문자를 '_'로 바꿔 복사합니다.
+    size_t copyName(char* dest, size_t cap, const char* name) noexcept {
+        size_t n = 0;
+        for (const char* p = name ? name : "?"; *p && n + 1 < cap; ++p) {
+            const char c = *p;
+            dest[n++] = (c == '"' || c == '\\' || (unsigned char)c < 0x20) ? '_' : c;
+        }
+        dest[n] = '\0';
+        return n;
+    }
+}
+
+namespace cms {
+namespace trace {
+
+    uint64_t steadyNanos() noexcept {
+#ifdef ARDUINO
+        return (uint64_t)micros() * 1000ULL;
+#else
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    /// [begin] Cortex-M에서는 DEMCR.TRCENA와 DWT_CTRL.CYCCNTENA를 켜서 사이클 카운터를 시작합니다.
+    void begin() noexcept {
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+        *(volatile uint32_t*)0xE000EDFCu |= (1u << 24); // CoreDebug->DEMCR |= TRCENA
+        *(volatile uint32_t*)0xE0001004u = 0;           // DWT->CYCCNT = 0
+        *(volatile uint32_t*)0xE0001000u |= 1u;         // DWT->CTRL |= CYCCNTENA
+#endif
+    }
+
+    /// [record] 링 슬롯을 채운 뒤 head를 release로 올려, 덤프 쪽이 완성된 이벤트만 보도록 합니다.
+    void record(const char* name, char phase) noexcept {
+        Ring* ring = currentRing();
+        if (!ring) return;
+        const uint32_t h = ring->head.load(std::memory_order_relaxed);
+        Event& e = ring->events[h & RING_MASK];
+        e.name = name;
+        e.phase = phase;
+        e.stamp = cycles();
+        ring->head.store(h + 1, std::memory_order_release);
+    }
+
+    void clear() noexcept {
+        const uint32_t n = ringCount();
+        for (uint32_t i = 0; i < n; ++i) g_rings[i].head.store(0, std::memory_order_release);
+    }
+
+    uint32_t droppedThreads() noexcept { return g_droppedThreads.load(std::memory_order_relaxed); }
+
+    size_t writeChromeJson(WriteFn write, void* ctx, double cyclesPerUs) {
+        if (!write) return 0;
+        if (cyclesPerUs <= 0.0) {
+#ifndef ARDUINO
+            cyclesPerUs = measureCyclesPerUs();
+#elif defined(F_CPU)
+            cyclesPerUs = (double)F_CPU / 1e6;
+#else
+            cyclesPerUs = 1.0; // 주파수를 모르면 ts 단위가 사이클이 됩니다.
+#endif
+        }
+
+        // 1) 링마다 첫 타임스탬프를 공통 시간축에 놓고, 그중 가장 이른 값을 ts의 기준으로 삼습니다.
+        //    (펼친 값은 첫 값에서 단조 증가하므로 링의 첫 값이 곧 그 링의 최솟값)
+        const uint32_t rings = ringCount();
+        uint32_t heads[CMS_TRACE_MAX_THREADS] = {};
+        uint64_t firsts[CMS_TRACE_MAX_THREADS] = {};
+        bool haveRef = false;
+        uint64_t ref = 0;
+        uint64_t origin = UINT64_MAX;
+        for (uint32_t r = 0; r < rings; ++r) {
+            heads[r] = g_rings[r].head.load(std::memory_order_acquire);
+            if (heads[r] == 0) continue;
+            const uint32_t count = heads[r] < CMS_TRACE_RING_SIZE ? heads[r] : CMS_TRACE_RING_SIZE;
+            const uint64_t raw = g_rings[r].events[(heads[r] - count) & RING_MASK].stamp;
+            if (!haveRef) { ref = raw; haveRef = true; }
+            firsts[r] = alignFirst(raw, ref);
+            if (firsts[r] < origin) origin = firsts[r];
+        }
+
+        static const char HEAD[] = "{\"traceEvents\":[\n";
+        static const char TAIL[] = "\n],\"displayTimeUnit\":\"ns\"}\n";
+        write(HEAD, sizeof(HEAD) - 1, ctx);
+
+        // 2) 링마다 오래된 순으로 이벤트를 내보냅니다. (tid = 링 번호)
+        size_t written = 0;
+        char line[192];
+        char name[96];
+        for (uint32_t r = 0; r < rings; ++r) {
+            const Ring& ring = g_rings[r];
+            const uint32_t head = heads[r]; // 1)과 같은 구간을 내보내야 기준이 맞습니다.
+            if (head == 0) continue;
+            const uint32_t count = head < CMS_TRACE_RING_SIZE ? head : CMS_TRACE_RING_SIZE;
+            Unwrapper unwrap(ring.events[(head - count) & RING_MASK].stamp, firsts[r]);
+            uint32_t depth = 0;
+            for (uint32_t i = head - count; i != head; ++i) {
+                const Event& e = ring.events[i & RING_MASK];
+                const uint64_t stamp = unwrap.next(e.stamp);
+                if (e.phase == 'E') {
+                    if (depth == 0) continue; // 시작이 덮어써진 구간
+                    depth--;
+                } else {
+                    depth++;
+                }
+                copyName(name, sizeof(name), e.name);
+                const double ts = stamp >= origin ? (double)(stamp - origin) / cyclesPerUs : 0.0;
+                const int n = snprintf(line, sizeof(line),
+                                       "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}",
+                                       written ? ",\n" : "", name, e.phase, ts, (unsigned)r);
+                if (n > 0) write(line, (size_t)n < sizeof(line) ? (size_t)n : sizeof(line) - 1, ctx);
+                written++;
+            }
+        }
+
+        write(TAIL, sizeof(TAIL) - 1, ctx);
+        return written;
+    }
+
+#ifndef ARDUINO
+    bool dumpChromeJson(const char* path, double cyclesPerUs) {
+        FILE* f = fopen(path, "w");
+        if (!f) return false;
+        writeChromeJson([](const char* data, size_t len, void* ctx) { fwrite(data, 1, len, (FILE*)ctx); }, f, cyclesPerUs);
+        fclose(f);
+        return true;
+    }
+
+    /// [measureCyclesPerUs] 10ms 동안 사이클 카운터와 steady_clock의 증가량을 비교합니다.
+    double measureCyclesPerUs() noexcept {
+        const uint64_t t0 = steadyNanos();
+        const uint64_t c0 = cycles();
+        uint64_t t1;
+        do {
+            t1 = steadyNanos();
+        } while (t1 - t0 < 10000000ULL);
+        const uint64_t c1 = cycles();
+        return (double)(c1 - c0) * 1000.0 / (double)(t1 - t0);
+    }
+#endif
+
+} // namespace trace
+} // namespace cms
@@ -0,0 +1,168 @@
+/// @author comser.dev
+///
+/// 핫 패스 계측용 스코프 트레이스(CMS_TRACE) 정의서입니다.
+/// 사이클 카운터로 구간의 시작/끝을 스레드별 링 버퍼에 기록하고, Chrome trace-event JSON으로 내보냅니다.
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <cstdint>  // uint32_t, uint64_t
+
+/**
+ * @brief 스코프 트레이스 활성화 여부
+ * 정의하지 않으면 CMS_TRACE()는 아무 코드도 만들지 않습니다. (헤더 전용 템플릿이 있으므로 빌드 플래그로 전역 지정 권장)
+ */
+// #define CMS_ENABLE_TRACE
+
+/**
+ * @brief 스레드(태스크) 하나의 링 버퍼 항목 수 (2의 거듭제곱)
+ * 항목 하나는 이름 포인터, 타임스탬프, 단계(64비트 호스트 24바이트, 32비트 MCU 16바이트)이며, 가득 차면 가장 오래된 이벤트부터 덮어씁니다.
+ */
+#ifndef CMS_TRACE_RING_SIZE
+#define CMS_TRACE_RING_SIZE 1024
+#endif
+
+/**
+ * @brief 동시에 기록할 수 있는 최대 스레드 수
+ * 1로 지정하면 thread_local 없이 전역 링 하나를 사용합니다. (TLS를 지원하지 않는 베어메탈용)
+ */
+#ifndef CMS_TRACE_MAX_THREADS
+#define CMS_TRACE_MAX_THREADS 8
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h> // __rdtsc
+#endif
+
+namespace cms {
+namespace trace {
+
+// ==================================================================================================
+// [Trace] 개요
+// - 왜 존재하는가: CMS_ENABLE_PROFILING은 버퍼 최대 사용량만 알려줄 뿐, 로그 한 줄이나 큐 연산에서 시간이 어디에
+//                  쓰이는지는 볼 방법이 없었습니다.
+// - 어떻게 동작하는가: CMS_TRACE("이름")이 만든 스코프 객체가 생성/소멸 시 사이클 카운터 값을 현재 스레드의 링에
+//                      기록합니다. 링은 소유 스레드만 쓰므로 락이 없고, 덤프 시 모든 링을 모아 시간 순으로 JSON을 만듭니다.
+// ==================================================================================================
+
+    static_assert((CMS_TRACE_RING_SIZE & (CMS_TRACE_RING_SIZE - 1)) == 0, "CMS_TRACE_RING_SIZE must be a power of two");
+
+    /// steady_clock 기반 나노초입니다. (사이클 카운터가 없는 호스트의 대체 시계)
+    uint64_t steadyNanos() noexcept;
+
+    /// [cycles] 현재 코어의 사이클 카운터를 읽습니다.
+    ///
+    /// How: x86은 rdtsc, AArch64는 가상 타이머(cntvct), Cortex-M3 이상은 DWT->CYCCNT, ESP32(Xtensa)는 ccount 레지스터,
+    ///      RISC-V는 rdcycle을 사용합니다. 그 외 호스트는 steady_clock 나노초로 대체합니다.
+    /// @note Cortex-M의 DWT 카운터는 begin()에서 켜야 증가합니다. MCU 카운터는 32비트라 덤프 시 순서대로 펼칩니다.
+    /// @note 카운터는 코어마다 따로 돕니다. ESP32처럼 코어가 둘인 칩에서 계측하는 태스크는 한 코어에 고정(pin)하세요.
+    ///       이동하더라도 덤프는 뒤로 간 값을 0 구간으로 잘라 내지만, 이동 직후 구간의 길이는 부정확해집니다.
+    inline uint64_t cycles() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t v;
+        __asm__ volatile("mrs %0, cntvct_el0" : "=r"(v));
+        return v;
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+        return *(volatile uint32_t*)0xE0001004u; // DWT->CYCCNT
+#elif defined(__XTENSA__)
+        uint32_t v;
+        __asm__ volatile("rsr %0, ccount" : "=a"(v));
+        return v;
+#elif defined(__riscv)
+        unsigned long v;
+        __asm__ volatile("rdcycle %0" : "=r"(v));
+        return v;
+#else
+        return steadyNanos();
+#endif
+    }
+
+    /// 사이클 카운터의 유효 비트 수입니다. (32비트 카운터는 덤프 시 랩어라운드를 펼침)
+    /// @note 펼칠 때 범위의 절반(32비트 240MHz 기준 약 8.9초)을 넘는 차이는 뒤로 간 것으로 봅니다.
+    ///       같은 스레드의 연속 이벤트 사이, 그리고 링들의 첫 이벤트 사이가 이보다 멀면 시간축이 어긋납니다.
+    constexpr int counterBits() noexcept {
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || defined(__XTENSA__) || \
+    (defined(__riscv) && __riscv_xlen == 32)
+        return 32;
+#else
+        return 64;
+#endif
+    }
+
+    /// [begin] 사이클 카운터를 사용할 수 있게 준비합니다. (Cortex-M DWT 활성화, 그 외 플랫폼은 아무것도 하지 않음)
+    void begin() noexcept;
+
+    /// [record] 현재 스레드의 링에 이벤트 하나를 기록합니다.
+    ///
+    /// @param name 구간 이름 (리터럴, 덤프 시점까지 살아 있어야 함)
+    /// @param phase 'B'(시작) 또는 'E'(끝)
+    /// @note 링을 배정받지 못한 스레드(CMS_TRACE_MAX_THREADS 초과)의 이벤트는 버리고 droppedThreads()로 집계합니다.
+    void record(const char* name, char phase) noexcept;
+
+    /// [clear] 모든 링의 기록을 지웁니다. (기록 중인 스레드가 없을 때 호출)
+    void clear() noexcept;
+
+    /// 링을 배정받지 못해 기록이 버려진 스레드 수를 반환합니다.
+    uint32_t droppedThreads() noexcept;
+
+    /// 덤프 출력 콜백: data부터 len바이트를 내보냅니다.
+    using WriteFn = void (*)(const char* data, size_t len, void* ctx);
+
+    /// [writeChromeJson] 모든 링의 이벤트를 Chrome trace-event JSON으로 내보냅니다. (chrome://tracing, Perfetto)
+    ///
+    /// How: 스레드마다 링에 남은 이벤트를 오래된 순으로 읽어 ts(마이크로초, 가장 이른 이벤트 기준)로 변환합니다.
+    ///      링이 덮어써져 짝을 잃은 'E' 이벤트는 건너뜁니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// cms::trace::writeChromeJson([](const char* d, size_t n, void*) { Serial.write(d, n); }, nullptr, 240.0);
+    /// @endcode
+    ///
+    /// @param cyclesPerUs 마이크로초당 사이클 수 (ESP32 240MHz → 240.0, 0이면 호스트에서 측정)
+    /// @return 내보낸 이벤트 수
+    /// @note 기록 중인 스레드가 있으면 덮어써지는 중인 이벤트가 섞일 수 있으므로, 측정을 멈춘 뒤 호출하세요.
+    size_t writeChromeJson(WriteFn write, void* ctx, double cyclesPerUs = 0.0);
+
+#ifndef ARDUINO
+    /// [dumpChromeJson] 호스트에서 JSON을 파일로 저장합니다.
+    /// @return 파일을 열지 못하면 false
+    bool dumpChromeJson(const char* path, double cyclesPerUs = 0.0);
+
+    /// [measureCyclesPerUs] steady_clock과 비교하여 마이크로초당 사이클 수를 측정합니다. (약 10ms 소요)
+    double measureCyclesPerUs() noexcept;
+#endif
+
+    /// CMS_TRACE가 만드는 스코프 객체입니다. 생성 시 'B', 소멸 시 'E'를 기록합니다.
+    class Scope {
+    public:
+        explicit Scope(const char* name) noexcept : _name(name) { record(name, 'B'); }
+        ~Scope() { record(_name, 'E'); }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char* _name;
+    };
+
+} // namespace trace
+} // namespace cms
+
+#define CMS_TRACE_CONCAT_(a, b) a##b
+#define CMS_TRACE_CONCAT(a, b) CMS_TRACE_CONCAT_(a, b)
+
+/// [CMS_TRACE] 현재 스코프 전체를 name 구간으로 기록합니다. (CMS_ENABLE_TRACE 미정의 시 제거됨)
+///
+/// 사용 예:
+/// @code
+/// void handlePacket() {
+///     CMS_TRACE("handlePacket");
+///     ...
+/// }
+/// @endcode
+#ifdef CMS_ENABLE_TRACE
+#define CMS_TRACE(name) ::cms::trace::Scope CMS_TRACE_CONCAT(_cmsTrace, __LINE__)(name)
+#else
+#define CMS_TRACE(name) ((void)0)
+#endif
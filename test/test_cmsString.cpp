@@ -0,0 +1,1450 @@
+#define CMS_STRING_TEST     1
+
+#ifdef CMS_STRING_TEST
+
+#include <iostream>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <climits>
+#include "../src/cmsString.h"
+#include "../src/cmsTokenizer.h"
+#include "../src/cmsCsvParser.h"
+#include "../src/cmsFormat.h"
+#include "../src/cmsArena.h"
+#include "../src/cmsRope.h"
+#include "../src/cmsIntern.h"
+#include "../src/cmsFlatMap.h"
+#include "../src/cmsStringTable.h"
+#include "../src/cmsCString.h"
+#include "../src/cmsTrace.h"
+
+/**
+ * @brief 문자열 커널 검증 테스트
+ * 각 섹션은 결과를 출력하며, 실패가 하나라도 있으면 0이 아닌 값으로 종료합니다.
+ */
+static int g_failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { std::cout << "  [FAIL] " << __LINE__ << ": " #cond << std::endl; g_failures++; } \
+} while (0)
+
+static void testUtf8Count() {
+    std::cout << "=== Test 1: UTF-8 글자 수 (벡터화 카운터) ===" << std::endl;
+
+    CHECK(cms::string::utf8_strlen("") == 0);
+    CHECK(cms::string::utf8_strlen("ABC") == 3);
+    CHECK(cms::string::utf8_strlen("안녕하세요") == 5);
+
+    // SIMD 블록(16바이트)과 꼬리 처리를 모두 거치도록 긴 혼합 문자열을 만듭니다.
+    char buf[1024];
+    size_t len = 0;
+    size_t expected = 0;
+    const char* parts[] = { "abc", "한글", "😀", "x", "é" };
+    const size_t chars[] = { 3, 2, 1, 1, 1 };
+    for (size_t i = 0; len + 8 < sizeof(buf); ++i) {
+        const char* p = parts[i % 5];
+        memcpy(buf + len, p, strlen(p));
+        len += strlen(p);
+        expected += chars[i % 5];
+    }
+    buf[len] = '\0';
+    CHECK(cms::string::utf8_strlen(buf) == expected);
+    CHECK(cms::string::utf8_strlen(buf, len) == expected);
+    // 길이 지정 버전은 NUL 이후를 보지 않습니다.
+    CHECK(cms::string::utf8_strlen("한글\0ABC", 6) == 2);
+
+    cms::String<64> s = "안녕";
+    CHECK(s.count() == 2);
+    s << "하세요";
+    CHECK(s.count() == 5);
+    s.remove(0, 1);
+    CHECK(s.count() == 4);
+    s[0] = 'A';
+    CHECK(s.count() == 4);
+    s.clear();
+    CHECK(s.count() == 0);
+}
+
+static void testTokenizer() {
+    std::cout << "=== Test 2: 길이 기반 split / Tokenizer ===" << std::endl;
+
+    cms::string::Token tk[4];
+    const char* line = "a:bb::ccc";
+    CHECK(cms::string::split(line, strlen(line), ':', tk, 4) == 4);
+    CHECK(tk[1] == "bb" && tk[2].len == 0 && tk[3] == "ccc");
+    CHECK(cms::string::split(line, strlen(line), ':', tk, 2) == 2);
+    CHECK(tk[1] == "bb::ccc");
+
+    // 구분자 집합 + 공백 정리 + CSV 따옴표
+    const char* csv = " 1 ; \"x, \"\"y\"\"\" ,3,,  last  ";
+    cms::string::Tokenizer t(csv, ",;");
+    t.setQuote('"', '"');
+    t.setTrim(true);
+    cms::string::Token out;
+    CHECK(t.next(out) && out == "1");
+    CHECK(t.next(out) && t.lastQuoted() && out == "x, \"\"y\"\"");
+    char unq[32];
+    cms::string::Tokenizer::unescape(out, '"', '"', unq, sizeof(unq));
+    CHECK(strcmp(unq, "x, \"y\"") == 0);
+    CHECK(t.next(out) && out == "3");
+    CHECK(t.next(out) && out.len == 0);
+    CHECK(t.next(out) && out == "last");
+    CHECK(!t.next(out) && !t.hasNext());
+
+    // 공백 구분 + 빈 토큰 건너뛰기 + 범위 기반 for
+    cms::string::Tokenizer ws("+CSQ:  17,  99   OK", " ,");
+    ws.setSkipEmpty(true);
+    size_t n = 0;
+    const char* expected[] = { "+CSQ:", "17", "99", "OK" };
+    for (const cms::string::Token& tok : ws) {
+        CHECK(n < 4 && tok == expected[n]);
+        n++;
+    }
+    CHECK(n == 4);
+
+    // 백슬래시 이스케이프와 16바이트 이상 SIMD 구간
+    cms::string::Tokenizer bs("\"abc\\\"def ghi jkl mno\"|tail", "|");
+    bs.setQuote('"', '\\');
+    CHECK(bs.next(out) && out == "abc\\\"def ghi jkl mno");
+    CHECK(bs.next(out) && out == "tail");
+
+    const char* longLine = "0123456789abcdefghijklmnopqrstuvwxyz;end";
+    CHECK(cms::string::findAnyOf(longLine, strlen(longLine), ";|", 2) == longLine + 36);
+    CHECK(cms::string::findAnyOf(longLine, 36, ";|", 2) == nullptr);
+}
+
+/// 필드를 "필드|필드;" 형태로 모으는 테스트용 파서입니다.
+class CsvCollector : public cms::CsvParser<16> {
+public:
+    char out[256];
+    size_t outLen = 0;
+    size_t zeroCopy = 0;
+    const char* chunkBegin = nullptr;
+    const char* chunkEnd = nullptr;
+
+    void put(const char* s, size_t n) {
+        if (outLen + n < sizeof(out)) { memcpy(out + outLen, s, n); outLen += n; }
+        out[outLen] = '\0';
+    }
+
+protected:
+    void onField(const cms::string::Token& f, size_t column) override {
+        if (column > 0) put("|", 1);
+        put(f.ptr, f.len);
+        if (f.len > 0 && f.ptr >= chunkBegin && f.ptr < chunkEnd) zeroCopy++;
+    }
+    void onRecordEnd(size_t fieldCount) override {
+        char tail[8];
+        int n = snprintf(tail, sizeof(tail), "/%u;", (unsigned)fieldCount);
+        put(tail, (size_t)n);
+    }
+};
+
+static void testCsvParser() {
+    std::cout << "=== Test 3: 스트리밍 CSV 파서 ===" << std::endl;
+
+    const char* csv = "id,name,note\r\n"
+                      "1,\"Kim, J\",\"say \"\"hi\"\"\"\n"
+                      "\n"
+                      "2,,\"multi\nline\"\r\n"
+                      "3,last,";
+    const char* expected = "id|name|note/3;"
+                           "1|Kim, J|say \"hi\"/3;"
+                           "2||multi\nline/3;"
+                           "3|last|/3;";
+    const size_t len = strlen(csv);
+
+    // 1바이트 청크부터 전체 입력까지 모든 분할 크기에서 결과가 같아야 합니다.
+    for (size_t chunk = 1; chunk <= len; ++chunk) {
+        CsvCollector p;
+        for (size_t off = 0; off < len; off += chunk) {
+            size_t n = (len - off < chunk) ? len - off : chunk;
+            p.chunkBegin = csv + off;
+            p.chunkEnd = csv + off + n;
+            p.feed(csv + off, n);
+        }
+        p.finish();
+        if (strcmp(p.out, expected) != 0) {
+            std::cout << "  chunk=" << chunk << " -> " << p.out << std::endl;
+        }
+        CHECK(strcmp(p.out, expected) == 0);
+        CHECK(p.recordCount() == 4);
+        CHECK(p.truncatedFields() == 0);
+        // 한 번에 넣으면 이스케이프가 없는 필드는 모두 원본을 그대로 가리킵니다.
+        if (chunk == len) CHECK(p.zeroCopy == 9);
+    }
+
+    // 캐리 버퍼(16B)를 넘는 필드는 잘리고 집계됩니다.
+    CsvCollector small;
+    const char* big = "\"0123456789abcdefghij\",x\n";
+    for (const char* c = big; *c; ++c) small.feed(c, 1);
+    small.finish();
+    CHECK(strcmp(small.out, "0123456789abcdef|x/2;") == 0);
+    CHECK(small.truncatedFields() == 1);
+
+    // 구분자 변경 + 따옴표 비활성
+    CsvCollector tsv;
+    tsv.setDelimiter('\t');
+    tsv.setQuote('\0');
+    const char* t = "a\t\"b\"\tc";
+    tsv.feed(t, strlen(t));
+    tsv.finish();
+    CHECK(strcmp(tsv.out, "a|\"b\"|c/3;") == 0);
+}
+
+/// 형식 지정 실수 변환 결과를 문자열로 돌려주는 보조 함수입니다.
+static const char* fmtFloat(char* buf, size_t size, double v, cms::string::FloatFormat f, int precision = -1) {
+    size_t len = 0;
+    buf[0] = '\0';
+    cms::string::appendFloat(buf, size, len, v, f, precision);
+    return buf;
+}
+
+static void testFloatFormat() {
+    std::cout << "=== Test 4: 실수 포맷팅 (왕복 / 정확 반올림) ===" << std::endl;
+    using cms::string::FloatFormat;
+    char b[64];
+
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 0.1, FloatFormat::Shortest), "0.1") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 0.1 + 0.2, FloatFormat::Shortest), "0.30000000000000004") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 1e21, FloatFormat::Shortest), "1e+21") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 123456789012.0, FloatFormat::Shortest), "123456789012") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), -5e-324, FloatFormat::Shortest), "-5e-324") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 1.7976931348623157e308, FloatFormat::Shortest), "1.7976931348623157e+308") == 0);
+
+    // float 정밀도 기준 왕복 표기
+    size_t len = 0;
+    cms::string::appendFloat(b, sizeof(b), len, 3.14f, FloatFormat::Shortest);
+    CHECK(strcmp(b, "3.14") == 0);
+
+    // 고정 표기: 정수형 캐스팅 없이 큰 값도 정확히 출력
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 4294967296.5, FloatFormat::Fixed, 1), "4294967296.5") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 9.996, FloatFormat::Fixed, 2), "10.00") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), -0.004, FloatFormat::Fixed, 2), "-0.00") == 0);
+
+    // 정밀도 지정 형식은 이진 값 그대로를 한 번만 반올림합니다. (정확히 절반이면 짝수 쪽, printf와 동일)
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 9.995, FloatFormat::Fixed, 2), "9.99") == 0);   // 실제 값 9.99499999...
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 2.675, FloatFormat::Fixed, 2), "2.67") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 1.0005, FloatFormat::Fixed, 3), "1.000") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 0.25, FloatFormat::Fixed, 1), "0.2") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 2.5, FloatFormat::Fixed, 0), "2") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 3.5, FloatFormat::Fixed, 0), "4") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 0.1, FloatFormat::Fixed, 20), "0.10000000000000000555") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 125.0, FloatFormat::Exponent, 1), "1.2e+02") == 0);
+
+    // 지수 / %g 표기 (C 표준과 동일한 규칙)
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 1500.0, FloatFormat::Exponent, 3), "1.500e+03") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 0.0001234, FloatFormat::General), "0.0001234") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 0.00001234, FloatFormat::General), "1.234e-05") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 123456789.0, FloatFormat::General), "1.23457e+08") == 0);
+    CHECK(strcmp(fmtFloat(b, sizeof(b), 100.0, FloatFormat::General), "100") == 0);
+
+    // 무작위 비트 패턴 왕복 검증 (double / float)
+    uint64_t seed = 0x9E3779B97F4A7C15ull;
+    int roundTripFailures = 0;
+    for (int i = 0; i < 20000; ++i) {
+        seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+        double d;
+        memcpy(&d, &seed, sizeof(d));
+        if (d != d || d - d != 0) continue; // NaN / Inf 제외
+        fmtFloat(b, sizeof(b), d, FloatFormat::Shortest);
+        if (strtod(b, nullptr) != d) roundTripFailures++;
+
+        uint32_t fbits = (uint32_t)(seed >> 32);
+        float f;
+        memcpy(&f, &fbits, sizeof(f));
+        if (f != f || f - f != 0) continue;
+        len = 0;
+        cms::string::appendFloat(b, sizeof(b), len, f, FloatFormat::Shortest);
+        if (strtof(b, nullptr) != f) roundTripFailures++;
+    }
+    CHECK(roundTripFailures == 0);
+
+    // 정밀도 지정 형식을 snprintf와 비교 (무작위 비트 패턴 + 소수부가 긴 보통 크기 값)
+    char e[64];
+    int printfMismatches = 0;
+    for (int i = 0; i < 20000; ++i) {
+        seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+        double d;
+        memcpy(&d, &seed, sizeof(d));
+        if (d != d || d - d != 0) continue;
+        const int p = (int)(seed >> 60) % 12;
+        fmtFloat(b, sizeof(b), d, FloatFormat::Exponent, p);
+        snprintf(e, sizeof(e), "%.*e", p, d);
+        if (strcmp(b, e) != 0) printfMismatches++;
+        fmtFloat(b, sizeof(b), d, FloatFormat::General, p);
+        snprintf(e, sizeof(e), "%.*g", p, d);
+        if (strcmp(b, e) != 0) printfMismatches++;
+        const double moderate = (double)(int64_t)(seed >> 20) / (double)(1ull << ((seed >> 3) % 60));
+        fmtFloat(b, sizeof(b), moderate, FloatFormat::Fixed, p);
+        snprintf(e, sizeof(e), "%.*f", p, moderate);
+        if (strcmp(b, e) != 0) printfMismatches++;
+    }
+    CHECK(printfMismatches == 0);
+
+    // printf 엔진 및 StringBase 연동
+    cms::String<96> s;
+    s.printf("%f|%.3e|%g|%G|%08.2f|%5.1f", 2.5, 12345.678, 1e-10, 1e300, -3.14159, 1.25);
+    CHECK(s == "2.50|1.235e+04|1e-10|1E+300|-0003.14|  1.2");
+    s.printf("%f %e", 1.0 / 0.0, -(0.0 / 0.0));
+    CHECK(strncmp(s.c_str(), "inf ", 4) == 0);
+    s.clear();
+    s.appendFloat(0.1f, FloatFormat::Shortest);
+    s << ',' << 4.5e9;
+    CHECK(s == "0.1,4500000000.00");
+
+    // 공간이 부족하면 잘린 숫자를 남기지 않습니다.
+    char tiny[6] = "ab";
+    len = 2;
+    cms::string::appendFloat(tiny, sizeof(tiny), len, 12345.0, FloatFormat::Shortest);
+    CHECK(len == 2 && strcmp(tiny, "ab") == 0);
+}
+
+static void testFloatParse() {
+    std::cout << "=== Test 5: 정확 반올림 실수 파싱 ===" << std::endl;
+    using cms::string::ParseError;
+
+    double d = 0;
+    const char* in = "-2.5e+2,17";
+    cms::string::ParseResult r = cms::string::fromChars(in, in + strlen(in), d);
+    CHECK(r && d == -250.0 && *r.ptr == ',');
+
+    // 'e' 뒤에 숫자가 없으면 지수로 보지 않습니다.
+    in = "5e";
+    r = cms::string::fromChars(in, in + 2, d);
+    CHECK(r && d == 5.0 && r.ptr == in + 1);
+
+    in = "abc";
+    d = 7.0;
+    r = cms::string::fromChars(in, in + 3, d);
+    CHECK(r.ec == ParseError::Invalid && r.ptr == in && d == 7.0);
+
+    in = "1e400";
+    r = cms::string::fromChars(in, in + 5, d);
+    CHECK(r.ec == ParseError::OutOfRange && d > 1e308);
+    in = "-1e-400";
+    r = cms::string::fromChars(in, in + 7, d);
+    CHECK(r.ec == ParseError::OutOfRange && d == 0.0);
+
+    in = "-Infinity";
+    CHECK(cms::string::fromChars(in, in + 9, d) && d < -1e308);
+    in = "nan";
+    CHECK(cms::string::fromChars(in, in + 3, d) && d != d);
+
+    // 19자리를 넘는 입력과 서브노멀, 짝수 반올림 경계
+    const char* cases[] = {
+        "0.1", "1e-3", "3.14159265358979323846264338327950288", "2.2250738585072011e-308",
+        "4.9406564584124654e-324", "9007199254740993", "123456789012345678901234567890e-10",
+        "0.000000000000000000000000000001234567890123456789012345", "1.7976931348623157e308"
+    };
+    for (const char* c : cases) {
+        CHECK(cms::string::fromChars(c, c + strlen(c), d) && d == strtod(c, nullptr));
+    }
+
+    // float 직접 변환 (double을 거친 이중 반올림 없음)
+    float f = 0;
+    in = "1.00000005960464477550";
+    CHECK(cms::string::fromChars(in, in + strlen(in), f) && f == strtof(in, nullptr));
+
+    // 무작위 입력을 표준 strtod / strtof 와 비트 단위로 비교
+    uint64_t seed = 0x2545F4914F6CDD1Dull;
+    int mismatches = 0;
+    char buf[80];
+    for (int i = 0; i < 20000; ++i) {
+        seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+        int len = 0;
+        if (seed & 1) buf[len++] = '-';
+        const int digits = 1 + (int)((seed >> 8) % 24);
+        const int dot = (int)((seed >> 16) % (uint64_t)(digits + 1));
+        uint64_t r2 = seed;
+        for (int k = 0; k < digits; ++k) {
+            if (k == dot) buf[len++] = '.';
+            buf[len++] = (char)('0' + r2 % 10);
+            r2 = r2 / 10 + (seed >> 40) * 7 + (uint64_t)k;
+        }
+        len += snprintf(buf + len, sizeof(buf) - (size_t)len, "e%d", (int)((seed >> 24) % 640) - 320);
+
+        double dv = 0;
+        float fv = 0;
+        r = cms::string::fromChars(buf, buf + len, dv);
+        const double de = strtod(buf, nullptr);
+        if (memcmp(&dv, &de, sizeof(dv)) != 0 || r.ptr != buf + len) mismatches++;
+        cms::string::fromChars(buf, buf + len, fv);
+        const float fe = strtof(buf, nullptr);
+        if (memcmp(&fv, &fe, sizeof(fv)) != 0) mismatches++;
+    }
+    CHECK(mismatches == 0);
+
+    // 기존 API 연동: 공백 허용, 지수 지원, Token
+    CHECK(cms::string::toFloat("  1e-3") == 0.001);
+    cms::string::Token tk{"12.5;", 4};
+    CHECK(tk.toFloat() == 12.5);
+}
+
+/// NUL 종료 문자열 전체를 parseInt로 변환하는 보조 함수입니다.
+template <typename T>
+static cms::string::ParseResult parseAll(const char* s, T& v, int base = 10) {
+    return cms::string::parseInt(s, s + strlen(s), v, base);
+}
+
+static void testIntParse() {
+    std::cout << "=== Test 6: SWAR 정수 파싱 / 오버플로우 검출 ===" << std::endl;
+    using cms::string::ParseError;
+
+    int64_t i64 = 0;
+    CHECK(parseAll("-9223372036854775808", i64) && i64 == INT64_MIN);
+    CHECK(parseAll("9223372036854775807", i64) && i64 == INT64_MAX);
+    CHECK(parseAll("9223372036854775808", i64).ec == ParseError::OutOfRange && i64 == INT64_MAX);
+
+    uint64_t u64 = 0;
+    CHECK(parseAll("18446744073709551615", u64) && u64 == UINT64_MAX);
+    CHECK(parseAll("18446744073709551616", u64).ec == ParseError::OutOfRange);
+    CHECK(parseAll("99999999999999999999", u64).ec == ParseError::OutOfRange);
+    CHECK(parseAll("000000000000000000000000012345678", u64) && u64 == 12345678u);
+    CHECK(parseAll("-1", u64).ec == ParseError::Invalid);
+
+    int8_t i8 = 0;
+    CHECK(parseAll("-128", i8) && i8 == -128);
+    CHECK(parseAll("128", i8).ec == ParseError::OutOfRange);
+    uint8_t u8 = 0;
+    CHECK(parseAll("0b11111111", u8, 0) && u8 == 255);
+    CHECK(parseAll("0x100", u8, 0).ec == ParseError::OutOfRange);
+    uint32_t u32 = 0;
+    CHECK(parseAll("0xDEADbeef", u32, 16) && u32 == 0xDEADBEEFu);
+    CHECK(parseAll("zz", u32, 36) && u32 == 35u * 36u + 35u);
+
+    // 끝 위치: 숫자가 끝난 곳에서 멈추며, 숫자 없는 접두사는 "0"까지만 소비합니다.
+    const char* in = "12345678901,7";
+    cms::string::ParseResult r = cms::string::parseInt(in, in + strlen(in), i64);
+    CHECK(r && i64 == 12345678901LL && *r.ptr == ',');
+    in = "0xg";
+    r = cms::string::parseInt(in, in + 3, u32, 0);
+    CHECK(r && u32 == 0 && r.ptr == in + 1);
+    CHECK(parseAll("+", u32).ec == ParseError::Invalid);
+
+    // 무작위 값 왕복 (SWAR 8자리 경로 + 꼬리 경로)
+    uint64_t seed = 0x853C49E6748FEA9Bull;
+    int mismatches = 0;
+    char buf[32];
+    for (int i = 0; i < 20000; ++i) {
+        seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+        const int64_t v = (int64_t)(seed >> (seed & 63));
+        snprintf(buf, sizeof(buf), "%lld", (long long)((seed & 1) ? -v : v));
+        int64_t out = 0;
+        if (!parseAll(buf, out) || out != strtoll(buf, nullptr, 10)) mismatches++;
+    }
+    CHECK(mismatches == 0);
+
+    // 기존 API: 범위 초과 시 포화, hexToInt는 32비트 비트 패턴 유지
+    CHECK(cms::string::toInt(" 42abc") == 42);
+    CHECK(cms::string::toInt("99999999999") == INT_MAX);
+    CHECK(cms::string::toInt("-99999999999") == INT_MIN);
+    CHECK(cms::string::hexToInt("0xFFFFFFFF") == -1);
+    CHECK(cms::string::hexToInt("0x1FFFFFFFF") == -1);
+    CHECK(cms::string::hexToInt("1A") == 26);
+}
+
+static void testIntFormat() {
+    std::cout << "=== Test 7: 64비트 정수 포맷팅 / 길이 수정자 ===" << std::endl;
+
+    char b[64];
+    char e[64];
+    size_t len = 0;
+    cms::string::appendInt(b, sizeof(b), len, INT64_MIN);
+    CHECK(strcmp(b, "-9223372036854775808") == 0);
+    len = 0;
+    cms::string::appendUInt(b, sizeof(b), len, UINT64_MAX);
+    CHECK(strcmp(b, "18446744073709551615") == 0);
+
+    // 무작위 값과 너비를 snprintf와 비교 (자릿수 경계 포함)
+    uint64_t seed = 0xDA942042E4DD58B5ull;
+    int mismatches = 0;
+    for (int i = 0; i < 20000; ++i) {
+        seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+        const uint64_t u = seed >> (seed % 64);
+        const int width = (int)(seed >> 58) % 24;
+        len = 0;
+        cms::string::appendUInt(b, sizeof(b), len, u, width, '0');
+        snprintf(e, sizeof(e), "%0*llu", width, (unsigned long long)u);
+        if (strcmp(b, e) != 0) mismatches++;
+        len = 0;
+        cms::string::appendInt(b, sizeof(b), len, -(long long)(u >> 1), width, ' ');
+        snprintf(e, sizeof(e), "%*lld", width, -(long long)(u >> 1));
+        if (strcmp(b, e) != 0) mismatches++;
+    }
+    CHECK(mismatches == 0);
+
+    cms::String<128> s;
+    s.printf("%lld|%llu|%zu|%hhd|%hu|%i|%05d|%5d|%lx|%jd", -1234567890123LL, 10000000000ULL, (size_t)42,
+             (signed char)-7, (unsigned short)65535, -3, -42, -42, 0xABCDEFUL, (intmax_t)7);
+    CHECK(s == "-1234567890123|10000000000|42|-7|65535|-3|-0042|  -42|abcdef|7");
+
+    void* ptr = (void*)(uintptr_t)0xBEEF;
+    s.printf("%p", ptr);
+    CHECK(s == "0xbeef");
+
+    // 스트림 연산자: 마이크로초 타임스탬프(64비트) 및 unsigned
+    s.clear();
+    s << (uint64_t)1700000000123456ULL << ',' << 3000000000u << ',' << (int64_t)-5;
+    CHECK(s == "1700000000123456,3000000000,-5");
+
+    // 공간이 부족하면 부호만 남기지 않습니다.
+    char tiny[4] = "";
+    len = 0;
+    cms::string::appendInt(tiny, sizeof(tiny), len, -1234);
+    CHECK(len == 0 && tiny[0] == '\0');
+}
+
+static void testCompiledFormat() {
+    std::cout << "=== Test 8: 컴파일 타임 포맷 (CMS_FORMAT) ===" << std::endl;
+
+    // 같은 포맷/인자로 런타임 appendPrintf와 결과가 같아야 합니다.
+    cms::String<128> a;
+    cms::String<128> e;
+    const char* tag = "NET";
+    int n = CMS_FORMAT(a, "[%s] rssi=%d ch=%02u id=%08X t=%.3f %% %c|%lld|%5.1e|%g", tag, -67, 6u, 0xBEEFu, 21.5f, 'k',
+                       -1234567890123LL, 1500.0, 0.0001);
+    e.appendPrintf("[%s] rssi=%d ch=%02u id=%08X t=%.3f %% %c|%lld|%5.1e|%g", tag, -67, 6u, 0xBEEFu, 21.5f, 'k',
+                   -1234567890123LL, 1500.0, 0.0001);
+    CHECK(a == e);
+    CHECK(n == (int)a.length());
+
+    // 기존 내용 뒤에 추가되며, %f 기본 정밀도는 appendPrintf와 같이 2입니다.
+    a = "T=";
+    CMS_FORMAT(a, "%f%s", 3.14159, "C");
+    CHECK(a == "T=3.14C");
+
+    // 인자 없는 포맷, 문자열 객체/Token 인자, 널 포인터
+    a.clear();
+    CMS_FORMAT(a, "100%%");
+    cms::String<8> unit("kPa");
+    cms::string::Token tok{"abcdef", 3};
+    const char* none = nullptr;
+    CMS_FORMAT(a, " %s/%s/%s", unit, tok, none);
+    CHECK(a == "100% kPa/abc/(null)");
+
+    // 부호 없는 변환은 같은 폭의 부호 없는 값으로 해석합니다.
+    a.clear();
+    CMS_FORMAT(a, "%u %x %d", -1, (signed char)-1, (unsigned long long)UINT64_MAX);
+    CHECK(a == "4294967295 ff 18446744073709551615");
+
+    // 원시 버퍼 버전과 용량 초과 처리
+    char buf[12];
+    size_t len = 0;
+    CMS_FORMAT_TO(buf, sizeof(buf), len, "%s-%d", "abcdefgh", 12345);
+    CHECK(strcmp(buf, "abcdefgh-") == 0 && len == 9);
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+    a.clear();
+    cms::format<"[%s] %d">(a, tag, 42);
+    CHECK(a == "[NET] 42");
+#endif
+}
+
+static void testManipulators() {
+    std::cout << "=== Test 9: 스트림 조작자 (hex/fixed/pad/bytes) ===" << std::endl;
+
+    cms::String<128> s;
+    s << "ID=" << cms::hex(0xBEEFu, 8) << ' ' << cms::hex(255, 0, false) << ' ' << cms::hex((int8_t)-1);
+    CHECK(s == "ID=0000BEEF ff FF");
+
+    s.clear();
+    s << cms::fixed(21.5, 3) << '|' << cms::fixed(45.04f, 1, 6) << '|' << cms::fixed(-2.5, 1, 7, '0') << '|' << cms::fixed(3.14159f);
+    CHECK(s == "21.500|  45.0|-0002.5|3.14");
+
+    // 정수 인자는 double로 변환됩니다. (float/double 오버로드 사이에서 모호하지 않음)
+    s.clear();
+    s << cms::fixed(2, 1) << '|' << cms::fixed(-7L, 2, 6) << '|' << cms::fixed((uint8_t)200, 0);
+    CHECK(s == "2.0| -7.00|200");
+
+    s.clear();
+    s << cms::pad(7, 3, '0') << ':' << cms::pad(-5, 4) << ':' << cms::pad((uint64_t)UINT64_MAX, 1) << ':' << cms::pad(INT64_MIN, 0);
+    CHECK(s == "007:  -5:18446744073709551615:-9223372036854775808");
+
+    // 조작자 출력은 같은 서식의 appendPrintf와 같아야 합니다.
+    cms::String<64> e;
+    s.clear();
+    s << cms::pad(-42, 6, '0') << cms::hex(0xABCDu, 6) << cms::fixed(-0.125, 2, 8);
+    e.appendPrintf("%06d%06X%8.2f", -42, 0xABCDu, -0.125);
+    CHECK(s == e);
+
+    const uint8_t pkt[] = {0x01, 0xA0, 0xFF, 0x7E};
+    s.clear();
+    s << "PKT: " << cms::bytes(pkt, sizeof(pkt), ' ') << " / " << cms::bytes(pkt, 2);
+    CHECK(s == "PKT: 01 A0 FF 7E / 01A0");
+
+    // 공간이 부족하면 바이트 단위로 잘립니다. (반쪽 바이트를 남기지 않음)
+    cms::String<8> small;
+    small << cms::bytes(pkt, sizeof(pkt), ' ');
+    CHECK(small == "01 A0");
+}
+
+static void testBinaryText() {
+    std::cout << "=== Test 10: Hex/Base64/Base32 인코딩/디코딩 ===" << std::endl;
+
+    // RFC 4648 테스트 벡터
+    const char* in[] = {"", "f", "fo", "foo", "foob", "fooba", "foobar"};
+    const char* b64[] = {"", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy"};
+    const char* b32[] = {"", "MY======", "MZXQ====", "MZXW6===", "MZXW6YQ=", "MZXW6YTB", "MZXW6YTBOI======"};
+    cms::String<64> s;
+    for (int i = 0; i < 7; ++i) {
+        s.clear();
+        s.appendBase64(in[i], strlen(in[i]));
+        CHECK(s == b64[i]);
+        s.clear();
+        s.appendBase32(in[i], strlen(in[i]));
+        CHECK(s == b32[i]);
+    }
+    s.clear();
+    const uint8_t url[] = {0xFB, 0xFF};
+    s.appendBase64(url, 2, true);
+    CHECK(s == "-_8");
+
+    // 무작위 데이터 왕복 및 바이트별 %02x 결과와 비교 (SIMD 블록 경계 포함)
+    uint8_t data[300];
+    uint8_t back[300];
+    char text[700];
+    char expect[700];
+    uint32_t seed = 12345;
+    int mismatches = 0;
+    for (size_t n = 0; n < sizeof(data); n += 7) {
+        for (size_t k = 0; k < n; ++k) { seed = seed * 1103515245u + 12345u; data[k] = (uint8_t)(seed >> 16); }
+        size_t len = 0;
+        cms::string::appendHexBytes(text, sizeof(text), len, data, n, '\0', false);
+        for (size_t k = 0; k < n; ++k) snprintf(expect + 2 * k, 3, "%02x", data[k]);
+        expect[2 * n] = '\0';
+        if (n > 0 && strcmp(text, expect) != 0) mismatches++;
+
+        size_t written = 0;
+        if (!cms::string::decodeHexTo(text, text + len, back, sizeof(back), written) || written != n || memcmp(back, data, n) != 0) mismatches++;
+        len = 0;
+        cms::string::appendBase64(text, sizeof(text), len, data, n);
+        if (!cms::string::decodeBase64To(text, text + len, back, sizeof(back), written) || written != n || memcmp(back, data, n) != 0) mismatches++;
+        len = 0;
+        cms::string::appendBase32(text, sizeof(text), len, data, n);
+        if (!cms::string::decodeBase32To(text, text + len, back, sizeof(back), written) || written != n || memcmp(back, data, n) != 0) mismatches++;
+    }
+    CHECK(mismatches == 0);
+
+    // 디코더: 공백/대소문자 허용, 오류 위치 보고
+    size_t written = 0;
+    const char* dump = "DE ad\nBE ef";
+    CHECK(cms::string::decodeHexTo(dump, dump + strlen(dump), back, sizeof(back), written) && written == 4 && back[0] == 0xDE && back[3] == 0xEF);
+    const char* bad = "0A0G";
+    cms::string::ParseResult r = cms::string::decodeHexTo(bad, bad + 4, back, sizeof(back), written);
+    CHECK(r.ec == cms::string::ParseError::Invalid && r.ptr == bad + 3 && written == 1);
+    const char* odd = "ABC";
+    CHECK(cms::string::decodeHexTo(odd, odd + 3, back, sizeof(back), written).ec == cms::string::ParseError::Invalid);
+    const char* wrapped = "Zm9v\r\nYmFy";
+    CHECK(cms::string::decodeBase64To(wrapped, wrapped + strlen(wrapped), back, sizeof(back), written) && written == 6);
+    const char* unpadded = "Zm9vYg";
+    CHECK(cms::string::decodeBase64To(unpadded, unpadded + 6, back, sizeof(back), written) && written == 4);
+    const char* junk = "Zg==x";
+    CHECK(cms::string::decodeBase64To(junk, junk + 5, back, sizeof(back), written).ec == cms::string::ParseError::Invalid);
+    r = cms::string::decodeBase64To(b64[6], b64[6] + 8, back, 4, written);
+    CHECK(r.ec == cms::string::ParseError::OutOfRange && written == 3 && r.ptr == b64[6] + 4);
+    const char* lower = "mzxw6ytboi";
+    CHECK(cms::string::decodeBase32To(lower, lower + 10, back, sizeof(back), written) && written == 6 && memcmp(back, "foobar", 6) == 0);
+
+    // 용량 부족 시 그룹 경계에서 멈추고, 나머지를 이어서 인코딩할 수 있습니다.
+    cms::String<10> part;
+    size_t done = part.appendBase64("foobar", 6);
+    CHECK(done == 6 && part == "Zm9vYmFy");
+    cms::String<7> small;
+    done = small.appendBase64("foobar", 6);
+    CHECK(done == 3 && small == "Zm9v");
+    small.clear();
+    small.appendBase64("foobar" + done, 6 - done);
+    CHECK(small == "YmFy");
+    cms::String<6> hexSmall;
+    CHECK(hexSmall.appendHex("\x01\x02\x03", 3) == 2 && hexSmall == "0102");
+}
+
+static void testStringView() {
+    std::cout << "=== Test 11: StringView (NUL 종료 없는 구간) ===" << std::endl;
+
+    // NUL 종료가 없는 수신 버퍼의 일부를 그대로 다룹니다. (뒤쪽 'XYZ'는 구간 밖)
+    const char rx[] = {' ', 'M', 'o', 'd', 'e', ' ', '=', ' ', 'a', 'u', 't', 'o', '\t', 'X', 'Y', 'Z'};
+    cms::StringView line(rx, 13);
+    size_t eq = line.find('=');
+    CHECK(eq == 6);
+    cms::StringView key = line.substr(0, eq).trim();
+    cms::StringView value = line.substr(eq + 1).trim();
+    CHECK(key.length() == 4 && key.equals("mode", true) && !key.equals("mode"));
+    CHECK(value == "auto" && value != "autoX");
+    CHECK(line.find("XYZ") == cms::StringView::npos);
+    CHECK(!line.contains("tX") && line.contains("AUTO", true));
+    CHECK(line.substr(100).isEmpty() && line.substr(8, 100) == "auto\t");
+    CHECK(line.dropFront(1).startsWith("MODE", true) && line.trimRight().endsWith("to"));
+
+    // find/rfind: 바이트 인덱스, 대소문자 무시, 겹치는 패턴
+    cms::StringView path("a/bb/a/bb.txt");
+    CHECK(path.find("bb") == 2 && path.find("bb", 3) == 7 && path.rfind("bb") == 7);
+    CHECK(path.rfind('/') == 6 && path.find("BB.TXT", 0, true) == 7);
+    CHECK(path.findAnyOf("./") == 1 && path.find("") == 0 && path.rfind("zz") == cms::StringView::npos);
+    cms::StringView rep("aaab");
+    CHECK(rep.find("aab") == 1 && rep.rfind("aa") == 1);
+    CHECK(cms::StringView("abc") < cms::StringView("abd") && cms::StringView("ab").compare("abc") < 0);
+    CHECK(cms::StringView("Key").compareIgnoreCase("kEY") == 0);
+    CHECK(cms::StringView(nullptr).isEmpty() && cms::StringView("42").toInt() == 42);
+
+    // StringBase API: NUL 종료 없는 인자도 길이 그대로 사용됩니다.
+    cms::String<64> s("config/mode=auto");
+    CHECK(s.contains(value) && s.endsWith(value) && s.find(value) == 12);
+    CHECK(s.startsWith(cms::StringView("config/XYZ", 7)) && !s.startsWith(cms::StringView("config/XYZ", 8)));
+    CHECK(s.indexOf(cms::StringView("mode=", 4)) == 7 && s.lastIndexOf(cms::StringView("o", 1)) == 15);
+    CHECK(s.equals(s.view()) && s == s.view() && s.view() == s && s.compare(cms::StringView("config")) > 0);
+    CHECK(s.compareIgnoreCase(cms::StringView("CONFIG/MODE=AUTO")) == 0 && s < cms::StringView("d"));
+
+    cms::String<32> out(key);
+    out << '=' << value;
+    CHECK(out == "Mode=auto");
+    out.replace(cms::StringView("auto!", 4), cms::StringView("manualXX", 6));
+    CHECK(out == "Mode=manual");
+    out.insert(4, cms::StringView(" :x", 2));
+    CHECK(out == "Mode :=manual");
+    out = out.view().substr(5);   // 자기 자신의 구간 대입 (겹침)
+    CHECK(out == ":=manual");
+    out += cms::StringView("!!?", 2);
+    out.append(cms::StringView("#", 1));
+    CHECK(out == ":=manual!!#");
+
+    // Tokenizer와 Token 연동
+    cms::string::Tokenizer tk(cms::StringView("a,b;c", 3), ",;");
+    cms::string::Token t;
+    int n = 0;
+    while (tk.next(t)) n++;
+    CHECK(n == 2);
+    cms::StringView tv = t;
+    CHECK(tv == "b" && tv.toToken().len == 1);
+
+    // 커널: 길이 밖의 바이트를 읽지 않습니다. (NUL 종료 없이도 같은 결과)
+    const char hay[] = {'x', 'a', 'b', 'a', 'b', 'c'};
+    CHECK(cms::string::findBytes(hay, 6, "abc", 3) == hay + 3);
+    CHECK(cms::string::findBytes(hay, 5, "abc", 3) == nullptr);
+    CHECK(cms::string::findBytes(hay, 6, "ABC", 3, true) == hay + 3);
+    CHECK(cms::string::findLastBytes(hay, 6, "ab", 2) == hay + 3);
+    CHECK(cms::string::contains(hay, 6, "bab", 3, false) && !cms::string::contains(hay, 5, "abc", 3, false));
+}
+
+static void testStringRef() {
+    std::cout << "=== Test 12: StringRef (외부 대형 버퍼) / String 복사 ===" << std::endl;
+
+    // 복사본은 자신의 버퍼를 가져야 합니다. (원본이 함께 바뀌면 안 됨)
+    cms::String<16> a("abc");
+    cms::String<16> b = a;
+    b << "d";
+    CHECK(a == "abc" && b == "abcd" && b.c_str() != a.c_str());
+    cms::String<16> c = a + "xyz";
+    CHECK(a == "abc" && c == "abcxyz");
+    cms::String<4> narrow(c);
+    CHECK(narrow == "abc");
+
+    // 64KiB를 넘는 정적 버퍼: size_t 길이로 끝까지 채워지고, 넘치는 부분만 잘립니다.
+    static char big[70000];
+    cms::StringRef r(big);
+    CHECK(r.isEmpty() && r.capacity() == sizeof(big));
+    for (int i = 0; i < 7000; ++i) r << "0123456789";
+    CHECK(r.length() == sizeof(big) - 1 && big[sizeof(big) - 1] == '\0');
+    CHECK(r.endsWith("45678") && r.lastIndexOf("9") == 69989 && r.count() == 69999);
+    r.replace("0123", "ab");
+    CHECK(r.length() == 7000 * 8 - 1 && r.startsWith("ab456789ab"));
+    CMS_FORMAT(r, "|%s|%d", cms::StringView("tail", 2), 7);
+    CHECK(r.endsWith("|ta|7"));
+
+    // 이미 채워진 수신 버퍼를 strlen 없이 감쌉니다.
+    char rx[32] = "HTTP/1.1 200 OK\r\nXX";
+    cms::StringRef head(rx, sizeof(rx), 15);
+    CHECK(head == "HTTP/1.1 200 OK" && rx[15] == '\0' && head.contains("200"));
+    head = head.view().substr(9, 3);
+    CHECK(head.toInt() == 200);
+
+    // uint16_t 길이 변형은 StringBase&를 받는 API에 그대로 전달됩니다.
+    char mid[48];
+    cms::SmallStringRef small(mid);
+    cms::StringBase& base = small;
+    base << cms::hex(0xBEEF, 6);
+    CMS_FORMAT(small, "/%s", a);
+    CHECK(small == "00BEEF/abc");
+    static char huge[100000];
+    cms::SmallStringRef clamped(huge, sizeof(huge));
+    CHECK(clamped.capacity() == 65535);
+
+    // 길이 타입이 다른 객체(StringRef ↔ String<N>) 사이의 추출/비교/결합
+    char wide[64] = "온도=23.5C;습도=40%";
+    cms::StringRef line(wide, sizeof(wide), strlen(wide));
+    cms::String<16> part;
+    line.substring(part, 0, 8);
+    CHECK(part == "온도=23.5C" && part == line.view().substr(0, 12));
+    line.byteSubstring(part, 13);
+    CHECK(part == "습도=40%");
+    cms::String<8> tiny;
+    line.byteSubstring(tiny, 0, 7);
+    CHECK(tiny == "온도=" && tiny.length() == 7);
+    part.substring(line, 0, 2);
+    CHECK(line == "습도" && line.length() == 6);
+
+    cms::String<16> same("습도");
+    CHECK(same == line && line == same && !(same != line) && !(line != same));
+    CHECK(part != line && line != part);
+    line += part;
+    line.append(same);
+    CHECK(line == "습도습도=40%습도" && line.length() == 6 + 10 + 6);
+    part += line; // 넘치는 부분은 잘리고 기록됨
+    CHECK(part.isTruncated() && part.length() == 15 && part.startsWith("습도=40%습"));
+}
+
+static void testArena() {
+    std::cout << "=== Test 13: Arena / ArenaString ===" << std::endl;
+
+    cms::Arena<256> arena;
+    CHECK(arena.capacity() == 256 && arena.used() == 0);
+
+    // 정렬 요청이 지켜지고, 문자열 버퍼는 패딩 없이 이어서 할당됩니다.
+    void* raw = arena.allocate(3, 1);
+    uint32_t* words = static_cast<uint32_t*>(arena.allocate(4 * sizeof(uint32_t), alignof(uint32_t)));
+    CHECK(raw != nullptr && words != nullptr && ((uintptr_t)words % alignof(uint32_t)) == 0);
+
+    const cms::ArenaBase::Marker m = arena.mark();
+    {
+        cms::ArenaBase::Scope scope(arena);
+        cms::ArenaString a(arena, 64);
+        cms::ArenaString b(arena, 64);
+        a << "temp=" << 25;
+        CMS_FORMAT(b, "%s/%d", a, 7);
+        CHECK(a == "temp=25" && b == "temp=25/7" && a.capacity() == 64);
+        CHECK(arena.used() == m + 128);
+
+        cms::StringBase& base = b;
+        base.replace("/", "-");
+        CHECK(b == "temp=25-7");
+    }
+    // Scope 종료 시 블록이 반납되고, 최대 사용량은 유지됩니다.
+    CHECK(arena.used() == m && arena.peak() == m + 128);
+
+    // 공간이 부족하면 빈 문자열(용량 1)로 대체되고 추가는 모두 잘립니다.
+    cms::ArenaString huge(arena, 1024);
+    huge << "overflow";
+    CHECK(huge.isEmpty() && huge.capacity() == 1 && arena.failures() == 1);
+    CHECK(arena.allocate(1024) == nullptr && arena.failures() == 2);
+
+    arena.reset();
+    cms::ArenaString full(arena, 256);
+    CHECK(full.capacity() == 256 && arena.remaining() == 0);
+}
+
+static void testRope() {
+    std::cout << "=== Test 14: Rope (세그먼트 빌더) / BlockPool ===" << std::endl;
+
+    static cms::BlockPool<64, 8> pool;
+    CHECK(pool.blockCount() == 8 && pool.available() == 8);
+    {
+        cms::Rope rope(pool);
+        cms::String<1024> flat;
+        rope << "{\"items\":[";
+        flat << "{\"items\":[";
+        for (int i = 0; i < 20; ++i) {
+            rope.appendPrintf("%s{\"id\":%d}", i ? "," : "", i * 37);
+            flat.appendPrintf("%s{\"id\":%d}", i ? "," : "", i * 37);
+        }
+        rope << "],\"t\":" << cms::fixed(21.5, 1) << ",\"h\":\"" << cms::hex(0xBEEFu, 8) << "\"}";
+        flat << "],\"t\":" << cms::fixed(21.5, 1) << ",\"h\":\"" << cms::hex(0xBEEFu, 8) << "\"}";
+        CHECK(!rope.isTruncated() && rope.length() == flat.length() && rope.segmentCount() > 1);
+
+        // 구간을 이어 붙이면 연속 버퍼로 조립한 결과와 같아야 하며, 포맷 조각은 블록 경계에서 나뉘지 않습니다.
+        cms::Rope::Span iov[8];
+        const size_t cnt = rope.spans(iov, 8);
+        CHECK(cnt == rope.segmentCount());
+        cms::String<1024> joined;
+        size_t total = 0;
+        for (size_t i = 0; i < cnt; ++i) {
+            joined.append(iov[i].data, iov[i].len);
+            total += iov[i].len;
+            CHECK(iov[i].len <= pool.blockSize());
+        }
+        CHECK(total == rope.length() && joined == flat.c_str());
+
+        cms::String<1024> copied;
+        rope.copyTo(copied);
+        CHECK(copied == flat.c_str());
+    }
+    // 소멸 시 모든 블록이 풀로 반납됩니다.
+    CHECK(pool.available() == 8 && pool.peak() > 1);
+
+    // 긴 원시 문자열과 바이트 덤프는 블록 경계에서 나뉘어 잘리지 않습니다.
+    {
+        cms::Rope rope(pool);
+        uint8_t pkt[40];
+        for (int i = 0; i < 40; ++i) pkt[i] = (uint8_t)i;
+        rope << cms::bytes(pkt, sizeof(pkt), ' ');
+        CHECK(rope.length() == 40 * 3 - 1);
+        cms::String<256> dump;
+        rope.copyTo(dump);
+        CHECK(dump.startsWith("00 01 02") && dump.endsWith("26 27") && dump.find("0F 10") > 0);
+    }
+
+    // 풀이 바닥나면 잘림 플래그가 설정되고, clear() 후 다시 사용할 수 있습니다.
+    cms::Rope a(pool);
+    for (int i = 0; i < 100; ++i) a << "0123456789";
+    CHECK(a.isTruncated() && pool.available() == 0 && a.length() == a.segmentCount() * (pool.blockSize() - 2 * sizeof(void*)));
+    a.clear();
+    CHECK(!a.isTruncated() && a.isEmpty() && pool.available() == 8);
+}
+
+static void testInternPool() {
+    std::cout << "=== Test 15: InternPool (문자열 인턴) ===" << std::endl;
+
+    cms::InternPool<4, 40> topics;
+    using H = cms::InternPoolBase::Handle;
+    const H temp = topics.intern("sensor/temp");
+    const H hum = topics.intern("sensor/hum");
+    CHECK(temp == 0 && hum == 1 && topics.size() == 2);
+
+    // 같은 내용은 출처(Token, 부분 뷰)와 관계없이 같은 핸들로 모이며, 본문은 한 번만 저장됩니다.
+    const char* rx = "sensor/temp,22.5";
+    CHECK(topics.intern(cms::StringView(rx, 11)) == temp && topics.size() == 2);
+    CHECK(topics.find("sensor/hum") == hum && topics.find("sensor/x") == cms::InternPoolBase::INVALID);
+    CHECK(topics.view(temp) == "sensor/temp" && strcmp(topics.c_str(hum), "sensor/hum") == 0);
+    CHECK(topics.bytesUsed() == 12 + 11 && topics.hashOf(temp) != topics.hashOf(hum));
+    CHECK(topics.intern("Sensor/Temp") != temp);
+
+    // 엔트리나 문자 영역이 부족하면 INVALID를 반환하고 기존 핸들은 그대로 유효합니다.
+    CHECK(topics.intern("abcdefghijklmnopq") == cms::InternPoolBase::INVALID);
+    CHECK(topics.intern("x") == 3 && topics.intern("y") == cms::InternPoolBase::INVALID);
+    CHECK(topics.view(cms::InternPoolBase::INVALID).isEmpty() && topics.view(hum) == "sensor/hum");
+
+    // 대소문자 무시 풀은 처음 등록된 표기를 보관합니다.
+    cms::InternPool<8, 64> tags(true);
+    const H wifi = tags.intern("WiFi");
+    CHECK(tags.intern("wifi") == wifi && tags.find("WIFI") == wifi && tags.view(wifi) == "WiFi");
+    CHECK(tags.intern("") != cms::InternPoolBase::INVALID && tags.size() == 2);
+
+    tags.clear();
+    CHECK(tags.size() == 0 && tags.find("WiFi") == cms::InternPoolBase::INVALID && tags.intern("MQTT") == 0);
+}
+
+static int routeCommand(const cms::StringBase& cmd) {
+    using namespace cms::literals;
+    switch (cmd.hash(true)) {
+        case cms::string::hash("REBOOT", 6, true): return 1;
+        case "STATUS"_hash: return 2;
+        default: return 0;
+    }
+}
+
+static void testHash() {
+    std::cout << "=== Test 16: 해시 API (fnv1a/djb2/wyhash) ===" << std::endl;
+    using cms::string::HashAlgorithm;
+
+    // 알려진 값과 컴파일 타임 평가
+    static_assert(cms::string::fnv1a("", 0) == 2166136261u, "fnv1a offset basis");
+    static_assert(cms::string::fnv1a("a", 1) == 0xE40C292Cu, "fnv1a('a')");
+    static_assert(cms::string::djb2("a", 1) == 5381u * 33 + 'a', "djb2('a')");
+    static_assert(cms::StringView("GET", 3).hash() == cms::string::hash("GET", 3), "StringView::hash is constexpr");
+
+    // 모든 알고리즘/길이 구간(0, 1~3, 4~16, 17~48, 49+)에서 대소문자 무시 결과가 일치해야 합니다.
+    const char* upper = "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG 0123456789 THE QUICK BROWN FOX";
+    const char* mixed = "the Quick brown fox jumps over THE lazy dog 0123456789 the quick BROWN fox";
+    const size_t lens[] = {0, 1, 3, 4, 8, 15, 16, 17, 33, 48, 49, 60, 75};
+    const HashAlgorithm algos[] = {HashAlgorithm::Fnv1a, HashAlgorithm::Djb2, HashAlgorithm::WyHash};
+    for (HashAlgorithm algo : algos) {
+        for (size_t len : lens) {
+            CHECK(cms::string::hash(upper, len, algo, true) == cms::string::hash(mixed, len, algo, true));
+            if (len > 1) CHECK(cms::string::hash(upper, len, algo) != cms::string::hash(mixed, len, algo));
+            if (len > 0) CHECK(cms::string::hash(upper, len, algo) != cms::string::hash(upper, len - 1, algo));
+        }
+    }
+
+    // 기본 알고리즘은 짧은 키 10000개에서 충돌이 없어야 합니다. (분포 확인)
+    static uint32_t seen[10000];
+    size_t collisions = 0;
+    for (int i = 0; i < 10000; ++i) {
+        char key[16];
+        const int n = snprintf(key, sizeof(key), "key%d", i);
+        seen[i] = cms::string::hash(key, (size_t)n);
+        for (int j = 0; j < i; ++j) collisions += (seen[j] == seen[i]);
+    }
+    CHECK(collisions == 0);
+
+    // StringBase/StringView/Token은 같은 값을 내며, 내용이 바뀌면 다시 계산됩니다.
+    cms::String<32> s("sensor/temp");
+    const uint32_t h1 = s.hash();
+    CHECK(h1 == s.view().hash() && h1 == (cms::string::Token{s.c_str(), s.length()}).hash());
+    s.toUpperCase();
+    CHECK(s.hash() != h1 && s.hash(true) == cms::StringView("Sensor/Temp").hash(true));
+    s << "/x";
+    CHECK(s.hash() == cms::string::hash("SENSOR/TEMP/x", 13));
+    s.clear();
+    CHECK(s.hash() == cms::string::hash("", 0));
+
+    cms::String<16> cmd("reboot");
+    CHECK(routeCommand(cmd) == 1);
+    cmd = "STATUS";
+    CHECK(routeCommand(cmd) == 2);
+    cmd = "halt";
+    CHECK(routeCommand(cmd) == 0);
+}
+
+static void testFlatMap() {
+    std::cout << "=== Test 17: FlatMap (개방 주소법 해시 맵) ===" << std::endl;
+
+    static cms::FlatMap<cms::String<16>, int, 100> cfg;
+    CHECK(cfg.isEmpty() && cfg.maxSize() == 100 && cfg.slotCount() == 128);
+
+    // 삽입/덮어쓰기, 그리고 키 객체를 만들지 않는 이종(heterogeneous) 조회
+    for (int i = 0; i < 100; ++i) {
+        cms::String<16> key;
+        key << "key" << i;
+        CHECK(cfg.insert(key, i) != nullptr);
+    }
+    CHECK(cfg.size() == 100 && cfg.isFull());
+    CHECK(cfg.insert("overflow", 1) == nullptr);
+    CHECK(*cfg.insert("key7", 700) == 700 && cfg.size() == 100);
+
+    const char* rx = "key42=on";
+    cms::string::Token tok{rx, 5};
+    CHECK(cfg.find(tok) && *cfg.find(tok) == 42);
+    CHECK(cfg.find(cms::StringView(rx, 4)) && *cfg.find(cms::StringView(rx, 4)) == 4);
+    CHECK(*cfg.find("key7") == 700 && cfg.find("key100") == nullptr && !cfg.contains("KEY1"));
+    cms::String<8> k99("key99");
+    CHECK(cfg.contains(k99));
+
+    // 삭제 후에도 같은 탐사열의 다른 키는 계속 찾을 수 있고, 삭제 슬롯은 재사용됩니다.
+    int missing = 0;
+    for (int i = 0; i < 100; i += 2) {
+        cms::String<16> key;
+        key << "key" << i;
+        CHECK(cfg.erase(key));
+    }
+    for (int i = 0; i < 100; ++i) {
+        cms::String<16> key;
+        key << "key" << i;
+        if ((cfg.find(key) != nullptr) != (i % 2 == 1)) missing++;
+    }
+    CHECK(missing == 0 && cfg.size() == 50 && !cfg.erase("key0"));
+    for (int i = 0; i < 50; ++i) {
+        cms::String<16> key;
+        key << "new" << i;
+        CHECK(cfg.insert(key, -i) != nullptr);
+    }
+    CHECK(cfg.size() == 100 && *cfg.find("new49") == -49 && *cfg.find("key99") == 99);
+
+    int sum = 0;
+    size_t visited = 0;
+    cfg.forEach([&](const cms::String<16>& k, int& v) { (void)k; sum += v; visited++; });
+    CHECK(visited == 100);
+#ifdef CMS_ENABLE_PROFILING
+    // 적재율 100/128에서도 대부분의 조회는 한두 그룹 안에서 끝나야 합니다.
+    const auto& st = cfg.probeStats();
+    CHECK(st.lookups > 0 && st.maxGroups >= 1 && st.groups < st.lookups * 2);
+#endif
+
+    // 키 용량보다 긴 키는 잘린 채 저장되지 않습니다.
+    cfg.clear();
+    CHECK(cfg.isEmpty() && cfg.insert("a-very-long-key-name", 1) == nullptr && cfg.isEmpty());
+
+    // 상수 라우팅 테이블: StringView 키 (복사 없음)
+    cms::FlatMap<cms::StringView, int, 4> routes;
+    routes.insert("/status", 1);
+    routes.insert("/reboot", 2);
+    cms::String<32> path("/reboot?now=1");
+    CHECK(routes.find(path.view().substr(0, 7)) && *routes.find(path.view().substr(0, 7)) == 2);
+    CHECK(routes.slotCount() == 16 && !routes.contains("/"));
+}
+
+// 컴파일 타임 정렬 테이블 (전역 constexpr로 두어 정렬/배치가 상수 식에서 끝나는지 함께 확인)
+static constexpr cms::StringEntry<int> kCommandEntries[] = {
+    {"status", 1}, {"reset", 2}, {"reboot", 3}, {"resetAll", 4}, {"help", 5}, {"Hello", 6}, {"version", 7},
+};
+static constexpr auto kCommands = cms::makeStringTable(kCommandEntries);
+static constexpr auto kCommandsIc = cms::makeStringTable<true>(kCommandEntries);
+static constexpr auto kCommandsFast = cms::makePerfectStringTable(kCommandEntries);
+static_assert(kCommands.isValid() && kCommandsIc.isValid() && kCommandsFast.isValid(), "table layout");
+static_assert(kCommands[0].value == 6 && kCommands[1].value == 5 && kCommands[6].value == 7, "byte order: 'H' < 'h'");
+static_assert(kCommandsIc[0].value == 6 && kCommandsIc[1].value == 5, "ignore case: hello < help");
+static_assert(kCommandsFast.indexOf("reboot") == 2 && !kCommandsFast.contains("boot"),
+              "perfect hash lookup in constant expression");
+
+static void testStringTable() {
+    std::cout << "=== Test 18: StringTable ===" << std::endl;
+
+    // 이진 탐색 (대소문자 구분)
+    CHECK(kCommands.find("reset") && *kCommands.find("reset") == 2);
+    CHECK(kCommands.find("RESET") == nullptr && kCommands.find("res") == nullptr && kCommands.find("") == nullptr);
+    CHECK(kCommands.find("zzz") == nullptr && kCommands.find("A") == nullptr);
+    for (size_t i = 1; i < kCommands.size(); ++i) CHECK(kCommands[i - 1].key < kCommands[i].key);
+
+    // 수신 버퍼의 일부(NUL 종료 없음)로 조회
+    const char* rx = "reboot now";
+    CHECK(kCommands.find(cms::StringView(rx, 6)) && *kCommands.find(cms::StringView(rx, 6)) == 3);
+
+    // 접두사 구간과 축약 명령
+    auto r = kCommands.prefixRange("res");
+    CHECK(r.count == 2 && r.first->value == 2 && (r.first + 1)->value == 4);
+    CHECK(kCommands.prefixRange("x").isEmpty() && kCommands.prefixRange("").count == kCommands.size());
+    CHECK(kCommands.findUnique("st") && kCommands.findUnique("st")->value == 1);
+    CHECK(kCommands.findUnique("reset") && kCommands.findUnique("reset")->value == 2);
+    CHECK(kCommands.findUnique("re") == nullptr && kCommands.findUnique("q") == nullptr);
+
+    // 탭 자동 완성: 공통 접두사까지 채움
+    cms::String<32> line;
+    CHECK(kCommands.complete("res", line) == 2 && line == "reset");
+    line.clear();
+    CHECK(kCommands.complete("re", line) == 3 && line == "re");
+    line.clear();
+    CHECK(kCommands.complete("v", line) == 1 && line == "version");
+    line.clear();
+    CHECK(kCommands.complete("q", line) == 0 && line.isEmpty());
+
+    // 대소문자 무시: compareIgnoreCase와 같은 순서로 정렬되어 있어야 이진 탐색이 맞습니다.
+    CHECK(kCommandsIc.find("RESET") && *kCommandsIc.find("RESET") == 2);
+    CHECK(kCommandsIc.find("hello") && *kCommandsIc.find("hello") == 6);
+    CHECK(kCommandsIc.prefixRange("HE").count == 2 && kCommandsIc.prefixRange("h").count == 2);
+    line.clear();
+    CHECK(kCommandsIc.complete("VER", line) == 1 && line == "version");
+
+    // 완전 해시: 모든 키가 한 번의 슬롯 조회로 찾아지고, 없는 키는 비교 한 번으로 거절됩니다.
+    for (const auto& e : kCommandEntries) CHECK(kCommandsFast.find(e.key) && *kCommandsFast.find(e.key) == e.value);
+    CHECK(!kCommandsFast.contains("RESET") && !kCommandsFast.contains("") && !kCommandsFast.contains("resetAll!"));
+    CHECK(kCommandsFast.slotCount() == 16);
+
+    constexpr auto fastIc = cms::makePerfectStringTable<true>(kCommandEntries);
+    CHECK(fastIc.isValid() && fastIc.find("ReSeTaLl") && *fastIc.find("ReSeTaLl") == 4);
+
+    // 중복 키는 정적으로 검출됩니다.
+    static constexpr cms::StringEntry<int> dup[] = {{"a", 1}, {"b", 2}, {"A", 3}};
+    static_assert(cms::makeStringTable(dup).isValid(), "case-sensitive: distinct");
+    static_assert(!cms::makeStringTable<true>(dup).isValid(), "ignore case: duplicate");
+    static_assert(!cms::makePerfectStringTable<true>(dup).isValid(), "ignore case: duplicate");
+
+    // 큰 테이블도 배치에 성공해야 합니다.
+    static constexpr cms::StringEntry<int> many[] = {
+        {"AT", 0}, {"AT+GMR", 1}, {"AT+RST", 2}, {"AT+CWMODE", 3}, {"AT+CWJAP", 4}, {"AT+CWLAP", 5},
+        {"AT+CWQAP", 6}, {"AT+CIPSTART", 7}, {"AT+CIPSEND", 8}, {"AT+CIPCLOSE", 9}, {"AT+CIFSR", 10},
+        {"AT+CIPMUX", 11}, {"AT+CIPSERVER", 12}, {"AT+CIPMODE", 13}, {"AT+CIPSTO", 14}, {"AT+UART", 15},
+        {"AT+SLEEP", 16}, {"AT+RESTORE", 17}, {"AT+CIPSTATUS", 18}, {"AT+PING", 19},
+    };
+    constexpr auto manyFast = cms::makePerfectStringTable(many);
+    constexpr auto manySorted = cms::makeStringTable(many);
+    static_assert(manyFast.isValid() && manySorted.isValid(), "AT command table");
+    int found = 0;
+    for (const auto& e : many) {
+        if (manyFast.indexOf(e.key) == (size_t)e.value && manySorted.find(e.key) && *manySorted.find(e.key) == e.value) found++;
+    }
+    CHECK(found == 20 && manySorted.prefixRange("AT+CIP").count == 8 && manySorted.prefixRange("AT+CW").count == 4);
+
+    // 큰 테이블에 중복 키가 하나만 섞여도 변위 탐색 전에 바로 걸러져야 합니다. (상수 식 연산 한도 안에서 평가)
+    static constexpr cms::StringEntry<int> registers[] = {
+        {"reg00", 0}, {"reg01", 1}, {"reg02", 2}, {"reg03", 3}, {"reg04", 4}, {"reg05", 5}, {"reg06", 6}, {"reg07", 7}, {"reg08", 8}, {"reg09", 9},
+        {"reg10", 10}, {"reg11", 11}, {"reg12", 12}, {"reg13", 13}, {"reg14", 14}, {"reg15", 15}, {"reg16", 16}, {"reg17", 17}, {"reg18", 18}, {"reg19", 19},
+        {"reg20", 20}, {"reg21", 21}, {"reg22", 22}, {"reg23", 23}, {"reg24", 24}, {"reg25", 25}, {"reg26", 26}, {"reg27", 27}, {"reg28", 28}, {"reg29", 29},
+        {"reg30", 30}, {"reg31", 31}, {"reg32", 32}, {"reg33", 33}, {"reg34", 34}, {"reg35", 35}, {"reg36", 36}, {"reg37", 37}, {"reg38", 38}, {"reg39", 39},
+        {"reg40", 40}, {"reg41", 41}, {"reg42", 42}, {"reg43", 43}, {"reg44", 44}, {"reg45", 45}, {"reg46", 46}, {"reg47", 47}, {"reg48", 48}, {"reg49", 49},
+        {"reg50", 50}, {"reg51", 51}, {"reg52", 52}, {"reg53", 53}, {"reg54", 54}, {"reg55", 55}, {"reg56", 56}, {"reg57", 57}, {"reg58", 58}, {"reg59", 59},
+        {"reg60", 60}, {"reg61", 61}, {"reg62", 62}, {"reg63", 63}, {"reg64", 64}, {"reg65", 65}, {"reg66", 66}, {"reg67", 67}, {"reg68", 68}, {"reg69", 69},
+        {"reg70", 70}, {"reg71", 71}, {"reg72", 72}, {"reg73", 73}, {"reg74", 74}, {"reg75", 75}, {"reg76", 76}, {"reg77", 77}, {"reg78", 78}, {"reg41", 79},
+    };
+    static_assert(!cms::makePerfectStringTable(registers).isValid(), "80 entries with one duplicate");
+    static_assert(!cms::makePerfectStringTable<true>(registers).isValid(), "ignore case: 80 entries with one duplicate");
+    static_assert(!cms::makeStringTable(registers).isValid(), "sorted table: 80 entries with one duplicate");
+}
+
+// 컴파일 타임 문자열 조립 (전역 constexpr: 결과가 상수 식으로 완성되는지 함께 확인)
+static constexpr cms::CString<16> makeTopic(int id) {
+    cms::CString<16> s("node/");
+    s.appendInt(id, 3, '0').append('/');
+    return s;
+}
+static constexpr auto kTopic = makeTopic(7) + "temp";
+static_assert(kTopic.equals("node/007/temp") && kTopic.length() == 13 && !kTopic.isTruncated(), "topic");
+static_assert(cms::CString("ab").capacity() == 2 && ("x" + cms::CString("yz")).equals("xyz"), "deduction");
+static_assert(cms::CString<4>("abcdef").isTruncated() && cms::CString<4>("abcdef").equals("abcd"), "truncation");
+
+static void testCString() {
+    std::cout << "=== Test 19: CString ===" << std::endl;
+
+    CHECK(strcmp(kTopic.c_str(), "node/013/temp") != 0 && strcmp(kTopic.c_str(), "node/007/temp") == 0);
+
+    // 정수 포맷: 런타임 appendInt/appendHex와 같은 결과
+    constexpr auto nums = [] {
+        cms::CString<48> s;
+        s.appendInt(-42).append(' ').appendInt(-5, 4, '0').append(' ').appendInt(7, 3).append(' ');
+        s.appendUInt(18446744073709551615ULL).append(' ').appendHex(0xBEEF, 6).append(' ').appendHex(255, 0, false);
+        return s;
+    }();
+    CHECK(nums.equals("-42 -005   7 18446744073709551615 00BEEF ff"));
+    constexpr auto minVal = cms::CString<20>().appendInt(-9223372036854775807LL - 1);
+    CHECK(minVal.equals("-9223372036854775808"));
+
+    // 숫자 전체가 들어가지 않으면 쓰지 않고 잘림으로 기록
+    constexpr auto tight = cms::CString<4>("ab").appendInt(123);
+    CHECK(tight.equals("ab") && tight.isTruncated());
+
+    // 대소문자 변환
+    constexpr auto upper = cms::CString("Hello, World 1").toUpperCase();
+    constexpr auto lower = cms::CString("Hello, World 1").toLowerCase();
+    CHECK(upper.equals("HELLO, WORLD 1") && lower.equals("hello, world 1"));
+
+    // StringBase와의 상호 운용 (StringView 변환)
+    static constexpr auto kWarn = cms::CString<8>("\033[").appendInt(33).append('m');
+    cms::String<32> out;
+    out << kWarn << "hot";
+    out.append(kTopic);
+    CHECK(out == "\033[33mhotnode/007/temp" && out.length() == 21);
+    CHECK(out.startsWith(kWarn) && out.view().substr(5, 3).equals("hot") && !kWarn.equals(out.view()));
+    cms::String<16> copy;
+    copy = kTopic.view();
+    CHECK(copy.equals(kTopic) && copy.length() == kTopic.length());
+}
+
+static void testLengthKernels() {
+    std::cout << "=== Test 20: 길이 기반 커널 ===" << std::endl;
+
+    // NUL 종료가 없는 원본: 길이 버전은 지정한 구간 밖을 읽지 않습니다.
+    const char raw[] = {'a', 'b', '\xEA', '\xB0', '\x80', 'c', 'd', 'X', 'X'};
+    char out[16];
+    CHECK(cms::string::byteSubstring(raw, 7, out, sizeof(out), 5) == 2 && strcmp(out, "cd") == 0);
+    CHECK(cms::string::byteSubstring(raw, 7, out, sizeof(out), 7) == 0 && out[0] == '\0');
+    CHECK(cms::string::byteSubstring(raw, 7, out, 3, 0, 7) == 2 && strcmp(out, "ab") == 0);
+    CHECK(cms::string::substring(raw, 7, out, sizeof(out), 2, 3) == 3 && strcmp(out, "\xEA\xB0\x80") == 0);
+    CHECK(cms::string::substring(raw, 7, out, sizeof(out), 3) == 2 && strcmp(out, "cd") == 0);
+    CHECK(cms::string::substring(raw, 7, out, sizeof(out), 5) == 0);
+
+    // 구간 끝에서 잘린 멀티바이트 시퀀스는 유효하지 않습니다.
+    CHECK(cms::string::validateUtf8(raw, 7) && !cms::string::validateUtf8(raw, 4) && cms::string::validateUtf8(raw, 2));
+    CHECK(cms::string::validateUtf8("\xF0\x9F\x98\x80", 4) && !cms::string::validateUtf8("\xF0\x9F\x98", 3));
+
+    // sanitizeUtf8: 깨진 바이트는 3바이트 대체 문자로 늘어나며, 아직 읽지 않은 뒷부분을 덮어쓰지 않습니다.
+    char bad[16] = {'a', 'b', '\xFF', 'c', 'd', 'Z', 'Z'};
+    CHECK(cms::string::sanitizeUtf8(bad, sizeof(bad), 5) == 7 && strcmp(bad, "ab\xEF\xBF\xBD" "cd") == 0);
+    char lead[16] = "\xFF\xFExy";
+    CHECK(cms::string::sanitizeUtf8(lead, sizeof(lead)) == 8 && strcmp(lead, "\xEF\xBF\xBD\xEF\xBF\xBDxy") == 0);
+    char tight[5] = "\xFF\xFF";
+    CHECK(cms::string::sanitizeUtf8(tight, sizeof(tight), 2) == 4 && strcmp(tight, "\xEF\xBF\xBD?") == 0);
+    char cut[16] = "\xEA\xB0\x80\xEB\x8F";
+    CHECK(cms::string::sanitizeUtf8(cut, sizeof(cut), 5) == 9 && cms::string::validateUtf8(cut, 9));
+
+    // trim/toUpperCase: 길이 버전은 결과 끝에 NUL을 기록하고, 구간 밖은 건드리지 않습니다.
+    char buf[] = "  hi there \t\nZZ";
+    CHECK(cms::string::trim(buf, 13) == 8 && strcmp(buf, "hi there") == 0);
+    char blank[] = " \t ";
+    CHECK(cms::string::trim(blank, 3) == 0 && blank[0] == '\0');
+    char word[] = "abcdef";
+    cms::string::toUpperCase(word, 3);
+    cms::string::toLowerCase(word, 1);
+    CHECK(strcmp(word, "aBCdef") == 0);
+
+    char csv[] = "a,b,,c|d,e";
+    char* parts[8];
+    CHECK(cms::string::split(csv, 7, ',', parts, 8) == 4 && strcmp(parts[2], "") == 0 && strcmp(parts[3], "c|d,e") == 0);
+    char csv2[] = "1,2,3";
+    CHECK(cms::string::split(csv2, 5, ',', parts, 2) == 2 && strcmp(parts[1], "2,3") == 0);
+
+    // StringBase 경로는 _len만 사용합니다.
+    cms::String<32> s("  Mixed Case  ");
+    s.trim();
+    CHECK(s == "Mixed Case" && s.length() == 10);
+    s.toUpperCase();
+    CHECK(s == "MIXED CASE" && s.length() == 10);
+    cms::String<8> part;
+    s.substring(part, 6);
+    CHECK(part == "CASE" && part.isValid());
+    cms::String<16> halfChar;
+    cms::String<16>("온도").byteSubstring(halfChar, 0, 4); // "온" + "도"의 첫 바이트
+    CHECK(halfChar == "온\xEF\xBF\xBD" && halfChar.length() == 6 && halfChar.isValid());
+    cms::String<64> tokens("k=v;x=y");
+    CHECK(tokens.split(';', parts, 4) == 2 && strcmp(parts[1], "x=y") == 0);
+
+    // const char* 생성자: 초기화되지 않은 버퍼를 측정하지 않고 빈 상태에서 복사
+    const char* ptr = "0123456789";
+    cms::String<8> small(ptr);
+    CHECK(small.length() == 7 && small == "0123456");
+    const char* none = nullptr;
+    cms::String<8> empty(none);
+    CHECK(empty.isEmpty() && empty.c_str()[0] == '\0');
+}
+
+static void testTrace() {
+    std::cout << "=== Test 21: 스코프 트레이스 / Chrome JSON ===" << std::endl;
+
+    // CMS_ENABLE_TRACE와 무관하게 Scope는 항상 기록합니다. (매크로만 제거됨)
+    cms::trace::clear();
+    {
+        cms::trace::Scope outer("outer");
+        {
+            cms::trace::Scope inner("inner \"q\"");
+        }
+    }
+
+    cms::String<512> json;
+    auto toString = [](const char* data, size_t len, void* ctx) {
+        static_cast<cms::StringBase*>(ctx)->append(data, len);
+    };
+    CHECK(cms::trace::writeChromeJson(toString, &json, 1000.0) == 4);
+    CHECK(json.startsWith("{\"traceEvents\":["));
+    CHECK(json.contains("{\"name\":\"outer\",\"ph\":\"B\",\"ts\":0.000,\"pid\":1,\"tid\":0}"));
+    CHECK(json.contains("\"name\":\"inner _q_\",\"ph\":\"E\""));
+    CHECK(json.endsWith("],\"displayTimeUnit\":\"ns\"}\n"));
+    // 끝 이벤트의 시각은 시작 이후입니다.
+    CHECK(json.lastIndexOf("\"ph\":\"E\"") > json.indexOf("\"ph\":\"B\""));
+
+    // 링이 덮어써지면 남은 이벤트만 내보내며, 시작을 잃은 'E'는 건너뜁니다.
+    cms::trace::clear();
+    cms::trace::record("orphan", 'E');
+    for (int i = 0; i < CMS_TRACE_RING_SIZE; ++i) {
+        cms::trace::Scope s("loop");
+    }
+    size_t bytes = 0;
+    auto count = [](const char*, size_t len, void* ctx) { *static_cast<size_t*>(ctx) += len; };
+    CHECK(cms::trace::writeChromeJson(count, &bytes, 1000.0) == CMS_TRACE_RING_SIZE);
+    CHECK(bytes > 0);
+
+    cms::trace::clear();
+    CHECK(cms::trace::writeChromeJson(count, &bytes, 1000.0) == 0);
+    CHECK(cms::trace::droppedThreads() == 0);
+}
+
+static void testStringRegistry() {
+    std::cout << "=== Test 22: 문자열 레지스트리 ===" << std::endl;
+#ifdef CMS_ENABLE_STRING_REGISTRY
+    const size_t before = cms::registry::count();
+    {
+        cms::String<128> roomy("boot");
+        roomy.setRegistryName("roomy");
+        cms::String<8> tight;
+        tight.setRegistryName("tight");
+        CHECK(cms::registry::count() == before + 2);
+
+        // 용량을 넘는 추가는 잘리고 횟수가 기록됩니다.
+        tight << "0123456789";
+        CHECK(tight.length() == 7);
+        CHECK(tight.truncationCount() == 1);
+        CHECK(roomy.truncationCount() == 0);
+
+        // 스냅샷은 최근 생성된 버퍼부터 나열합니다.
+        cms::StringStats stats[4];
+        CHECK(cms::registry::snapshot(stats, 4) == before + 2);
+        CHECK(stats[0].name && strcmp(stats[0].name, "tight") == 0);
+        CHECK(stats[0].capacity == 8 && stats[0].length == 7 && stats[0].truncations == 1);
+        CHECK(stats[1].name && strcmp(stats[1].name, "roomy") == 0);
+        CHECK(stats[1].capacity == 128 && stats[1].peak == 4);
+
+        CHECK(cms::registry::suggestedCapacity(4) == 8);
+        cms::String<512> report;
+        auto toString = [](const char* data, size_t len, void* ctx) {
+            static_cast<cms::StringBase*>(ctx)->append(data, len);
+        };
+        CHECK(cms::registry::writeReport(stats, 2, 2, toString, &report) == 2);
+        CHECK(report.startsWith("[StringRegistry] 2 live, 1 over-provisioned (peak <= 50%), 120 B reclaimable, 1 truncated"));
+        CHECK(report.contains("  roomy            cap   128  len     4  peak     4 (  3%)  trunc 0  -> String<8>\n"));
+        CHECK(report.contains("  tight") && report.endsWith("  !! grow\n"));
+    }
+    CHECK(cms::registry::count() == before);
+#else
+    std::cout << "(CMS_ENABLE_STRING_REGISTRY 미정의 - 건너뜀)" << std::endl;
+#endif
+}
+
+static void testTruncation() {
+    std::cout << "=== Test 23: 잘림 집계 ===" << std::endl;
+
+    // 커널은 버린 바이트 수를 반환합니다. (숫자는 통째로 버려짐)
+    char buf[8];
+    size_t len = 0;
+    buf[0] = '\0';
+    CHECK(cms::string::append(buf, sizeof(buf), len, "0123456789", 10) == 3 && len == 7);
+    len = 2;
+    buf[2] = '\0';
+    CHECK(cms::string::appendInt(buf, sizeof(buf), len, -123456, 0, ' ') == 7 && len == 2);
+    CHECK(cms::string::appendHex(buf, sizeof(buf), len, 0xBEEFu, 6, '0') == 6 && len == 2);
+    CHECK(cms::string::appendFloat(buf, sizeof(buf), len, 3.14159, 4) == 6 && len == 2);
+    CHECK(cms::string::appendUInt(buf, sizeof(buf), len, 42u) == 0 && strcmp(buf, "0142") == 0);
+
+    // appendPrintf는 snprintf와 같이 공간이 충분했다면 됐을 길이를 반환합니다.
+    cms::String<8> p;
+    CHECK(p.appendPrintf("%s=%d", "temp", 12345) == 10);
+    CHECK(p == "temp=" && p.isTruncated());
+    CHECK(p.printf("%d", 7) == 1 && p == "7");
+    // 잘림 플래그는 clear()/대입으로 지워지지 않습니다.
+    CHECK(p.isTruncated());
+    p.clearTruncated();
+    CHECK(!p.isTruncated());
+
+    cms::resetTruncationStats();
+    {
+        cms::String<8> s("abc");
+        s << cms::pad(12345, 6, '0');
+        CHECK(s == "abc" && s.isTruncated());
+        s.clearTruncated();
+        s << cms::hex(0xBEEFu, 4) << cms::fixed(1.5, 1);
+        CHECK(s == "abcBEEF" && s.isTruncated());
+
+        // 삽입과 치환도 넘친 바이트를 기록합니다.
+        cms::String<8> ins("abcdef");
+        ins.insert(0, "XYZ");
+        CHECK(ins == "Xabcdef" && ins.isTruncated());
+        cms::String<8> rep("a.b.c");
+        rep.replace(".", "---");
+        CHECK(rep == "a---b.c" && rep.isTruncated());
+
+        cms::String<8> view;
+        view = cms::StringView("0123456789");
+        CHECK(view.length() == 7 && view.isTruncated());
+        cms::String<16> fmt;
+        CHECK(CMS_FORMAT(fmt, "%s-%08X", "abcdefgh", 0xBEEFu) == 17 && fmt == "abcdefgh-" && fmt.isTruncated());
+
+        cms::String<12> bin;
+        const uint8_t packet[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+        CHECK(bin.appendBase64(packet, sizeof(packet)) == 6 && bin == "AQIDBAUG" && bin.isTruncated());
+    }
+    // 6(pad) + 3(fixed) + 2(insert) + 2(replace) + 3(view) + 8(%08X) + 4(Base64 "Bwg=")
+    const cms::TruncationStats t = cms::truncationStats();
+    CHECK(t.events == 7 && t.bytes == 28);
+    cms::resetTruncationStats();
+    CHECK(cms::truncationStats().events == 0);
+
+    // Rope는 조각이 블록 크기를 넘으면 잘림으로 표시합니다.
+    static cms::BlockPool<32, 4> pool;
+    cms::Rope rope(pool);
+    rope.appendPrintf("%s", "0123456789abcdef");
+    CHECK(!rope.isTruncated());
+    rope.appendPrintf("%s%s", "0123456789abcdef", "0123456789abcdef");
+    CHECK(rope.isTruncated() && rope.length() == 16 + 31);
+}
+
+int main() {
+    testUtf8Count();
+    testTokenizer();
+    testCsvParser();
+    testFloatFormat();
+    testFloatParse();
+    testIntParse();
+    testIntFormat();
+    testCompiledFormat();
+    testManipulators();
+    testBinaryText();
+    testStringView();
+    testStringRef();
+    testArena();
+    testRope();
+    testInternPool();
+    testHash();
+    testFlatMap();
+    testStringTable();
+    testCString();
+    testLengthKernels();
+    testTrace();
+    testStringRegistry();
+    testTruncation();
+
+    if (g_failures) {
+        std::cout << "\n실패: " << g_failures << "건" << std::endl;
+        return 1;
+    }
+    std::cout << "\n모든 문자열 테스트 통과" << std::endl;
+    return 0;
+}
+
+#endif // CMS_STRING_TEST